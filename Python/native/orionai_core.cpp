@@ -0,0 +1,230 @@
+// OrionAI - Python bindings for OrionCore
+// The plugin's pattern matcher and PII sanitizer as the _orionai_core extension module
+
+#include "OrionCoreMatcher.h"
+#include "OrionCorePrefilter.h"
+#include "OrionCoreSanitizer.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <array>
+#include <map>
+#include <optional>
+
+namespace py = pybind11;
+
+namespace OrionCoreBindings
+{
+	using FCategoryMatches = std::array<int32_t, (size_t)OrionCore::EPatternCategory::Count>;
+
+	static FCategoryMatches ToMatches(const OrionCore::FScanResult& Result)
+	{
+		FCategoryMatches Matches;
+		for (size_t Category = 0; Category < Matches.size(); Category++)
+		{
+			Matches[Category] = Result.FirstMatch[Category];
+		}
+		return Matches;
+	}
+
+	static std::vector<OrionCore::FTextView> ToViews(const std::vector<std::u16string>& Texts)
+	{
+		return std::vector<OrionCore::FTextView>(Texts.begin(), Texts.end());
+	}
+
+	static OrionCore::ESimdLevel ParseSimdLevel(const std::string& Name)
+	{
+		for (OrionCore::ESimdLevel Level : { OrionCore::ESimdLevel::Scalar, OrionCore::ESimdLevel::SSE41, OrionCore::ESimdLevel::AVX2, OrionCore::ESimdLevel::NEON })
+		{
+			if (Name == OrionCore::Prefilter::LexToString(Level))
+			{
+				return Level;
+			}
+		}
+		throw py::value_error("Unknown SIMD level '" + Name + "'");
+	}
+
+	/**
+	 * Compiled Intersect/Fulcrum patterns
+	 * Text is converted to UTF-16 while the GIL is held; the scans themselves run without it,
+	 * so other Python threads keep going while a batch is matched.
+	 */
+	class FPyPatternMatcher
+	{
+	public:
+		FPyPatternMatcher(const std::vector<std::vector<std::u16string>>& Categories, bool bUnicodeFolding, bool bNormalize,
+			int32_t MaxEditDistance, int32_t MinFuzzyLength)
+		{
+			if (Categories.size() != (size_t)OrionCore::EPatternCategory::Count)
+			{
+				throw py::value_error("Expected one pattern list per category");
+			}
+
+			for (size_t Category = 0; Category < Categories.size(); Category++)
+			{
+				for (const std::u16string& Pattern : Categories[Category])
+				{
+					Matcher.AddPattern((OrionCore::EPatternCategory)Category, Pattern);
+				}
+			}
+
+			OrionCore::FMatcherOptions Options;
+			Options.bUnicodeFolding = bUnicodeFolding;
+			Options.bNormalize = bNormalize;
+			Options.MaxEditDistance = MaxEditDistance;
+			Options.MinFuzzyLength = MinFuzzyLength;
+			Matcher.Compile(Options);
+		}
+
+		FCategoryMatches Scan(const std::u16string& Text) const
+		{
+			OrionCore::FScanResult Result;
+			{
+				py::gil_scoped_release Release;
+				Matcher.Scan(Text, Result);
+			}
+			return ToMatches(Result);
+		}
+
+		std::vector<FCategoryMatches> ScanBatch(const std::vector<std::u16string>& Texts) const
+		{
+			const std::vector<OrionCore::FTextView> Views = ToViews(Texts);
+			std::vector<OrionCore::FScanResult> Results(Views.size());
+			{
+				py::gil_scoped_release Release;
+				Matcher.ScanBatch(Views.data(), (int32_t)Views.size(), Results.data());
+			}
+
+			std::vector<FCategoryMatches> Matches;
+			Matches.reserve(Results.size());
+			for (const OrionCore::FScanResult& Result : Results)
+			{
+				Matches.push_back(ToMatches(Result));
+			}
+			return Matches;
+		}
+
+		std::optional<int32_t> ScanFirst(const std::u16string& Text) const
+		{
+			OrionCore::EPatternCategory Category = OrionCore::EPatternCategory::Hallucination;
+			bool bFound;
+			{
+				py::gil_scoped_release Release;
+				bFound = Matcher.ScanFirst(Text, Category);
+			}
+			return bFound ? std::optional<int32_t>((int32_t)Category) : std::nullopt;
+		}
+
+		std::u16string GetPattern(int32_t Category, int32_t Index) const
+		{
+			if (Category < 0 || Category >= (int32_t)OrionCore::EPatternCategory::Count
+				|| Index < 0 || Index >= Matcher.GetNumPatterns((OrionCore::EPatternCategory)Category))
+			{
+				throw py::index_error("No such pattern");
+			}
+			return Matcher.GetPattern((OrionCore::EPatternCategory)Category, Index);
+		}
+
+		const OrionCore::FPatternMatcher& Get() const { return Matcher; }
+
+	private:
+		OrionCore::FPatternMatcher Matcher;
+	};
+
+	/** Charles Carmichael's built-in rules with their configured replacements */
+	class FPyPiiSanitizer
+	{
+	public:
+		explicit FPyPiiSanitizer(const std::map<std::u16string, std::u16string>& Rules)
+		{
+			for (const auto& Rule : Rules)
+			{
+				if (!Sanitizer.AddRule(Rule.first, Rule.second))
+				{
+					UnknownRules.push_back(Rule.first);
+				}
+			}
+		}
+
+		/** Sanitized text, or None if no rule matched */
+		std::optional<std::u16string> Sanitize(const std::u16string& Text) const
+		{
+			std::u16string Sanitized;
+			bool bModified;
+			{
+				py::gil_scoped_release Release;
+				bModified = Sanitizer.Sanitize(Text, Sanitized);
+			}
+			return bModified ? std::optional<std::u16string>(std::move(Sanitized)) : std::nullopt;
+		}
+
+		std::vector<std::optional<std::u16string>> SanitizeBatch(const std::vector<std::u16string>& Texts) const
+		{
+			const std::vector<OrionCore::FTextView> Views = ToViews(Texts);
+			std::vector<OrionCore::FSanitizeResult> Results(Views.size());
+			{
+				py::gil_scoped_release Release;
+				Sanitizer.SanitizeBatch(Views.data(), (int32_t)Views.size(), Results.data());
+			}
+
+			std::vector<std::optional<std::u16string>> Sanitized;
+			Sanitized.reserve(Results.size());
+			for (OrionCore::FSanitizeResult& Result : Results)
+			{
+				Sanitized.push_back(Result.bModified ? std::optional<std::u16string>(std::move(Result.Text)) : std::nullopt);
+			}
+			return Sanitized;
+		}
+
+		int32_t GetNumRules() const { return Sanitizer.GetNumRules(); }
+
+		const std::vector<std::u16string>& GetUnknownRules() const { return UnknownRules; }
+
+	private:
+		OrionCore::FPiiSanitizer Sanitizer;
+		std::vector<std::u16string> UnknownRules;
+	};
+}
+
+PYBIND11_MODULE(_orionai_core, Module)
+{
+	using namespace OrionCoreBindings;
+
+	Module.doc() = "OrionCore - the OrionAI plugin's pattern matcher and PII sanitizer";
+
+	Module.attr("NUM_CATEGORIES") = (int32_t)OrionCore::EPatternCategory::Count;
+	Module.attr("MAX_EDIT_DISTANCE") = OrionCore::FPatternMatcher::MaxFuzzyEditDistance;
+
+	Module.def("simd_level", []() { return std::string(OrionCore::Prefilter::LexToString(OrionCore::Prefilter::GetActiveLevel())); },
+		"Level the prefilters run at: Scalar, SSE4.1, AVX2 or NEON");
+	Module.def("supported_simd_level", []() { return std::string(OrionCore::Prefilter::LexToString(OrionCore::Prefilter::GetSupportedLevel())); },
+		"Fastest level this CPU supports");
+	Module.def("set_simd_level", [](const std::string& Name) { OrionCore::Prefilter::SetActiveLevel(ParseSimdLevel(Name)); },
+		py::arg("level"), "Override the prefilter level; unsupported levels fall back to the supported one");
+
+	py::class_<FPyPatternMatcher>(Module, "PatternMatcher",
+		"Aho-Corasick matcher over the Intersect/Fulcrum pattern lists, one list per category in stage order")
+		.def(py::init<const std::vector<std::vector<std::u16string>>&, bool, bool, int32_t, int32_t>(),
+			py::arg("categories"), py::arg("unicode_folding") = false, py::arg("normalize") = false,
+			py::arg("max_edit_distance") = 0, py::arg("min_fuzzy_length") = 12)
+		.def("scan", &FPyPatternMatcher::Scan, py::arg("text"),
+			"Index of the first pattern (in list order) hit per category, -1 where none is")
+		.def("scan_batch", &FPyPatternMatcher::ScanBatch, py::arg("texts"),
+			"scan() each text, with the GIL released for the whole batch")
+		.def("scan_first", &FPyPatternMatcher::ScanFirst, py::arg("text"),
+			"Category of the pattern that ends first in the text, or None")
+		.def("pattern", &FPyPatternMatcher::GetPattern, py::arg("category"), py::arg("index"))
+		.def_property_readonly("num_patterns", [](const FPyPatternMatcher& Self) { return Self.Get().GetNumPatterns(); })
+		.def_property_readonly("num_states", [](const FPyPatternMatcher& Self) { return Self.Get().GetNumStates(); })
+		.def_property_readonly("num_fuzzy_patterns", [](const FPyPatternMatcher& Self) { return Self.Get().GetNumFuzzyPatterns(); });
+
+	py::class_<FPyPiiSanitizer>(Module, "PiiSanitizer",
+		"Charles Carmichael's built-in PII rules; rule names are matched case-insensitively")
+		.def(py::init<const std::map<std::u16string, std::u16string>&>(), py::arg("rules"))
+		.def("sanitize", &FPyPiiSanitizer::Sanitize, py::arg("text"), "Sanitized text, or None if no rule matched")
+		.def("sanitize_batch", &FPyPiiSanitizer::SanitizeBatch, py::arg("texts"),
+			"sanitize() each text, with the GIL released for the whole batch")
+		.def_property_readonly("num_rules", &FPyPiiSanitizer::GetNumRules)
+		.def_property_readonly("unknown_rules", &FPyPiiSanitizer::GetUnknownRules, "Configured rule names that were skipped");
+}
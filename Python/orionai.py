@@ -8,11 +8,19 @@ Industry-agnostic AI validation, monitoring, and safety system.
 import json
 import os
 import re
+import string
 from datetime import datetime
 from enum import Enum
 from typing import List, Dict, Optional, Tuple
 from dataclasses import dataclass, field
 
+# OrionCore, the plugin's own C++ matcher and sanitizer, built by setup.py when a
+# compiler and pybind11 are available. Without it everything below runs in pure Python.
+try:
+    import _orionai_core
+except ImportError:
+    _orionai_core = None
+
 
 class ValidationResult(Enum):
     """Validation result status"""
@@ -23,6 +31,177 @@ class ValidationResult(Enum):
     SANITIZED = "sanitized"
 
 
+def native_core_available() -> bool:
+    """True if the OrionCore extension is built and ORIONAI_DISABLE_NATIVE isn't set"""
+    return _orionai_core is not None and os.environ.get("ORIONAI_DISABLE_NATIVE") != "1"
+
+
+def _use_native(use_native: Optional[bool]) -> bool:
+    if use_native is None:
+        return native_core_available()
+    if use_native and _orionai_core is None:
+        raise RuntimeError("OrionCore native extension is not built")
+    return use_native
+
+
+# Pattern categories, in the order the Intersect Scanner and Fulcrum Filter check them
+# (EOrionPatternCategory in the plugin)
+HALLUCINATION, BIAS, TOXICITY, PROMPT_INJECTION, DATA_EXFILTRATION = range(5)
+NUM_CATEGORIES = 5
+
+_ASCII_LOWER = str.maketrans(string.ascii_uppercase, string.ascii_lowercase)
+
+
+def _fold_ascii(text: str) -> str:
+    return text.translate(_ASCII_LOWER)
+
+
+class PatternScanner:
+    """
+    Intersect/Fulcrum pattern matching - every category in one pass
+
+    Reports, per category, the first pattern in list order that occurs in the text, the
+    way the plugin's FOrionPatternMatcher does. With the native core this is that very
+    matcher, and scan_batch() matches a whole batch with the GIL released. The pure
+    Python fallback matches exactly (no normalizeText or maxEditDistance) and folds case
+    with str.lower() for "unicode" case folding.
+    """
+
+    def __init__(
+        self,
+        categories: List[List[str]],
+        case_folding: str = "ascii",
+        normalize: bool = False,
+        max_edit_distance: int = 0,
+        min_fuzzy_length: int = 12,
+        use_native: Optional[bool] = None,
+    ):
+        if len(categories) != NUM_CATEGORIES:
+            raise ValueError("Expected one pattern list per category")
+
+        self.categories = [list(patterns) for patterns in categories]
+        self._fold = str.lower if case_folding == "unicode" else _fold_ascii
+        self._folded = [
+            [self._fold(p) for p in patterns] for patterns in self.categories
+        ]
+
+        self.native = None
+        if _use_native(use_native):
+            self.native = _orionai_core.PatternMatcher(
+                self.categories,
+                unicode_folding=case_folding == "unicode",
+                normalize=normalize,
+                max_edit_distance=max_edit_distance,
+                min_fuzzy_length=min_fuzzy_length,
+            )
+        elif normalize or max_edit_distance > 0:
+            print(
+                "[!] Intersect Scanner: normalizeText/maxEditDistance need the "
+                "native core - matching exactly"
+            )
+
+    def pattern(self, category: int, index: int) -> str:
+        return self.categories[category][index]
+
+    def scan(self, text: str) -> List[int]:
+        """Index of the first pattern hit per category, -1 where none is"""
+        if self.native is not None:
+            try:
+                return list(self.native.scan(text))
+            except TypeError:
+                pass  # Text with no UTF-16 form (lone surrogates)
+        return self._scan_python(text)
+
+    def scan_batch(self, texts: List[str]) -> List[List[int]]:
+        """scan() each text; natively, in a single call"""
+        if self.native is not None:
+            try:
+                return [list(matches) for matches in self.native.scan_batch(texts)]
+            except TypeError:
+                pass
+        return [self._scan_python(text) for text in texts]
+
+    def _scan_python(self, text: str) -> List[int]:
+        folded = self._fold(text)
+        return [
+            next((index for index, p in enumerate(patterns) if p in folded), -1)
+            for patterns in self._folded
+        ]
+
+
+class PiiSanitizer:
+    """
+    Charles Carmichael's built-in PII rules
+
+    Rules apply in one left-to-right pass: the leftmost match wins, and earlier rules
+    win at the same position. Digits and word boundaries are ASCII-only, as in the
+    plugin. With the native core this is the plugin's own FPiiSanitizer; the fallback is
+    the same alternation in re.
+    """
+
+    # Known rule names, in match priority order
+    RULE_PATTERNS = {
+        "emails": r"\b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b",
+        "ssn": r"\b\d{3}-\d{2}-\d{4}\b",
+        "creditCards": r"\b(?:\d{4}[- ]?){3}\d{4}\b",
+        "phoneNumbers": r"\b\d{3}[-.]?\d{3}[-.]?\d{4}\b",
+        "ipAddresses": r"\b(?:\d{1,3}\.){3}\d{1,3}\b",
+    }
+
+    def __init__(self, rules: Dict[str, str], use_native: Optional[bool] = None):
+        known = {name.lower(): name for name in self.RULE_PATTERNS}
+        self.replacements: Dict[str, str] = {}
+        for name, replacement in rules.items():
+            if name.lower() in known:
+                self.replacements[known[name.lower()]] = replacement
+            else:
+                print(
+                    f"[!] Charles Carmichael: Unknown sanitization rule '{name}' skipped"
+                )
+
+        # Rules in capture-group order: group N + 1 belongs to self._rule_names[N]
+        self._rule_names = [n for n in self.RULE_PATTERNS if n in self.replacements]
+        self._combined = None
+        if self._rule_names:
+            self._combined = re.compile(
+                "|".join(f"({self.RULE_PATTERNS[n]})" for n in self._rule_names),
+                re.ASCII,
+            )
+
+        self.native = None
+        if _use_native(use_native):
+            self.native = _orionai_core.PiiSanitizer(self.replacements)
+
+    def sanitize(self, text: str) -> str:
+        """Text with every PII match replaced (text itself if nothing matched)"""
+        if self.native is not None:
+            try:
+                sanitized = self.native.sanitize(text)
+                return text if sanitized is None else sanitized
+            except TypeError:
+                pass  # Text with no UTF-16 form (lone surrogates)
+        return self._sanitize_python(text)
+
+    def sanitize_batch(self, texts: List[str]) -> List[str]:
+        """sanitize() each text; natively, in a single call"""
+        if self.native is not None:
+            try:
+                return [
+                    text if sanitized is None else sanitized
+                    for text, sanitized in zip(texts, self.native.sanitize_batch(texts))
+                ]
+            except TypeError:
+                pass
+        return [self._sanitize_python(text) for text in texts]
+
+    def _sanitize_python(self, text: str) -> str:
+        if self._combined is None:
+            return text
+        return self._combined.sub(
+            lambda m: self.replacements[self._rule_names[m.lastindex - 1]], text
+        )
+
+
 class RingIntel:
     """Ring Intel - ML-based toxicity analysis (optional)"""
 
@@ -158,14 +337,60 @@ class OrionAI:
         if report.result == ValidationResult.APPROVED:
             # Safe to use
             print(report.sanitized_decision)
+
+        # Validate a batch - matching and sanitization run once for all of it
+        reports = orion.monitor_ai_decisions("ChatBot", ["Hi!", "SSN 123-45-6789"])
     """
 
-    def __init__(self, config_path: str = "Config/CaseyProtocol.json"):
-        """Initialize OrionAI with Casey Protocol configuration"""
+    # Keywords the Python package has always checked on top of the Casey Protocol's
+    # Intersect lists; matched after the configured patterns of each category
+    BUILTIN_HALLUCINATION_KEYWORDS = [
+        "cannot verify",
+        "i don't know",
+        "flying elephant",
+        "free unlimited",
+        "instant approval",
+        "guarantee",
+    ]
+    BUILTIN_BIAS_KEYWORDS = [
+        "only men",
+        "only women",
+        "hire men",
+        "hire women",
+        "women can't",
+        "men are better",
+        "only white",
+        "real men",
+        "act like",
+        "obviously",
+    ]
+    BUILTIN_TOXICITY_KEYWORDS = ["idiot", "die", "kill yourself", "worthless", "hate"]
+
+    def __init__(
+        self,
+        config_path: str = "Config/CaseyProtocol.json",
+        use_native: Optional[bool] = None,
+    ):
+        """
+        Initialize OrionAI with Casey Protocol configuration
+
+        Args:
+            config_path: Casey Protocol JSON
+            use_native: Use the native OrionCore extension; None uses it if built
+        """
         self.config = CaseyProtocol(config_path)
         self.safe_mode_active = False
         self.consecutive_failures = 0
 
+        # Compiled once; every validation reuses them
+        self.patterns = self._build_pattern_scanner(use_native)
+        sanitization_rules = (
+            self.config.charles.get("sanitizationRules", {})
+            if self.config.charles.get("enabled")
+            else {}
+        )
+        self.sanitizer = PiiSanitizer(sanitization_rules, use_native)
+
         # Initialize optional modules
         self.ring_intel = RingIntel()
         self.nerd_herd = NerdHerd()
@@ -198,8 +423,45 @@ class OrionAI:
         print(
             f"[+] Morgan Mode: {'ACTIVE' if self.config.morgan.get('enabled') else 'DISABLED'}"
         )
+        native_status = (
+            f"ACTIVE ({_orionai_core.simd_level()})"
+            if self.patterns.native is not None
+            else "DISABLED (pure Python)"
+        )
+        print(f"[+] Native Core: {native_status}")
         print("=" * 50)
 
+    def _build_pattern_scanner(self, use_native: Optional[bool]) -> PatternScanner:
+        """One scanner over every category, built like the plugin's FOrionPatternMatcher::Build"""
+        intersect = self.config.intersect
+        fulcrum = self.config.fulcrum
+        categories: List[List[str]] = [[] for _ in range(NUM_CATEGORIES)]
+
+        def add(category: int, patterns: List[str]):
+            seen = {_fold_ascii(p) for p in categories[category]}
+            categories[category] += [p for p in patterns if _fold_ascii(p) not in seen]
+
+        if intersect.get("enabled"):
+            add(HALLUCINATION, intersect.get("hallucinationPatterns", []))
+            add(HALLUCINATION, self.BUILTIN_HALLUCINATION_KEYWORDS)
+            add(BIAS, intersect.get("biasKeywords", []))
+            add(BIAS, self.BUILTIN_BIAS_KEYWORDS)
+            add(TOXICITY, intersect.get("toxicityPatterns", []))
+            add(TOXICITY, self.BUILTIN_TOXICITY_KEYWORDS)
+
+        if fulcrum.get("enabled"):
+            add(PROMPT_INJECTION, fulcrum.get("promptInjectionPatterns", []))
+            add(DATA_EXFILTRATION, fulcrum.get("dataExfiltrationPatterns", []))
+
+        return PatternScanner(
+            categories,
+            case_folding=intersect.get("caseFolding", "ascii"),
+            normalize=intersect.get("normalizeText", False),
+            max_edit_distance=intersect.get("maxEditDistance", 0),
+            min_fuzzy_length=intersect.get("minFuzzyPatternLength", 12),
+            use_native=use_native,
+        )
+
     def monitor_ai_decision(
         self, ai_system: str, decision: str, context: str = ""
     ) -> ValidationReport:
@@ -214,6 +476,50 @@ class OrionAI:
         Returns:
             ValidationReport with result and details
         """
+        return self._monitor(ai_system, decision, context)
+
+    def monitor_ai_decisions(
+        self, ai_system: str, decisions: List[str], contexts: Optional[List[str]] = None
+    ) -> List[ValidationReport]:
+        """
+        Monitor a batch of AI decisions
+
+        Pattern matching and PII sanitization each run once over the whole batch -
+        with the native core, as single calls that release the GIL. Reports are the
+        same as calling monitor_ai_decision() on each decision in order, safe mode
+        included.
+
+        Args:
+            ai_system: Name of the AI system
+            decisions: The AI-generated outputs to validate
+            contexts: Optional context per decision
+
+        Returns:
+            One ValidationReport per decision
+        """
+        if contexts is None:
+            contexts = [""] * len(decisions)
+        if len(contexts) != len(decisions):
+            raise ValueError("Expected one context per decision")
+
+        matches = self.patterns.scan_batch(decisions)
+        sanitized = self.sanitizer.sanitize_batch(decisions)
+        return [
+            self._monitor(ai_system, decision, context, match, clean)
+            for decision, context, match, clean in zip(
+                decisions, contexts, matches, sanitized
+            )
+        ]
+
+    def _monitor(
+        self,
+        ai_system: str,
+        decision: str,
+        context: str,
+        matches: Optional[List[int]] = None,
+        sanitized: Optional[str] = None,
+    ) -> ValidationReport:
+        """monitor_ai_decision(), optionally with scan and sanitization already done"""
         if self.safe_mode_active:
             return ValidationReport(
                 result=ValidationResult.REJECTED,
@@ -239,8 +545,11 @@ class OrionAI:
             f"Validating decision from {ai_system}: {decision}", verbose=True
         )
 
+        if matches is None:
+            matches = self.patterns.scan(decision)
+
         # Run Intersect Scanner
-        if not self._run_intersect_scan(decision, report):
+        if not self._run_intersect_scan(decision, report, matches):
             self.consecutive_failures += 1
             self.rejected_count += 1
 
@@ -256,14 +565,14 @@ class OrionAI:
             return report
 
         # Run Fulcrum Filter
-        if not self._run_fulcrum_filter(decision, report):
+        if not self._run_fulcrum_filter(decision, report, matches):
             self.consecutive_failures += 1
             self.rejected_count += 1
             return report
 
         # Apply Charles Carmichael sanitization
         if self.config.charles.get("enabled"):
-            sanitized = self._sanitize_with_charles_carmichael(decision)
+            sanitized = self._sanitize_with_charles_carmichael(decision, sanitized)
             if sanitized != decision:
                 report.sanitized_decision = sanitized
                 report.result = ValidationResult.SANITIZED
@@ -302,68 +611,53 @@ class OrionAI:
         report = self.monitor_ai_decision("QuickValidate", decision)
         return report.result in [ValidationResult.APPROVED, ValidationResult.SANITIZED]
 
-    def _run_intersect_scan(self, decision: str, report: ValidationReport) -> bool:
+    def _run_intersect_scan(
+        self,
+        decision: str,
+        report: ValidationReport,
+        matches: Optional[List[int]] = None,
+    ) -> bool:
         """Intersect Scanner - Core validation engine"""
         if not self.config.intersect.get("enabled"):
             return True
 
-        lower_decision = decision.lower()
+        if matches is None:
+            matches = self.patterns.scan(decision)
 
-        # Check hallucination patterns with flexible matching
-        hallucination_keywords = [
-            "cannot verify",
-            "i don't know",
-            "flying elephant",
-            "free unlimited",
-            "instant approval",
-            "guarantee",
-        ]
-        for pattern in hallucination_keywords:
-            if pattern.lower() in lower_decision:
-                report.result = ValidationResult.QUARANTINED
-                report.triggered_rules.append(
-                    f"Intersect: Hallucination detected - '{pattern}'"
-                )
-                report.suspicion_score += 1.0
-                print(f"[X] ORIONAI: HALLUCINATION DETECTED - '{pattern}'")
-                return False
-
-        # Check bias keywords with flexible matching
-        bias_keywords = [
-            "only men",
-            "only women",
-            "hire men",
-            "hire women",
-            "women can't",
-            "men are better",
-            "only white",
-            "real men",
-            "act like",
-            "obviously",
-        ]
-        for bias in bias_keywords:
-            if bias.lower() in lower_decision:
-                report.result = ValidationResult.QUARANTINED
-                report.triggered_rules.append(f"Intersect: Bias detected - '{bias}'")
-                report.suspicion_score += 0.9
-                print(f"[X] ORIONAI: BIAS DETECTED - '{bias}'")
-                return False
-
-        # Check toxicity patterns with flexible matching
-        toxicity_keywords = ["idiot", "die", "kill yourself", "worthless", "hate"]
-        for toxicity in toxicity_keywords:
-            if toxicity.lower() in lower_decision:
-                report.result = ValidationResult.REJECTED
-                report.triggered_rules.append(
-                    f"Intersect: Toxicity detected - '{toxicity}'"
-                )
-                report.suspicion_score += 0.8
-                if self.config.stay_in_car.get("quarantineThresholds", {}).get(
-                    "autoQuarantineOnToxicity"
-                ):
-                    report.result = ValidationResult.QUARANTINED
-                print(f"[X] ORIONAI: TOXICITY DETECTED - '{toxicity}'")
-                return False
+        # Any hit rejects, as in the plugin - only the suspicion added differs
+        # Check hallucination patterns
+        if matches[HALLUCINATION] >= 0:
+            pattern = self.patterns.pattern(HALLUCINATION, matches[HALLUCINATION])
+            report.result = ValidationResult.REJECTED
+            report.triggered_rules.append(
+                f"Intersect: Hallucination detected - '{pattern}'"
+            )
+            report.suspicion_score += 1.0
+            print(f"[X] ORIONAI: HALLUCINATION DETECTED - '{pattern}'")
+            return False
+
+        # Check bias keywords
+        if matches[BIAS] >= 0:
+            bias = self.patterns.pattern(BIAS, matches[BIAS])
+            report.result = ValidationResult.REJECTED
+            report.triggered_rules.append(f"Intersect: Bias detected - '{bias}'")
+            report.suspicion_score += 0.9
+            print(f"[X] ORIONAI: BIAS DETECTED - '{bias}'")
+
+            # Bias triggers immediate safe mode
+            self._enter_buy_more_mode("Bias detection - immediate safety protocol")
+            return False
+
+        # Check toxicity patterns
+        if matches[TOXICITY] >= 0:
+            toxicity = self.patterns.pattern(TOXICITY, matches[TOXICITY])
+            report.result = ValidationResult.REJECTED
+            report.triggered_rules.append(
+                f"Intersect: Toxicity detected - '{toxicity}'"
+            )
+            report.suspicion_score += 0.8
+            print(f"[X] ORIONAI: TOXICITY DETECTED - '{toxicity}'")
+            return False
 
         # Check PII patterns
         for pii_pattern in self.config.intersect.get("piiPatterns", []):
@@ -381,69 +675,54 @@ class OrionAI:
 
         return True
 
-    def _run_fulcrum_filter(self, decision: str, report: ValidationReport) -> bool:
+    def _run_fulcrum_filter(
+        self,
+        decision: str,
+        report: ValidationReport,
+        matches: Optional[List[int]] = None,
+    ) -> bool:
         """Fulcrum Filter - Adversarial input detection"""
         if not self.config.fulcrum.get("enabled"):
             return True
 
-        lower_decision = decision.lower()
+        if matches is None:
+            matches = self.patterns.scan(decision)
 
         # Check prompt injection patterns
-        for pattern in self.config.fulcrum.get("promptInjectionPatterns", []):
-            if pattern.lower() in lower_decision:
-                report.result = ValidationResult.REJECTED
-                report.triggered_rules.append(
-                    f"Fulcrum: Prompt injection attempt - '{pattern}'"
-                )
-                report.suspicion_score += 1.0
-                print(f"[X] ORIONAI: PROMPT INJECTION DETECTED - '{pattern}'")
-                return False
+        if matches[PROMPT_INJECTION] >= 0:
+            pattern = self.patterns.pattern(PROMPT_INJECTION, matches[PROMPT_INJECTION])
+            report.result = ValidationResult.REJECTED
+            report.triggered_rules.append(
+                f"Fulcrum: Prompt injection attempt - '{pattern}'"
+            )
+            report.suspicion_score += 1.0
+            print(f"[X] ORIONAI: PROMPT INJECTION DETECTED - '{pattern}'")
+            return False
 
         # Check data exfiltration patterns
-        for pattern in self.config.fulcrum.get("dataExfiltrationPatterns", []):
-            if pattern.lower() in lower_decision:
-                report.result = ValidationResult.REJECTED
-                report.triggered_rules.append(
-                    f"Fulcrum: Data exfiltration attempt - '{pattern}'"
-                )
-                report.suspicion_score += 1.0
-                print(f"[X] ORIONAI: DATA EXFILTRATION DETECTED - '{pattern}'")
-                return False
+        if matches[DATA_EXFILTRATION] >= 0:
+            pattern = self.patterns.pattern(
+                DATA_EXFILTRATION, matches[DATA_EXFILTRATION]
+            )
+            report.result = ValidationResult.REJECTED
+            report.triggered_rules.append(
+                f"Fulcrum: Data exfiltration attempt - '{pattern}'"
+            )
+            report.suspicion_score += 1.0
+            print(f"[X] ORIONAI: DATA EXFILTRATION DETECTED - '{pattern}'")
+            return False
 
         return True
 
-    def _sanitize_with_charles_carmichael(self, text: str) -> str:
+    def _sanitize_with_charles_carmichael(
+        self, text: str, sanitized: Optional[str] = None
+    ) -> str:
         """Charles Carmichael - PII sanitization"""
         if not self.config.charles.get("enabled"):
             return text
 
-        sanitized = text
-        rules = self.config.charles.get("sanitizationRules", {})
-
-        # Email sanitization
-        if "emails" in rules:
-            email_pattern = r"\b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b"
-            sanitized = re.sub(email_pattern, rules["emails"], sanitized)
-
-        # SSN sanitization
-        if "ssn" in rules:
-            ssn_pattern = r"\b\d{3}-\d{2}-\d{4}\b"
-            sanitized = re.sub(ssn_pattern, rules["ssn"], sanitized)
-
-        # Credit card sanitization
-        if "creditCards" in rules:
-            cc_pattern = r"\b\d{4}[\s-]?\d{4}[\s-]?\d{4}[\s-]?\d{4}\b"
-            sanitized = re.sub(cc_pattern, rules["creditCards"], sanitized)
-
-        # Phone number sanitization
-        if "phoneNumbers" in rules:
-            phone_pattern = r"\b\d{3}[-.]?\d{3}[-.]?\d{4}\b"
-            sanitized = re.sub(phone_pattern, rules["phoneNumbers"], sanitized)
-
-        # IP address sanitization
-        if "ipAddresses" in rules:
-            ip_pattern = r"\b\d{1,3}\.\d{1,3}\.\d{1,3}\.\d{1,3}\b"
-            sanitized = re.sub(ip_pattern, rules["ipAddresses"], sanitized)
+        if sanitized is None:
+            sanitized = self.sanitizer.sanitize(text)
 
         if sanitized != text:
             print("[+] ORIONAI: Charles Carmichael sanitization applied")
@@ -583,5 +862,8 @@ __all__ = [
     "ValidationResult",
     "ValidationReport",
     "CaseyProtocol",
+    "PatternScanner",
+    "PiiSanitizer",
+    "native_core_available",
     "validate_ai_output",
 ]
@@ -1,8 +1,38 @@
+import glob
+import os
+
 from setuptools import setup, find_packages
 
+try:
+    from pybind11.setup_helpers import Pybind11Extension, build_ext
+except ImportError:
+    Pybind11Extension = None
+
 with open("README.md", "r", encoding="utf-8") as fh:
     long_description = fh.read()
 
+# The plugin's engine-independent core (Source/OrionCore), built into the _orionai_core
+# extension. Optional: without a compiler or pybind11, orionai falls back to pure Python.
+CORE_DIR = os.path.join("..", "Source", "OrionCore")
+ext_modules = []
+cmdclass = {}
+if Pybind11Extension is not None and os.path.isdir(CORE_DIR):
+    core_sources = sorted(
+        path
+        for path in glob.glob(os.path.join(CORE_DIR, "Private", "OrionCore*.cpp"))
+        if not path.endswith("OrionCoreModule.cpp")  # Unreal module boilerplate
+    )
+    ext_modules.append(
+        Pybind11Extension(
+            "_orionai_core",
+            [os.path.join("native", "orionai_core.cpp")] + core_sources,
+            include_dirs=[os.path.join(CORE_DIR, "Public")],
+            cxx_std=17,
+            optional=True,
+        )
+    )
+    cmdclass["build_ext"] = build_ext
+
 setup(
     name="orionai",
     version="1.0.0",
@@ -13,6 +43,8 @@ setup(
     long_description_content_type="text/markdown",
     url="https://github.com/calionestevar/OrionAI",
     py_modules=["orionai"],
+    ext_modules=ext_modules,
+    cmdclass=cmdclass,
     install_requires=[
         "requests>=2.28.0",
         "python-dateutil>=2.8.0",
@@ -189,10 +189,10 @@ def test_metrics():
 
     orion = OrionAI("../Config/CaseyProtocol.json")
 
-    # Run several validations
+    # Run several validations - bias last, since it trips safe mode
     orion.monitor_ai_decision("Test", "Hello!", "")
-    orion.monitor_ai_decision("Test", "Women can't code", "")
     orion.monitor_ai_decision("Test", "How are you?", "")
+    orion.monitor_ai_decision("Test", "Women can't code", "")
 
     metrics = orion.get_validation_metrics()
 
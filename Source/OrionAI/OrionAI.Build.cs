@@ -29,14 +29,16 @@ public class OrionAI : ModuleRules
                 "Engine",
                 "Json",
                 "JsonUtilities",
-                "Http"  // For Nerd Herd API integrations
+                "Http",         // For Nerd Herd API integrations
+                "HTTPServer",   // OpenMetrics endpoint
+                "OrionCore"     // Pattern matcher, prefilters and PII rules
             }
         );
         
         PrivateDependencyModuleNames.AddRange(
             new string[]
             {
-                // Add private dependencies here
+                "NNE"   // Ring Intel inference
             }
         );
         
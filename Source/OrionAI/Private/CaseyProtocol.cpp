@@ -1,214 +1,1046 @@
 #include "CaseyProtocol.h"
+#include "OrionPatternMatcher.h"
+#include "CharlesCarmichael.h"
+#include "CaseyProtocolBlob.h"
+#include "OrionAI.h"
+#include "OrionInstrumentation.h"
+#include "OrionMorganMode.h"
 #include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
+#include <atomic>
 
 UCaseyProtocol* UCaseyProtocol::Instance = nullptr;
 
-UCaseyProtocol* UCaseyProtocol::Get()
+namespace CaseyProtocol
 {
-    return Instance;
-}
+    // Reader counts, sharded per thread and split by epoch parity. A publish flips the
+    // epoch and waits for the old parity to drain before freeing the old snapshot.
+    static constexpr int32 NumReaderShards = 32;
 
-UCaseyProtocol* UCaseyProtocol::LoadFromFile(const FString& ConfigPath)
-{
-    UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Loading Casey Protocol from %s"), *ConfigPath);
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FReaderShard
+    {
+        std::atomic<int64> Readers[2];
+    };
 
-    FString JsonString;
-    if (!FFileHelper::LoadFileToString(JsonString, *ConfigPath))
+    static FReaderShard ReaderShards[NumReaderShards];
+    static std::atomic<uint64> ReadEpoch{ 0 };
+    static std::atomic<const FCaseyProtocolSnapshot*> CurrentSnapshot{ nullptr };
+
+    // Publishers only - readers never touch them. CurrentOwner holds the published
+    // snapshot's reference, so scopes that saw it can Pin() it until it is replaced.
+    static FCriticalSection PublishLock;
+    static int64 LastVersion = 0;
+    static TSharedPtr<const FCaseyProtocolSnapshot, ESPMode::ThreadSafe> CurrentOwner;
+
+    static std::atomic<bool> bReloadInFlight{ false };
+    static FTSTicker::FDelegateHandle WatchHandle;
+
+    static int32 GetReaderShard()
     {
-        UE_LOG(LogTemp, Error, TEXT("AI-CASTLE: Failed to load config file. Using defaults."));
-        Instance = NewObject<UCaseyProtocol>();
-        return Instance;
+        static std::atomic<int32> NextShard{ 0 };
+        thread_local int32 Shard = NextShard.fetch_add(1, std::memory_order_relaxed) % NumReaderShards;
+        return Shard;
     }
 
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    static void WaitForReaders(uint32 Parity)
+    {
+        for (;;)
+        {
+            int64 Readers = 0;
+            for (const FReaderShard& ReaderShard : ReaderShards)
+            {
+                Readers += ReaderShard.Readers[Parity].load(std::memory_order_seq_cst);
+            }
+
+            if (Readers == 0)
+            {
+                return;
+            }
+            FPlatformProcess::YieldThread();
+        }
+    }
 
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    /** Default snapshot for validations that run before any config has been loaded */
+    static void EnsureSnapshot()
     {
-        UE_LOG(LogTemp, Error, TEXT("AI-CASTLE: Failed to parse JSON config. Using defaults."));
-        Instance = NewObject<UCaseyProtocol>();
-        return Instance;
+        FScopeLock Lock(&PublishLock);
+        if (!CurrentSnapshot.load(std::memory_order_acquire))
+        {
+            FCaseyProtocolSnapshot* Snapshot = new FCaseyProtocolSnapshot();
+            Snapshot->CompileRules();
+            Snapshot->Version = ++LastVersion;
+            CurrentOwner = TSharedPtr<const FCaseyProtocolSnapshot, ESPMode::ThreadSafe>(Snapshot);
+            CurrentSnapshot.store(Snapshot, std::memory_order_seq_cst);
+        }
+    }
+
+    static EOrionShedPolicy ParseShedPolicy(const FString& Value)
+    {
+        if (Value.Equals(TEXT("fulcrumOnly"), ESearchCase::IgnoreCase))
+        {
+            return EOrionShedPolicy::FulcrumOnly;
+        }
+        if (Value.Equals(TEXT("failClosed"), ESearchCase::IgnoreCase))
+        {
+            return EOrionShedPolicy::FailClosed;
+        }
+        return EOrionShedPolicy::SkipRingIntel;
     }
 
-    // Create instance and populate
-    Instance = NewObject<UCaseyProtocol>();
+    static EOrionAdmissionPriority ParseAdmissionPriority(const FString& Value)
+    {
+        if (Value.Equals(TEXT("low"), ESearchCase::IgnoreCase))
+        {
+            return EOrionAdmissionPriority::Low;
+        }
+        if (Value.Equals(TEXT("high"), ESearchCase::IgnoreCase))
+        {
+            return EOrionAdmissionPriority::High;
+        }
+        if (Value.Equals(TEXT("critical"), ESearchCase::IgnoreCase))
+        {
+            return EOrionAdmissionPriority::Critical;
+        }
+        return EOrionAdmissionPriority::Normal;
+    }
+
+    static const TCHAR* LexToString(EOrionShedPolicy Policy)
+    {
+        switch (Policy)
+        {
+        case EOrionShedPolicy::FulcrumOnly:     return TEXT("fulcrumOnly");
+        case EOrionShedPolicy::FailClosed:      return TEXT("failClosed");
+        default:                                return TEXT("skipRingIntel");
+        }
+    }
 
-    // Load Intersect Scanner config
-    if (JsonObject->HasField(TEXT("intersectScanner")))
+    /** Populate a snapshot from Casey Protocol JSON; fields missing from the file keep their defaults */
+    static bool ParseSnapshot(const FString& JsonString, FCaseyProtocolSnapshot& Out)
     {
-        TSharedPtr<FJsonObject> ScannerObj = JsonObject->GetObjectField(TEXT("intersectScanner"));
-        Instance->IntersectScanner.bEnabled = ScannerObj->GetBoolField(TEXT("enabled"));
+        TSharedPtr<FJsonObject> JsonObject;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
 
-        // Load hallucination patterns
-        const TArray<TSharedPtr<FJsonValue>>* HallucinationArray;
-        if (ScannerObj->TryGetArrayField(TEXT("hallucinationPatterns"), HallucinationArray))
+        if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
         {
-            for (const TSharedPtr<FJsonValue>& Value : *HallucinationArray)
+            return false;
+        }
+
+
+        // Load Intersect Scanner config
+        if (JsonObject->HasField(TEXT("intersectScanner")))
+        {
+            TSharedPtr<FJsonObject> ScannerObj = JsonObject->GetObjectField(TEXT("intersectScanner"));
+            Out.IntersectScanner.bEnabled = ScannerObj->GetBoolField(TEXT("enabled"));
+
+            FString CaseFolding;
+            if (ScannerObj->TryGetStringField(TEXT("caseFolding"), CaseFolding))
+            {
+                Out.IntersectScanner.CaseFolding = CaseFolding.Equals(TEXT("unicode"), ESearchCase::IgnoreCase)
+                    ? EOrionCaseFolding::Unicode
+                    : EOrionCaseFolding::Ascii;
+            }
+
+            ScannerObj->TryGetBoolField(TEXT("normalizeText"), Out.IntersectScanner.bNormalizeText);
+
+            int32 MaxEditDistance;
+            if (ScannerObj->TryGetNumberField(TEXT("maxEditDistance"), MaxEditDistance))
+            {
+                Out.IntersectScanner.MaxEditDistance = FMath::Clamp(MaxEditDistance, 0, FOrionPatternMatcher::MaxFuzzyEditDistance);
+            }
+
+            int32 MinFuzzyPatternLength;
+            if (ScannerObj->TryGetNumberField(TEXT("minFuzzyPatternLength"), MinFuzzyPatternLength))
+            {
+                Out.IntersectScanner.MinFuzzyPatternLength = FMath::Max(MinFuzzyPatternLength, 1);
+            }
+
+            // Load hallucination patterns
+            const TArray<TSharedPtr<FJsonValue>>* HallucinationArray;
+            if (ScannerObj->TryGetArrayField(TEXT("hallucinationPatterns"), HallucinationArray))
+            {
+                Out.IntersectScanner.HallucinationPatterns.Reset();
+                for (const TSharedPtr<FJsonValue>& Value : *HallucinationArray)
+                {
+                    Out.IntersectScanner.HallucinationPatterns.Add(Value->AsString());
+                }
+            }
+
+            // Load bias keywords
+            const TArray<TSharedPtr<FJsonValue>>* BiasArray;
+            if (ScannerObj->TryGetArrayField(TEXT("biasKeywords"), BiasArray))
             {
-                Instance->IntersectScanner.HallucinationPatterns.Add(Value->AsString());
+                Out.IntersectScanner.BiasKeywords.Reset();
+                for (const TSharedPtr<FJsonValue>& Value : *BiasArray)
+                {
+                    Out.IntersectScanner.BiasKeywords.Add(Value->AsString());
+                }
+            }
+
+            // Load toxicity patterns
+            const TArray<TSharedPtr<FJsonValue>>* ToxicityArray;
+            if (ScannerObj->TryGetArrayField(TEXT("toxicityPatterns"), ToxicityArray))
+            {
+                Out.IntersectScanner.ToxicityPatterns.Reset();
+                for (const TSharedPtr<FJsonValue>& Value : *ToxicityArray)
+                {
+                    Out.IntersectScanner.ToxicityPatterns.Add(Value->AsString());
+                }
+            }
+
+            // Load PII patterns
+            const TArray<TSharedPtr<FJsonValue>>* PIIArray;
+            if (ScannerObj->TryGetArrayField(TEXT("piiPatterns"), PIIArray))
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *PIIArray)
+                {
+                    Out.IntersectScanner.PIIPatterns.Add(Value->AsString());
+                }
             }
         }
 
-        // Load bias keywords
-        const TArray<TSharedPtr<FJsonValue>>* BiasArray;
-        if (ScannerObj->TryGetArrayField(TEXT("biasKeywords"), BiasArray))
+        // Load Fulcrum Filter config
+        if (JsonObject->HasField(TEXT("fulcrumFilter")))
         {
-            for (const TSharedPtr<FJsonValue>& Value : *BiasArray)
+            TSharedPtr<FJsonObject> FulcrumObj = JsonObject->GetObjectField(TEXT("fulcrumFilter"));
+            Out.FulcrumFilter.bEnabled = FulcrumObj->GetBoolField(TEXT("enabled"));
+
+            // Load prompt injection patterns
+            const TArray<TSharedPtr<FJsonValue>>* InjectionArray;
+            if (FulcrumObj->TryGetArrayField(TEXT("promptInjectionPatterns"), InjectionArray))
+            {
+                Out.FulcrumFilter.PromptInjectionPatterns.Reset();
+                for (const TSharedPtr<FJsonValue>& Value : *InjectionArray)
+                {
+                    Out.FulcrumFilter.PromptInjectionPatterns.Add(Value->AsString());
+                }
+            }
+
+            // Load data exfiltration patterns
+            const TArray<TSharedPtr<FJsonValue>>* ExfiltrationArray;
+            if (FulcrumObj->TryGetArrayField(TEXT("dataExfiltrationPatterns"), ExfiltrationArray))
             {
-                Instance->IntersectScanner.BiasKeywords.Add(Value->AsString());
+                Out.FulcrumFilter.DataExfiltrationPatterns.Reset();
+                for (const TSharedPtr<FJsonValue>& Value : *ExfiltrationArray)
+                {
+                    Out.FulcrumFilter.DataExfiltrationPatterns.Add(Value->AsString());
+                }
             }
         }
 
-        // Load toxicity patterns
-        const TArray<TSharedPtr<FJsonValue>>* ToxicityArray;
-        if (ScannerObj->TryGetArrayField(TEXT("toxicityPatterns"), ToxicityArray))
+        // Load Charles Carmichael config
+        if (JsonObject->HasField(TEXT("charlesCarmichael")))
         {
-            for (const TSharedPtr<FJsonValue>& Value : *ToxicityArray)
+            TSharedPtr<FJsonObject> CharlesObj = JsonObject->GetObjectField(TEXT("charlesCarmichael"));
+            Out.CharlesCarmichael.bEnabled = CharlesObj->GetBoolField(TEXT("enabled"));
+
+            if (CharlesObj->HasField(TEXT("sanitizationRules")))
             {
-                Instance->IntersectScanner.ToxicityPatterns.Add(Value->AsString());
+                TSharedPtr<FJsonObject> RulesObj = CharlesObj->GetObjectField(TEXT("sanitizationRules"));
+                Out.CharlesCarmichael.SanitizationRules.Reset();
+                for (const auto& Pair : RulesObj->Values)
+                {
+                    Out.CharlesCarmichael.SanitizationRules.Add(Pair.Key, Pair.Value->AsString());
+                }
             }
         }
 
-        // Load PII patterns
-        const TArray<TSharedPtr<FJsonValue>>* PIIArray;
-        if (ScannerObj->TryGetArrayField(TEXT("piiPatterns"), PIIArray))
+        // Load Stay In The Car config
+        if (JsonObject->HasField(TEXT("stayInTheCar")))
         {
-            for (const TSharedPtr<FJsonValue>& Value : *PIIArray)
+            TSharedPtr<FJsonObject> StayObj = JsonObject->GetObjectField(TEXT("stayInTheCar"));
+            Out.StayInTheCar.bEnabled = StayObj->GetBoolField(TEXT("enabled"));
+
+            if (StayObj->HasField(TEXT("quarantineThresholds")))
+            {
+                TSharedPtr<FJsonObject> ThresholdsObj = StayObj->GetObjectField(TEXT("quarantineThresholds"));
+                Out.StayInTheCar.SuspicionThreshold = ThresholdsObj->GetNumberField(TEXT("suspicionScore"));
+                Out.StayInTheCar.bAutoQuarantineOnBias = ThresholdsObj->GetBoolField(TEXT("autoQuarantineOnBias"));
+                Out.StayInTheCar.bAutoQuarantineOnPII = ThresholdsObj->GetBoolField(TEXT("autoQuarantineOnPII"));
+                Out.StayInTheCar.bAutoQuarantineOnToxicity = ThresholdsObj->GetBoolField(TEXT("autoQuarantineOnToxicity"));
+            }
+
+            if (StayObj->HasField(TEXT("storage")))
             {
-                Instance->IntersectScanner.PIIPatterns.Add(Value->AsString());
+                TSharedPtr<FJsonObject> StorageObj = StayObj->GetObjectField(TEXT("storage"));
+                StorageObj->TryGetNumberField(TEXT("maxReports"), Out.StayInTheCar.MaxStoredReports);
+                StorageObj->TryGetNumberField(TEXT("arenaKB"), Out.StayInTheCar.ArenaKB);
+                StorageObj->TryGetStringField(TEXT("spillFile"), Out.StayInTheCar.SpillFilePath);
             }
         }
-    }
 
-    // Load Fulcrum Filter config
-    if (JsonObject->HasField(TEXT("fulcrumFilter")))
-    {
-        TSharedPtr<FJsonObject> FulcrumObj = JsonObject->GetObjectField(TEXT("fulcrumFilter"));
-        Instance->FulcrumFilter.bEnabled = FulcrumObj->GetBoolField(TEXT("enabled"));
+        // Load Nerd Herd config
+        if (JsonObject->HasField(TEXT("nerdHerd")))
+        {
+            TSharedPtr<FJsonObject> NerdHerdObj = JsonObject->GetObjectField(TEXT("nerdHerd"));
+            Out.NerdHerd.bEnabled = NerdHerdObj->GetBoolField(TEXT("enabled"));
+
+            if (NerdHerdObj->HasField(TEXT("integrations")))
+            {
+                TSharedPtr<FJsonObject> IntegrationsObj = NerdHerdObj->GetObjectField(TEXT("integrations"));
+            
+                if (IntegrationsObj->HasField(TEXT("jira")))
+                {
+                    TSharedPtr<FJsonObject> JiraObj = IntegrationsObj->GetObjectField(TEXT("jira"));
+                    Out.NerdHerd.bJiraEnabled = JiraObj->GetBoolField(TEXT("enabled"));
+                    JiraObj->TryGetStringField(TEXT("url"), Out.NerdHerd.JiraUrl);
+                    JiraObj->TryGetStringField(TEXT("project"), Out.NerdHerd.JiraProject);
+                    JiraObj->TryGetStringField(TEXT("apiToken"), Out.NerdHerd.JiraApiToken);
+                }
+                if (IntegrationsObj->HasField(TEXT("github")))
+                {
+                    TSharedPtr<FJsonObject> GitHubObj = IntegrationsObj->GetObjectField(TEXT("github"));
+                    Out.NerdHerd.bGitHubEnabled = GitHubObj->GetBoolField(TEXT("enabled"));
+                    GitHubObj->TryGetStringField(TEXT("repo"), Out.NerdHerd.GitHubRepo);
+                    GitHubObj->TryGetStringField(TEXT("label"), Out.NerdHerd.GitHubLabel);
+                    GitHubObj->TryGetStringField(TEXT("apiToken"), Out.NerdHerd.GitHubApiToken);
+                }
+                if (IntegrationsObj->HasField(TEXT("slack")))
+                {
+                    TSharedPtr<FJsonObject> SlackObj = IntegrationsObj->GetObjectField(TEXT("slack"));
+                    Out.NerdHerd.bSlackEnabled = SlackObj->GetBoolField(TEXT("enabled"));
+                    SlackObj->TryGetStringField(TEXT("webhookUrl"), Out.NerdHerd.SlackWebhookUrl);
+                    SlackObj->TryGetStringField(TEXT("channel"), Out.NerdHerd.SlackChannel);
+                }
+            }
+
+            if (NerdHerdObj->HasField(TEXT("dispatch")))
+            {
+                TSharedPtr<FJsonObject> DispatchObj = NerdHerdObj->GetObjectField(TEXT("dispatch"));
+                DispatchObj->TryGetNumberField(TEXT("maxQueuedAlerts"), Out.NerdHerd.MaxQueuedAlerts);
+                DispatchObj->TryGetNumberField(TEXT("coalesceWindowSeconds"), Out.NerdHerd.CoalesceWindowSeconds);
+                DispatchObj->TryGetNumberField(TEXT("batchDelayMs"), Out.NerdHerd.BatchDelayMs);
+                DispatchObj->TryGetNumberField(TEXT("maxAlertsPerBatch"), Out.NerdHerd.MaxAlertsPerBatch);
+                DispatchObj->TryGetNumberField(TEXT("maxRetries"), Out.NerdHerd.MaxRetries);
+                DispatchObj->TryGetNumberField(TEXT("retryBackoffMs"), Out.NerdHerd.RetryBackoffMs);
+                DispatchObj->TryGetNumberField(TEXT("maxRetryBackoffMs"), Out.NerdHerd.MaxRetryBackoffMs);
+                DispatchObj->TryGetNumberField(TEXT("requestTimeoutSeconds"), Out.NerdHerd.RequestTimeoutSeconds);
+                DispatchObj->TryGetNumberField(TEXT("maxPendingPosts"), Out.NerdHerd.MaxPendingPosts);
+            }
 
-        // Load prompt injection patterns
-        const TArray<TSharedPtr<FJsonValue>>* InjectionArray;
-        if (FulcrumObj->TryGetArrayField(TEXT("promptInjectionPatterns"), InjectionArray))
+            if (NerdHerdObj->HasField(TEXT("localLogging")))
+            {
+                TSharedPtr<FJsonObject> LoggingObj = NerdHerdObj->GetObjectField(TEXT("localLogging"));
+                Out.NerdHerd.bLocalLogging = LoggingObj->GetBoolField(TEXT("enabled"));
+                Out.NerdHerd.LogFilePath = LoggingObj->GetStringField(TEXT("filePath"));
+            }
+        }
+
+        // Load log sink config
+        if (JsonObject->HasField(TEXT("logSink")))
         {
-            for (const TSharedPtr<FJsonValue>& Value : *InjectionArray)
+            TSharedPtr<FJsonObject> SinkObj = JsonObject->GetObjectField(TEXT("logSink"));
+            SinkObj->TryGetNumberField(TEXT("flushIntervalMs"), Out.LogSink.FlushIntervalMs);
+            SinkObj->TryGetNumberField(TEXT("maxQueuedKB"), Out.LogSink.MaxQueuedKB);
+
+            FString FsyncPolicy;
+            if (SinkObj->TryGetStringField(TEXT("fsyncPolicy"), FsyncPolicy))
             {
-                Instance->FulcrumFilter.PromptInjectionPatterns.Add(Value->AsString());
+                Out.LogSink.FsyncPolicy = FsyncPolicy.Equals(TEXT("everyFlush"), ESearchCase::IgnoreCase)
+                    ? EOrionFsyncPolicy::EveryFlush
+                    : EOrionFsyncPolicy::Never;
             }
         }
 
-        // Load data exfiltration patterns
-        const TArray<TSharedPtr<FJsonValue>>* ExfiltrationArray;
-        if (FulcrumObj->TryGetArrayField(TEXT("dataExfiltrationPatterns"), ExfiltrationArray))
+        // Load Buy More Cover config
+        if (JsonObject->HasField(TEXT("buyMoreCover")))
         {
-            for (const TSharedPtr<FJsonValue>& Value : *ExfiltrationArray)
+            TSharedPtr<FJsonObject> BuyMoreObj = JsonObject->GetObjectField(TEXT("buyMoreCover"));
+            Out.BuyMoreCover.bEnabled = BuyMoreObj->GetBoolField(TEXT("enabled"));
+
+            if (BuyMoreObj->HasField(TEXT("triggerConditions")))
             {
-                Instance->FulcrumFilter.DataExfiltrationPatterns.Add(Value->AsString());
+                TSharedPtr<FJsonObject> TriggersObj = BuyMoreObj->GetObjectField(TEXT("triggerConditions"));
+                Out.BuyMoreCover.ConsecutiveFailuresThreshold = TriggersObj->GetIntegerField(TEXT("consecutiveFailures"));
+            }
+
+            if (BuyMoreObj->HasField(TEXT("safeModeActions")))
+            {
+                TSharedPtr<FJsonObject> ActionsObj = BuyMoreObj->GetObjectField(TEXT("safeModeActions"));
+                Out.BuyMoreCover.bDisableGenerativeAI = ActionsObj->GetBoolField(TEXT("disableGenerativeAI"));
+                Out.BuyMoreCover.bRequireManualReactivation = ActionsObj->GetBoolField(TEXT("requireManualReactivation"));
+            }
+
+            if (BuyMoreObj->HasField(TEXT("isolation")))
+            {
+                TSharedPtr<FJsonObject> IsolationObj = BuyMoreObj->GetObjectField(TEXT("isolation"));
+                IsolationObj->TryGetBoolField(TEXT("perSystem"), Out.BuyMoreCover.bPerSystem);
+                IsolationObj->TryGetNumberField(TEXT("globalEscalationSystems"), Out.BuyMoreCover.GlobalEscalationSystems);
             }
         }
-    }
 
-    // Load Charles Carmichael config
-    if (JsonObject->HasField(TEXT("charlesCarmichael")))
-    {
-        TSharedPtr<FJsonObject> CharlesObj = JsonObject->GetObjectField(TEXT("charlesCarmichael"));
-        Instance->CharlesCarmichael.bEnabled = CharlesObj->GetBoolField(TEXT("enabled"));
+        // Load Morgan Mode config
+        if (JsonObject->HasField(TEXT("morganMode")))
+        {
+            TSharedPtr<FJsonObject> MorganObj = JsonObject->GetObjectField(TEXT("morganMode"));
+            Out.MorganMode.bEnabled = MorganObj->GetBoolField(TEXT("enabled"));
+            Out.MorganMode.bLogAllDecisions = MorganObj->GetBoolField(TEXT("logAllDecisions"));
+            Out.MorganMode.bIncludeStackTraces = MorganObj->GetBoolField(TEXT("includeStackTraces"));
+            if (MorganObj->HasField(TEXT("approvalLogSampleRate")))
+            {
+                Out.MorganMode.ApprovalLogSampleRate = FMath::Max(1, (int32)MorganObj->GetNumberField(TEXT("approvalLogSampleRate")));
+            }
+        }
+
+        // Load Ring Intel config
+        if (JsonObject->HasField(TEXT("ringIntel")))
+        {
+            TSharedPtr<FJsonObject> RingObj = JsonObject->GetObjectField(TEXT("ringIntel"));
+            Out.RingIntel.bEnabled = RingObj->GetBoolField(TEXT("enabled"));
+            RingObj->TryGetStringField(TEXT("modelPath"), Out.RingIntel.ModelPath);
+            double ConfidenceThreshold = 0.0;
+            if (RingObj->TryGetNumberField(TEXT("confidenceThreshold"), ConfidenceThreshold))
+            {
+                Out.RingIntel.ConfidenceThreshold = (float)ConfidenceThreshold;
+            }
+            RingObj->TryGetStringField(TEXT("quantizedModelPath"), Out.RingIntel.QuantizedModelPath);
+            RingObj->TryGetStringField(TEXT("vocabPath"), Out.RingIntel.VocabPath);
+            RingObj->TryGetStringField(TEXT("runtime"), Out.RingIntel.Runtime);
+            RingObj->TryGetNumberField(TEXT("maxSequenceLength"), Out.RingIntel.MaxSequenceLength);
+            RingObj->TryGetNumberField(TEXT("maxBatchSize"), Out.RingIntel.MaxBatchSize);
+            double MaxBatchDelayMs = 0.0;
+            if (RingObj->TryGetNumberField(TEXT("maxBatchDelayMs"), MaxBatchDelayMs))
+            {
+                Out.RingIntel.MaxBatchDelayMs = (float)MaxBatchDelayMs;
+            }
+
+            FString Precision;
+            if (RingObj->TryGetStringField(TEXT("precision"), Precision))
+            {
+                Out.RingIntel.Precision = Precision.Equals(TEXT("int8"), ESearchCase::IgnoreCase)
+                    ? EOrionModelPrecision::Int8
+                    : EOrionModelPrecision::Float32;
+            }
+
+            FString Activation;
+            if (RingObj->TryGetStringField(TEXT("activation"), Activation))
+            {
+                Out.RingIntel.Activation = Activation.Equals(TEXT("softmax"), ESearchCase::IgnoreCase)
+                    ? EOrionModelActivation::Softmax
+                    : EOrionModelActivation::Sigmoid;
+            }
+        }
+
+        // Load async validation config
+        if (JsonObject->HasField(TEXT("asyncValidation")))
+        {
+            TSharedPtr<FJsonObject> AsyncObj = JsonObject->GetObjectField(TEXT("asyncValidation"));
+            AsyncObj->TryGetNumberField(TEXT("workerThreads"), Out.AsyncValidation.WorkerThreads);
+        }
+
+        // Load hot reload config
+        if (JsonObject->HasField(TEXT("hotReload")))
+        {
+            TSharedPtr<FJsonObject> ReloadObj = JsonObject->GetObjectField(TEXT("hotReload"));
+            ReloadObj->TryGetBoolField(TEXT("enabled"), Out.HotReload.bEnabled);
+            double PollIntervalSeconds = 0.0;
+            if (ReloadObj->TryGetNumberField(TEXT("pollIntervalSeconds"), PollIntervalSeconds))
+            {
+                Out.HotReload.PollIntervalSeconds = (float)PollIntervalSeconds;
+            }
+        }
+
+        // Load verdict cache config
+        if (JsonObject->HasField(TEXT("verdictCache")))
+        {
+            TSharedPtr<FJsonObject> CacheObj = JsonObject->GetObjectField(TEXT("verdictCache"));
+            CacheObj->TryGetBoolField(TEXT("enabled"), Out.VerdictCache.bEnabled);
+            CacheObj->TryGetNumberField(TEXT("maxMemoryMB"), Out.VerdictCache.MaxMemoryMB);
+        }
 
-        if (CharlesObj->HasField(TEXT("sanitizationRules")))
+        // Load parallel stages config
+        if (JsonObject->HasField(TEXT("parallelStages")))
         {
-            TSharedPtr<FJsonObject> RulesObj = CharlesObj->GetObjectField(TEXT("sanitizationRules"));
-            for (const auto& Pair : RulesObj->Values)
+            TSharedPtr<FJsonObject> StagesObj = JsonObject->GetObjectField(TEXT("parallelStages"));
+            StagesObj->TryGetBoolField(TEXT("enabled"), Out.ParallelStages.bEnabled);
+            StagesObj->TryGetNumberField(TEXT("minDecisionLength"), Out.ParallelStages.MinDecisionLength);
+        }
+
+        // Load instrumentation config
+        if (JsonObject->HasField(TEXT("instrumentation")))
+        {
+            TSharedPtr<FJsonObject> InstrumentationObj = JsonObject->GetObjectField(TEXT("instrumentation"));
+            InstrumentationObj->TryGetBoolField(TEXT("latencyHistograms"), Out.Instrumentation.bLatencyHistograms);
+        }
+
+        // Load metrics exporter config
+        if (JsonObject->HasField(TEXT("metricsExporter")))
+        {
+            TSharedPtr<FJsonObject> ExporterObj = JsonObject->GetObjectField(TEXT("metricsExporter"));
+            ExporterObj->TryGetBoolField(TEXT("enabled"), Out.MetricsExporter.bEnabled);
+            ExporterObj->TryGetNumberField(TEXT("port"), Out.MetricsExporter.Port);
+            ExporterObj->TryGetStringField(TEXT("path"), Out.MetricsExporter.Path);
+        }
+
+        // Load audit log config
+        if (JsonObject->HasField(TEXT("auditLog")))
+        {
+            TSharedPtr<FJsonObject> AuditObj = JsonObject->GetObjectField(TEXT("auditLog"));
+            AuditObj->TryGetBoolField(TEXT("enabled"), Out.AuditLog.bEnabled);
+            AuditObj->TryGetStringField(TEXT("directory"), Out.AuditLog.Directory);
+            AuditObj->TryGetNumberField(TEXT("blockRecords"), Out.AuditLog.BlockRecords);
+            double FlushIntervalSeconds = Out.AuditLog.FlushIntervalSeconds;
+            if (AuditObj->TryGetNumberField(TEXT("flushIntervalSeconds"), FlushIntervalSeconds))
             {
-                Instance->CharlesCarmichael.SanitizationRules.Add(Pair.Key, Pair.Value->AsString());
+                Out.AuditLog.FlushIntervalSeconds = (float)FlushIntervalSeconds;
             }
+            AuditObj->TryGetNumberField(TEXT("segmentMaxMB"), Out.AuditLog.SegmentMaxMB);
         }
+
+        // Load validation profiles
+        if (JsonObject->HasField(TEXT("validationProfiles")))
+        {
+            TSharedPtr<FJsonObject> ProfilesObj = JsonObject->GetObjectField(TEXT("validationProfiles"));
+            const TArray<TSharedPtr<FJsonValue>>* ProfileArray;
+            if (ProfilesObj->TryGetArrayField(TEXT("profiles"), ProfileArray))
+            {
+                for (const TSharedPtr<FJsonValue>& ProfileValue : *ProfileArray)
+                {
+                    const TSharedPtr<FJsonObject>* ProfileObj;
+                    if (!ProfileValue->TryGetObject(ProfileObj))
+                    {
+                        continue;
+                    }
+
+                    FValidationProfileConfig& Profile = Out.ValidationProfiles.Profiles.AddDefaulted_GetRef();
+                    (*ProfileObj)->TryGetStringField(TEXT("name"), Profile.Name);
+                    (*ProfileObj)->TryGetStringArrayField(TEXT("aiSystems"), Profile.AISystems);
+
+                    // An explicit empty list turns the pattern scan off for the profile
+                    TArray<FString> Categories;
+                    if ((*ProfileObj)->TryGetStringArrayField(TEXT("patternCategories"), Categories))
+                    {
+                        Profile.PatternCategories = MoveTemp(Categories);
+                    }
+
+                    (*ProfileObj)->TryGetBoolField(TEXT("ringIntel"), Profile.bRingIntel);
+                    (*ProfileObj)->TryGetBoolField(TEXT("charlesCarmichael"), Profile.bCharlesCarmichael);
+                    (*ProfileObj)->TryGetBoolField(TEXT("stayInTheCar"), Profile.bStayInTheCar);
+                }
+            }
+        }
+
+        // Load admission control config
+        if (JsonObject->HasField(TEXT("admissionControl")))
+        {
+            TSharedPtr<FJsonObject> AdmissionObj = JsonObject->GetObjectField(TEXT("admissionControl"));
+            AdmissionObj->TryGetBoolField(TEXT("enabled"), Out.AdmissionControl.bEnabled);
+            AdmissionObj->TryGetNumberField(TEXT("maxQueueDepth"), Out.AdmissionControl.MaxQueueDepth);
+            AdmissionObj->TryGetNumberField(TEXT("defaultRatePerSecond"), Out.AdmissionControl.DefaultRatePerSecond);
+            AdmissionObj->TryGetNumberField(TEXT("defaultBurst"), Out.AdmissionControl.DefaultBurst);
+
+            FString ShedPolicy;
+            if (AdmissionObj->TryGetStringField(TEXT("shedPolicy"), ShedPolicy))
+            {
+                Out.AdmissionControl.ShedPolicy = CaseyProtocol::ParseShedPolicy(ShedPolicy);
+            }
+
+            FString DefaultPriority;
+            if (AdmissionObj->TryGetStringField(TEXT("defaultPriority"), DefaultPriority))
+            {
+                Out.AdmissionControl.DefaultPriority = CaseyProtocol::ParseAdmissionPriority(DefaultPriority);
+            }
+
+            const TArray<TSharedPtr<FJsonValue>>* SystemArray;
+            if (AdmissionObj->TryGetArrayField(TEXT("systems"), SystemArray))
+            {
+                for (const TSharedPtr<FJsonValue>& SystemValue : *SystemArray)
+                {
+                    const TSharedPtr<FJsonObject>* SystemObj;
+                    if (!SystemValue->TryGetObject(SystemObj))
+                    {
+                        continue;
+                    }
+
+                    FAdmissionSystemConfig& System = Out.AdmissionControl.Systems.AddDefaulted_GetRef();
+                    System.Priority = Out.AdmissionControl.DefaultPriority;
+                    (*SystemObj)->TryGetStringField(TEXT("aiSystem"), System.AISystem);
+                    (*SystemObj)->TryGetNumberField(TEXT("ratePerSecond"), System.RatePerSecond);
+                    (*SystemObj)->TryGetNumberField(TEXT("burst"), System.Burst);
+
+                    FString Priority;
+                    if ((*SystemObj)->TryGetStringField(TEXT("priority"), Priority))
+                    {
+                        System.Priority = CaseyProtocol::ParseAdmissionPriority(Priority);
+                    }
+                }
+            }
+        }
+
+        // Load sidecar config
+        if (JsonObject->HasField(TEXT("sidecar")))
+        {
+            TSharedPtr<FJsonObject> SidecarObj = JsonObject->GetObjectField(TEXT("sidecar"));
+            SidecarObj->TryGetBoolField(TEXT("enabled"), Out.Sidecar.bEnabled);
+            SidecarObj->TryGetStringField(TEXT("regionName"), Out.Sidecar.RegionName);
+            SidecarObj->TryGetNumberField(TEXT("slots"), Out.Sidecar.Slots);
+            SidecarObj->TryGetNumberField(TEXT("maxTextChars"), Out.Sidecar.MaxTextChars);
+            SidecarObj->TryGetNumberField(TEXT("serverThreads"), Out.Sidecar.ServerThreads);
+            SidecarObj->TryGetNumberField(TEXT("requestTimeoutMs"), Out.Sidecar.RequestTimeoutMs);
+        }
+
+        return true;
     }
+}
+
+FCaseyProtocolReadScope::FCaseyProtocolReadScope()
+{
+    using namespace CaseyProtocol;
 
-    // Load Stay In The Car config
-    if (JsonObject->HasField(TEXT("stayInTheCar")))
+    // Taken before counting ourselves in, so a publisher waiting on readers can't block us
+    if (!CurrentSnapshot.load(std::memory_order_acquire))
     {
-        TSharedPtr<FJsonObject> StayObj = JsonObject->GetObjectField(TEXT("stayInTheCar"));
-        Instance->StayInTheCar.bEnabled = StayObj->GetBoolField(TEXT("enabled"));
+        EnsureSnapshot();
+    }
+
+    Shard = GetReaderShard();
 
-        if (StayObj->HasField(TEXT("quarantineThresholds")))
+    // Count in under the current epoch; if a publish flipped it meanwhile, retry under
+    // the new one so the publisher never misses a reader of the snapshot it replaced
+    for (;;)
+    {
+        Epoch = ReadEpoch.load(std::memory_order_seq_cst);
+        ReaderShards[Shard].Readers[Epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+        if (ReadEpoch.load(std::memory_order_seq_cst) == Epoch)
         {
-            TSharedPtr<FJsonObject> ThresholdsObj = StayObj->GetObjectField(TEXT("quarantineThresholds"));
-            Instance->StayInTheCar.SuspicionThreshold = ThresholdsObj->GetNumberField(TEXT("suspicionScore"));
-            Instance->StayInTheCar.bAutoQuarantineOnBias = ThresholdsObj->GetBoolField(TEXT("autoQuarantineOnBias"));
-            Instance->StayInTheCar.bAutoQuarantineOnPII = ThresholdsObj->GetBoolField(TEXT("autoQuarantineOnPII"));
-            Instance->StayInTheCar.bAutoQuarantineOnToxicity = ThresholdsObj->GetBoolField(TEXT("autoQuarantineOnToxicity"));
+            break;
         }
+        ReaderShards[Shard].Readers[Epoch & 1].fetch_sub(1, std::memory_order_release);
     }
 
-    // Load Nerd Herd config
-    if (JsonObject->HasField(TEXT("nerdHerd")))
+    Snapshot = CurrentSnapshot.load(std::memory_order_seq_cst);
+}
+
+FCaseyProtocolReadScope::FCaseyProtocolReadScope(FCaseyProtocolReadScope&& Other)
+    : Snapshot(Other.Snapshot)
+    , Epoch(Other.Epoch)
+    , Shard(Other.Shard)
+{
+    Other.Snapshot = nullptr;
+}
+
+FCaseyProtocolReadScope::~FCaseyProtocolReadScope()
+{
+    if (Snapshot)
+    {
+        CaseyProtocol::ReaderShards[Shard].Readers[Epoch & 1].fetch_sub(1, std::memory_order_release);
+    }
+}
+
+void FCaseyProtocolSnapshot::CompileRules()
+{
+    PatternMatcher = FOrionPatternMatcher::Build(IntersectScanner, FulcrumFilter);
+
+    SanitizationRules = FCharlesCarmichaelRuleSet::Build(CharlesCarmichael);
+
+    UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Compiled %d patterns into %d matcher states, %d sanitization rules"),
+        PatternMatcher->GetNumPatterns(), PatternMatcher->GetNumStates(), SanitizationRules->GetNumRules());
+    if (PatternMatcher->GetNumFuzzyPatterns() > 0)
     {
-        TSharedPtr<FJsonObject> NerdHerdObj = JsonObject->GetObjectField(TEXT("nerdHerd"));
-        Instance->NerdHerd.bEnabled = NerdHerdObj->GetBoolField(TEXT("enabled"));
+        UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: %d patterns also match within %d edits"),
+            PatternMatcher->GetNumFuzzyPatterns(), IntersectScanner.MaxEditDistance);
+    }
 
-        if (NerdHerdObj->HasField(TEXT("integrations")))
+    CompileProfiles();
+    CompileAdmission();
+}
+
+void FCaseyProtocolSnapshot::CompileProfiles()
+{
+    constexpr uint32 AllCategories = (1u << (uint32)EOrionPatternCategory::Count) - 1;
+
+    DefaultProfile.Name = TEXT("default");
+    DefaultProfile.Stages = EOrionProfileStage::All;
+    DefaultProfile.PatternMatcher = PatternMatcher;
+
+    Profiles.Reset();
+    ProfileIndices.Reset();
+
+    for (const FValidationProfileConfig& Config : ValidationProfiles.Profiles)
+    {
+        uint32 CategoryMask = 0;
+        for (const FString& Key : Config.PatternCategories)
         {
-            TSharedPtr<FJsonObject> IntegrationsObj = NerdHerdObj->GetObjectField(TEXT("integrations"));
-            
-            if (IntegrationsObj->HasField(TEXT("jira")))
+            bool bKnown = false;
+            for (int32 Category = 0; Category < (int32)EOrionPatternCategory::Count; ++Category)
             {
-                Instance->NerdHerd.bJiraEnabled = IntegrationsObj->GetObjectField(TEXT("jira"))->GetBoolField(TEXT("enabled"));
+                const EOrionRuleCategory RuleCategory = FOrionRuleId::ForPattern((EOrionPatternCategory)Category, 0).Category;
+                if (Key.Equals(UOrionAI::GetRuleCategoryKey(RuleCategory), ESearchCase::IgnoreCase))
+                {
+                    CategoryMask |= 1u << Category;
+                    bKnown = true;
+                }
             }
-            if (IntegrationsObj->HasField(TEXT("github")))
+
+            if (!bKnown)
             {
-                Instance->NerdHerd.bGitHubEnabled = IntegrationsObj->GetObjectField(TEXT("github"))->GetBoolField(TEXT("enabled"));
+                UE_LOG(LogTemp, Warning, TEXT("AI-CASTLE: Validation profile '%s' names unknown pattern category '%s'"), *Config.Name, *Key);
             }
-            if (IntegrationsObj->HasField(TEXT("slack")))
+        }
+
+        FOrionCompiledProfile& Profile = Profiles.AddDefaulted_GetRef();
+        Profile.Name = Config.Name;
+        Profile.Stages = EOrionProfileStage::None;
+        if (Config.bRingIntel)
+        {
+            Profile.Stages |= EOrionProfileStage::RingIntel;
+        }
+        if (Config.bCharlesCarmichael)
+        {
+            Profile.Stages |= EOrionProfileStage::Sanitize;
+        }
+        if (Config.bStayInTheCar)
+        {
+            Profile.Stages |= EOrionProfileStage::Quarantine;
+        }
+
+        // A profile that keeps every category shares the full matcher rather than a copy of it
+        if (CategoryMask == AllCategories)
+        {
+            Profile.PatternMatcher = PatternMatcher;
+        }
+        else
+        {
+            Profile.PatternMatcher = FOrionPatternMatcher::BuildSubset(*PatternMatcher, CategoryMask);
+        }
+
+        if (Profile.PatternMatcher->GetNumPatterns() > 0)
+        {
+            Profile.Stages |= EOrionProfileStage::PatternScan;
+        }
+
+        const int32 Index = Profiles.Num() - 1;
+        for (const FString& AISystem : Config.AISystems)
+        {
+            if (ProfileIndices.Contains(FName(*AISystem)))
             {
-                Instance->NerdHerd.bSlackEnabled = IntegrationsObj->GetObjectField(TEXT("slack"))->GetBoolField(TEXT("enabled"));
+                UE_LOG(LogTemp, Warning, TEXT("AI-CASTLE: '%s' is in more than one validation profile; '%s' is ignored"), *AISystem, *Config.Name);
+                continue;
             }
+            ProfileIndices.Add(FName(*AISystem), Index);
         }
 
-        if (NerdHerdObj->HasField(TEXT("localLogging")))
+        UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Validation profile '%s': %d AI systems, %d patterns in %d matcher states"),
+            *Profile.Name, Config.AISystems.Num(), Profile.PatternMatcher->GetNumPatterns(), Profile.PatternMatcher->GetNumStates());
+    }
+}
+
+void FCaseyProtocolSnapshot::CompileAdmission()
+{
+    DefaultAdmissionPolicy = FOrionAdmissionPolicy();
+    AdmissionPolicies.Reset();
+    DefaultShedProfile = FOrionCompiledProfile();
+    ShedProfiles.Reset();
+
+    if (!AdmissionControl.bEnabled)
+    {
+        return;
+    }
+
+    const double CyclesPerSecond = 1.0 / FPlatformTime::GetSecondsPerCycle64();
+    const int32 MaxQueueDepth = FMath::Max(AdmissionControl.MaxQueueDepth, 1);
+
+    auto MakePolicy = [CyclesPerSecond, MaxQueueDepth](EOrionAdmissionPriority Priority, float RatePerSecond, float Burst)
+    {
+        // Lower priorities shed while the queue is still shallow, leaving the rest of it to higher ones
+        static const int32 DepthPercent[] = { 50, 75, 100 };
+
+        FOrionAdmissionPolicy Policy;
+        Policy.Priority = Priority;
+        if (Priority != EOrionAdmissionPriority::Critical)
         {
-            TSharedPtr<FJsonObject> LoggingObj = NerdHerdObj->GetObjectField(TEXT("localLogging"));
-            Instance->NerdHerd.bLocalLogging = LoggingObj->GetBoolField(TEXT("enabled"));
-            Instance->NerdHerd.LogFilePath = LoggingObj->GetStringField(TEXT("filePath"));
+            Policy.MaxQueueDepth = FMath::Max(1, (int32)((int64)MaxQueueDepth * DepthPercent[(int32)Priority] / 100));
         }
+
+        if (RatePerSecond > 0.0f)
+        {
+            const double BurstDecisions = FMath::Max(Burst > 0.0f ? Burst : RatePerSecond, 1.0f);
+            Policy.IntervalCycles = FMath::Max<uint64>(1, (uint64)(CyclesPerSecond / RatePerSecond));
+            Policy.BurstCycles = (uint64)(Policy.IntervalCycles * BurstDecisions);
+        }
+        return Policy;
+    };
+
+    DefaultAdmissionPolicy = MakePolicy(AdmissionControl.DefaultPriority, AdmissionControl.DefaultRatePerSecond, AdmissionControl.DefaultBurst);
+    for (const FAdmissionSystemConfig& System : AdmissionControl.Systems)
+    {
+        AdmissionPolicies.Add(FName(*System.AISystem), MakePolicy(System.Priority, System.RatePerSecond, System.Burst));
     }
 
-    // Load Buy More Cover config
-    if (JsonObject->HasField(TEXT("buyMoreCover")))
+    // Fail-closed never evaluates, but keeping the copies lets GetProfile answer for any policy
+    auto MakeShedProfile = [this](const FOrionCompiledProfile& Profile)
     {
-        TSharedPtr<FJsonObject> BuyMoreObj = JsonObject->GetObjectField(TEXT("buyMoreCover"));
-        Instance->BuyMoreCover.bEnabled = BuyMoreObj->GetBoolField(TEXT("enabled"));
+        FOrionCompiledProfile Shed = Profile;
+        Shed.bShed = true;
 
-        if (BuyMoreObj->HasField(TEXT("triggerConditions")))
+        if (AdmissionControl.ShedPolicy == EOrionShedPolicy::SkipRingIntel)
         {
-            TSharedPtr<FJsonObject> TriggersObj = BuyMoreObj->GetObjectField(TEXT("triggerConditions"));
-            Instance->BuyMoreCover.ConsecutiveFailuresThreshold = TriggersObj->GetIntegerField(TEXT("consecutiveFailures"));
+            Shed.Stages &= ~EOrionProfileStage::RingIntel;
         }
-
-        if (BuyMoreObj->HasField(TEXT("safeModeActions")))
+        else if (AdmissionControl.ShedPolicy == EOrionShedPolicy::FulcrumOnly)
         {
-            TSharedPtr<FJsonObject> ActionsObj = BuyMoreObj->GetObjectField(TEXT("safeModeActions"));
-            Instance->BuyMoreCover.bDisableGenerativeAI = ActionsObj->GetBoolField(TEXT("disableGenerativeAI"));
-            Instance->BuyMoreCover.bRequireManualReactivation = ActionsObj->GetBoolField(TEXT("requireManualReactivation"));
+            constexpr uint32 FulcrumCategories = (1u << (uint32)EOrionPatternCategory::PromptInjection) | (1u << (uint32)EOrionPatternCategory::DataExfiltration);
+            Shed.PatternMatcher = FOrionPatternMatcher::BuildSubset(*Profile.PatternMatcher, FulcrumCategories);
+            Shed.Stages = Shed.PatternMatcher->GetNumPatterns() > 0 ? EOrionProfileStage::PatternScan : EOrionProfileStage::None;
         }
+        return Shed;
+    };
+
+    DefaultShedProfile = MakeShedProfile(DefaultProfile);
+    for (const FOrionCompiledProfile& Profile : Profiles)
+    {
+        ShedProfiles.Add(MakeShedProfile(Profile));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Admission control sheds to %s past %d validations in flight, %d AI systems configured"),
+        CaseyProtocol::LexToString(AdmissionControl.ShedPolicy), MaxQueueDepth, AdmissionControl.Systems.Num());
+}
+
+UCaseyProtocol* UCaseyProtocol::Get()
+{
+    return Instance;
+}
+
+void UCaseyProtocol::Publish(TUniquePtr<FCaseyProtocolSnapshot> Snapshot)
+{
+    using namespace CaseyProtocol;
+
+    TSharedPtr<const FCaseyProtocolSnapshot, ESPMode::ThreadSafe> OldOwner;
+    {
+        FScopeLock Lock(&PublishLock);
+
+        Snapshot->Version = ++LastVersion;
+        FOrionInstrumentation::SetLatencyHistogramsEnabled(Snapshot->Instrumentation.bLatencyHistograms);
+        FOrionMorganMode::Configure(Snapshot->MorganMode);
+
+        // Owned before it is visible, so any scope that sees it can Pin() it
+        OldOwner = MoveTemp(CurrentOwner);
+        CurrentOwner = TSharedPtr<const FCaseyProtocolSnapshot, ESPMode::ThreadSafe>(Snapshot.Release());
+        CurrentSnapshot.store(CurrentOwner.Get(), std::memory_order_seq_cst);
+
+        // New readers count under the new parity; wait out everyone under the old one
+        const uint64 OldEpoch = ReadEpoch.fetch_add(1, std::memory_order_seq_cst);
+        WaitForReaders(OldEpoch & 1);
+    }
+
+    // Freed here, or by whichever queued validation that pinned it finishes last
+    OldOwner.Reset();
+
+    if (IsInGameThread())
+    {
+        UpdateMirror();
     }
+    else
+    {
+        AsyncTask(ENamedThreads::GameThread, []() { UpdateMirror(); });
+    }
+}
 
-    // Load Morgan Mode config
-    if (JsonObject->HasField(TEXT("morganMode")))
+void UCaseyProtocol::UpdateMirror()
+{
+    check(IsInGameThread());
+
+    if (!Instance)
     {
-        TSharedPtr<FJsonObject> MorganObj = JsonObject->GetObjectField(TEXT("morganMode"));
-        Instance->MorganMode.bEnabled = MorganObj->GetBoolField(TEXT("enabled"));
-        Instance->MorganMode.bLogAllDecisions = MorganObj->GetBoolField(TEXT("logAllDecisions"));
-        Instance->MorganMode.bIncludeStackTraces = MorganObj->GetBoolField(TEXT("includeStackTraces"));
+        Instance = NewObject<UCaseyProtocol>();
+        Instance->AddToRoot();
     }
 
+    FCaseyProtocolReadScope Protocol;
+    Instance->IntersectScanner = Protocol->IntersectScanner;
+    Instance->FulcrumFilter = Protocol->FulcrumFilter;
+    Instance->CharlesCarmichael = Protocol->CharlesCarmichael;
+    Instance->StayInTheCar = Protocol->StayInTheCar;
+    Instance->NerdHerd = Protocol->NerdHerd;
+    Instance->LogSink = Protocol->LogSink;
+    Instance->BuyMoreCover = Protocol->BuyMoreCover;
+    Instance->MorganMode = Protocol->MorganMode;
+    Instance->RingIntel = Protocol->RingIntel;
+    Instance->AsyncValidation = Protocol->AsyncValidation;
+    Instance->HotReload = Protocol->HotReload;
+    Instance->VerdictCache = Protocol->VerdictCache;
+    Instance->ParallelStages = Protocol->ParallelStages;
+    Instance->Instrumentation = Protocol->Instrumentation;
+    Instance->MetricsExporter = Protocol->MetricsExporter;
+    Instance->AuditLog = Protocol->AuditLog;
+    Instance->ValidationProfiles = Protocol->ValidationProfiles;
+    Instance->AdmissionControl = Protocol->AdmissionControl;
+    Instance->Sidecar = Protocol->Sidecar;
+}
+
+static void LogProtocolSummary(const FCaseyProtocolSnapshot& Snapshot)
+{
     UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Casey Protocol loaded successfully"));
-    UE_LOG(LogTemp, Display, TEXT("  - Intersect Scanner: %s"), Instance->IntersectScanner.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
-    UE_LOG(LogTemp, Display, TEXT("  - Fulcrum Filter: %s"), Instance->FulcrumFilter.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
-    UE_LOG(LogTemp, Display, TEXT("  - Charles Carmichael: %s"), Instance->CharlesCarmichael.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
-    UE_LOG(LogTemp, Display, TEXT("  - Stay In The Car: %s"), Instance->StayInTheCar.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
-    UE_LOG(LogTemp, Display, TEXT("  - Morgan Mode: %s"), Instance->MorganMode.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Intersect Scanner: %s"), Snapshot.IntersectScanner.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Pattern Matching: %s, %d edits"),
+        Snapshot.IntersectScanner.bNormalizeText ? TEXT("NORMALIZED") : TEXT("EXACT"), Snapshot.IntersectScanner.MaxEditDistance);
+    UE_LOG(LogTemp, Display, TEXT("  - Fulcrum Filter: %s"), Snapshot.FulcrumFilter.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Charles Carmichael: %s"), Snapshot.CharlesCarmichael.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Stay In The Car: %s"), Snapshot.StayInTheCar.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Morgan Mode: %s"), Snapshot.MorganMode.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Ring Intel: %s"), Snapshot.RingIntel.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Verdict Cache: %s"), Snapshot.VerdictCache.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Parallel Stages: %s"), Snapshot.ParallelStages.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Latency Histograms: %s"), Snapshot.Instrumentation.bLatencyHistograms ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Metrics Exporter: %s"), Snapshot.MetricsExporter.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Audit Log: %s"), Snapshot.AuditLog.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Validation Profiles: %d"), Snapshot.GetNumProfiles());
+    UE_LOG(LogTemp, Display, TEXT("  - Admission Control: %s"), Snapshot.AdmissionControl.bEnabled ? TEXT("ACTIVE") : TEXT("DISABLED"));
+    UE_LOG(LogTemp, Display, TEXT("  - Sidecar: %s"), Snapshot.Sidecar.bEnabled ? *Snapshot.Sidecar.RegionName : TEXT("DISABLED"));
+}
+
+/**
+ * Read a Casey Protocol file into a compiled snapshot
+ * Maps the precompiled blob when it was built from exactly these JSON bytes; parses
+ * and compiles the JSON otherwise.
+ */
+static bool LoadSnapshot(const FString& ConfigPath, TUniquePtr<FCaseyProtocolSnapshot>& OutSnapshot, bool& bOutReadError)
+{
+    TArray<uint8> JsonBytes;
+    bOutReadError = !FFileHelper::LoadFileToArray(JsonBytes, *ConfigPath);
+    if (bOutReadError)
+    {
+        return false;
+    }
+
+    OutSnapshot = FCaseyProtocolBlob::Load(FCaseyProtocolBlob::GetBlobPath(ConfigPath), FCaseyProtocolBlob::HashSource(JsonBytes));
+    if (OutSnapshot)
+    {
+        return true;
+    }
+
+    FString JsonString;
+    FFileHelper::BufferToString(JsonString, JsonBytes.GetData(), JsonBytes.Num());
+
+    OutSnapshot = MakeUnique<FCaseyProtocolSnapshot>();
+    if (!CaseyProtocol::ParseSnapshot(JsonString, *OutSnapshot))
+    {
+        OutSnapshot.Reset();
+        return false;
+    }
+
+    OutSnapshot->CompileRules();
+    return true;
+}
+
+UCaseyProtocol* UCaseyProtocol::LoadFromFile(const FString& ConfigPath)
+{
+    UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Loading Casey Protocol from %s"), *ConfigPath);
+
+    TUniquePtr<FCaseyProtocolSnapshot> Snapshot;
+    bool bReadError = false;
+    if (LoadSnapshot(ConfigPath, Snapshot, bReadError))
+    {
+        LogProtocolSummary(*Snapshot);
+    }
+    else
+    {
+        if (bReadError)
+        {
+            UE_LOG(LogTemp, Error, TEXT("AI-CASTLE: Failed to load config file. Using defaults."));
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("AI-CASTLE: Failed to parse JSON config. Using defaults."));
+        }
+
+        Snapshot = MakeUnique<FCaseyProtocolSnapshot>();
+        Snapshot->CompileRules();
+    }
+
+    Publish(MoveTemp(Snapshot));
 
     return Instance;
 }
+
+bool UCaseyProtocol::ReloadFromFile(const FString& ConfigPath)
+{
+    UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Reloading Casey Protocol from %s"), *ConfigPath);
+
+    TUniquePtr<FCaseyProtocolSnapshot> Snapshot;
+    bool bReadError = false;
+    if (!LoadSnapshot(ConfigPath, Snapshot, bReadError))
+    {
+        // Unlike the first load, never fall back to defaults - keep enforcing the last good config
+        UE_LOG(LogTemp, Error, TEXT("AI-CASTLE: Reload failed - keeping current Casey Protocol"));
+        return false;
+    }
+
+    Publish(MoveTemp(Snapshot));
+
+    FCaseyProtocolReadScope Protocol;
+    UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Casey Protocol reloaded (version %lld)"), Protocol->Version);
+    return true;
+}
+
+bool UCaseyProtocol::CompileToBlob(const FString& ConfigPath, const FString& BlobPath)
+{
+    UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Compiling Casey Protocol %s -> %s"), *ConfigPath, *BlobPath);
+
+    TArray<uint8> JsonBytes;
+    if (!FFileHelper::LoadFileToArray(JsonBytes, *ConfigPath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AI-CASTLE: Failed to load config file."));
+        return false;
+    }
+
+    FString JsonString;
+    FFileHelper::BufferToString(JsonString, JsonBytes.GetData(), JsonBytes.Num());
+
+    FCaseyProtocolSnapshot Snapshot;
+    if (!CaseyProtocol::ParseSnapshot(JsonString, Snapshot))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AI-CASTLE: Failed to parse JSON config."));
+        return false;
+    }
+
+    Snapshot.CompileRules();
+    return FCaseyProtocolBlob::Write(Snapshot, FCaseyProtocolBlob::HashSource(JsonBytes), BlobPath);
+}
+
+void UCaseyProtocol::ReloadFromFileAsync(const FString& ConfigPath)
+{
+    if (CaseyProtocol::bReloadInFlight.exchange(true))
+    {
+        return;
+    }
+
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ConfigPath]()
+    {
+        ReloadFromFile(ConfigPath);
+        CaseyProtocol::bReloadInFlight = false;
+    });
+}
+
+void UCaseyProtocol::StartWatching(const FString& ConfigPath, float PollIntervalSeconds)
+{
+    StopWatching();
+
+    FDateTime LastTimeStamp = IFileManager::Get().GetTimeStamp(*ConfigPath);
+    CaseyProtocol::WatchHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [ConfigPath, LastTimeStamp](float) mutable
+        {
+            const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*ConfigPath);
+            if (TimeStamp != FDateTime::MinValue() && TimeStamp != LastTimeStamp)
+            {
+                LastTimeStamp = TimeStamp;
+                ReloadFromFileAsync(ConfigPath);
+            }
+            return true;
+        }), FMath::Max(0.1f, PollIntervalSeconds));
+
+    UE_LOG(LogTemp, Display, TEXT("AI-CASTLE: Watching %s for changes"), *ConfigPath);
+}
+
+void UCaseyProtocol::StopWatching()
+{
+    if (CaseyProtocol::WatchHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(CaseyProtocol::WatchHandle);
+        CaseyProtocol::WatchHandle.Reset();
+    }
+}
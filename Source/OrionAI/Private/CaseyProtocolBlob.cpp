@@ -0,0 +1,413 @@
+// OrionAI - Precompiled Casey Protocol
+// Versioned, memory-mappable snapshot of CaseyProtocol.json
+
+#include "CaseyProtocolBlob.h"
+#include "CaseyProtocol.h"
+#include "OrionPatternMatcher.h"
+#include "CharlesCarmichael.h"
+#include "OrionAI.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+namespace CaseyProtocolBlob
+{
+	enum class ESection : uint32
+	{
+		Config,
+		AsciiClasses,
+		FoldedAsciiClasses,
+		WideChars,
+		WideCharClasses,
+		Transitions,
+		OutputOffsets,
+		OutputPatterns,
+		DictionaryLinks,
+		PatternCategories,
+		PatternCategoryIndices,
+		PatternTextOffsets,
+		PatternText,
+		CategoryOffsets,
+		CategoryPatterns,
+		SeedPatterns,
+		SeedEnds,
+		FuzzyOffsets,
+		FuzzyClasses,
+
+		Count
+	};
+
+	// Element size of each section, in ESection order
+	static const uint32 SectionElementSizes[(int32)ESection::Count] =
+	{
+		sizeof(uint8),
+		sizeof(uint16),
+		sizeof(uint16),
+		sizeof(TCHAR),
+		sizeof(int32),
+		sizeof(int32),
+		sizeof(int32),
+		sizeof(int32),
+		sizeof(int32),
+		sizeof(uint8),
+		sizeof(int32),
+		sizeof(int32),
+		sizeof(TCHAR),
+		sizeof(int32),
+		sizeof(int32),
+		sizeof(int32),
+		sizeof(int32),
+		sizeof(int32),
+		sizeof(uint16),
+	};
+
+	// Every section starts on this boundary, so mapped tables are naturally aligned
+	static constexpr uint64 SectionAlignment = 16;
+
+	struct FSectionEntry
+	{
+		uint64 Offset;
+		uint64 Size;
+	};
+
+	// Fixed-size, native-endian header. A blob from a platform with different
+	// endianness or TCHAR width fails the Magic/CharSize checks.
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 FormatVersion;
+		uint32 CharSize;
+		uint32 HeaderSize;
+		uint64 TotalSize;
+		uint8 SourceHash[20];
+		uint32 PayloadCrc;          // Everything after the header
+		int32 NumClasses;
+		int32 NumStates;
+		uint32 bUnicodeFolding;
+		uint32 bNormalized;
+		int32 MaxEditDistance;
+		int32 MinFuzzyLength;
+		int32 SkipClass;
+		int32 SpaceClass;
+		uint32 ConfigSchemaHash;
+		FSectionEntry Sections[(int32)ESection::Count];
+	};
+
+	/**
+	 * Binary form of every module config, in both directions
+	 * Pattern lists are not included - their text lives in the matcher tables.
+	 */
+	static void SerializeConfigs(FArchive& Ar, FCaseyProtocolSnapshot& Snapshot)
+	{
+		FIntersectScannerConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.IntersectScanner);
+		FFulcrumFilterConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.FulcrumFilter);
+		FCharlesCarmichaelConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.CharlesCarmichael);
+		FStayInTheCarConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.StayInTheCar);
+		FNerdHerdConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.NerdHerd);
+		FLogSinkConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.LogSink);
+		FBuyMoreCoverConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.BuyMoreCover);
+		FMorganModeConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.MorganMode);
+		FRingIntelConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.RingIntel);
+		FAsyncValidationConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.AsyncValidation);
+		FHotReloadConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.HotReload);
+		FVerdictCacheConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.VerdictCache);
+		FParallelStagesConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.ParallelStages);
+		FInstrumentationConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.Instrumentation);
+		FMetricsExporterConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.MetricsExporter);
+		FAuditLogConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.AuditLog);
+		FValidationProfilesConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.ValidationProfiles);
+		FAdmissionControlConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.AdmissionControl);
+		FSidecarConfig::StaticStruct()->SerializeBin(Ar, &Snapshot.Sidecar);
+	}
+
+	/**
+	 * Fingerprint of the config struct layouts SerializeConfigs writes
+	 * Adding, removing or retyping a config property changes it, which retires older blobs.
+	 */
+	static uint32 GetConfigSchemaHash()
+	{
+		const UScriptStruct* Structs[] =
+		{
+			FIntersectScannerConfig::StaticStruct(),
+			FFulcrumFilterConfig::StaticStruct(),
+			FCharlesCarmichaelConfig::StaticStruct(),
+			FStayInTheCarConfig::StaticStruct(),
+			FNerdHerdConfig::StaticStruct(),
+			FLogSinkConfig::StaticStruct(),
+			FBuyMoreCoverConfig::StaticStruct(),
+			FMorganModeConfig::StaticStruct(),
+			FRingIntelConfig::StaticStruct(),
+			FAsyncValidationConfig::StaticStruct(),
+			FHotReloadConfig::StaticStruct(),
+			FVerdictCacheConfig::StaticStruct(),
+			FParallelStagesConfig::StaticStruct(),
+			FInstrumentationConfig::StaticStruct(),
+			FMetricsExporterConfig::StaticStruct(),
+			FAuditLogConfig::StaticStruct(),
+			FValidationProfilesConfig::StaticStruct(),
+			FValidationProfileConfig::StaticStruct(),
+			FAdmissionControlConfig::StaticStruct(),
+			FAdmissionSystemConfig::StaticStruct(),
+			FSidecarConfig::StaticStruct(),
+		};
+
+		uint32 Hash = 0;
+		for (const UScriptStruct* Struct : Structs)
+		{
+			Hash = FCrc::StrCrc32(*Struct->GetName(), Hash);
+			for (TFieldIterator<FProperty> It(Struct); It; ++It)
+			{
+				Hash = FCrc::StrCrc32(*It->GetName(), Hash);
+				Hash = FCrc::StrCrc32(*It->GetCPPType(), Hash);
+			}
+		}
+		return Hash;
+	}
+
+	template <typename T>
+	static void AppendSection(TArray<uint8>& Bytes, FHeader& Header, ESection Section, TConstArrayView<T> Items)
+	{
+		check(sizeof(T) == SectionElementSizes[(int32)Section]);
+
+		Bytes.AddZeroed((int32)(Align((uint64)Bytes.Num(), SectionAlignment) - Bytes.Num()));
+
+		FSectionEntry& Entry = Header.Sections[(int32)Section];
+		Entry.Offset = Bytes.Num();
+		Entry.Size = Items.Num() * sizeof(T);
+		Bytes.Append(reinterpret_cast<const uint8*>(Items.GetData()), (int32)Entry.Size);
+	}
+
+	template <typename T>
+	static TConstArrayView<T> GetSection(const uint8* Data, const FHeader& Header, ESection Section)
+	{
+		const FSectionEntry& Entry = Header.Sections[(int32)Section];
+		return TConstArrayView<T>(reinterpret_cast<const T*>(Data + Entry.Offset), (int32)(Entry.Size / sizeof(T)));
+	}
+}
+
+FCaseyProtocolBlob::~FCaseyProtocolBlob()
+{
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+FString FCaseyProtocolBlob::GetBlobPath(const FString& ConfigPath)
+{
+	return FPaths::ChangeExtension(ConfigPath, TEXT("bin"));
+}
+
+FSHAHash FCaseyProtocolBlob::HashSource(TConstArrayView<uint8> JsonBytes)
+{
+	FSHAHash Hash;
+	FSHA1::HashBuffer(JsonBytes.GetData(), JsonBytes.Num(), Hash.Hash);
+	return Hash;
+}
+
+bool FCaseyProtocolBlob::Write(const FCaseyProtocolSnapshot& Snapshot, const FSHAHash& SourceHash, const FString& BlobPath)
+{
+	return Write(Snapshot, Snapshot.GetPatternMatcher().GetTables(), SourceHash, BlobPath);
+}
+
+bool FCaseyProtocolBlob::Write(const FCaseyProtocolSnapshot& Snapshot, const FOrionPatternMatcher::FTables& Tables,
+	const FSHAHash& SourceHash, const FString& BlobPath)
+{
+	using namespace CaseyProtocolBlob;
+
+	FHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = Magic;
+	Header.FormatVersion = FormatVersion;
+	Header.CharSize = sizeof(TCHAR);
+	Header.HeaderSize = sizeof(FHeader);
+	FMemory::Memcpy(Header.SourceHash, SourceHash.Hash, sizeof(Header.SourceHash));
+	Header.NumClasses = Tables.NumClasses;
+	Header.NumStates = Tables.NumStates;
+	Header.bUnicodeFolding = Tables.bUnicodeFolding ? 1 : 0;
+	Header.bNormalized = Tables.bNormalized ? 1 : 0;
+	Header.MaxEditDistance = Tables.MaxEditDistance;
+	Header.MinFuzzyLength = Tables.MinFuzzyLength;
+	Header.SkipClass = Tables.SkipClass;
+	Header.SpaceClass = Tables.SpaceClass;
+	Header.ConfigSchemaHash = GetConfigSchemaHash();
+
+	FCaseyProtocolSnapshot Configs = Snapshot;
+	Configs.IntersectScanner.HallucinationPatterns.Empty();
+	Configs.IntersectScanner.BiasKeywords.Empty();
+	Configs.IntersectScanner.ToxicityPatterns.Empty();
+	Configs.FulcrumFilter.PromptInjectionPatterns.Empty();
+	Configs.FulcrumFilter.DataExfiltrationPatterns.Empty();
+
+	TArray<uint8> ConfigBytes;
+	FMemoryWriter ConfigWriter(ConfigBytes);
+	SerializeConfigs(ConfigWriter, Configs);
+
+	TArray<uint8> Bytes;
+	Bytes.AddZeroed(sizeof(FHeader));
+
+	AppendSection<uint8>(Bytes, Header, ESection::Config, ConfigBytes);
+	AppendSection(Bytes, Header, ESection::AsciiClasses, Tables.AsciiClasses);
+	AppendSection(Bytes, Header, ESection::FoldedAsciiClasses, Tables.FoldedAsciiClasses);
+	AppendSection(Bytes, Header, ESection::WideChars, Tables.WideChars);
+	AppendSection(Bytes, Header, ESection::WideCharClasses, Tables.WideCharClasses);
+	AppendSection(Bytes, Header, ESection::Transitions, Tables.Transitions);
+	AppendSection(Bytes, Header, ESection::OutputOffsets, Tables.OutputOffsets);
+	AppendSection(Bytes, Header, ESection::OutputPatterns, Tables.OutputPatterns);
+	AppendSection(Bytes, Header, ESection::DictionaryLinks, Tables.DictionaryLinks);
+	AppendSection(Bytes, Header, ESection::PatternCategories, Tables.PatternCategories);
+	AppendSection(Bytes, Header, ESection::PatternCategoryIndices, Tables.PatternCategoryIndices);
+	AppendSection(Bytes, Header, ESection::PatternTextOffsets, Tables.PatternTextOffsets);
+	AppendSection(Bytes, Header, ESection::PatternText, Tables.PatternText);
+	AppendSection(Bytes, Header, ESection::CategoryOffsets, Tables.CategoryOffsets);
+	AppendSection(Bytes, Header, ESection::CategoryPatterns, Tables.CategoryPatterns);
+	AppendSection(Bytes, Header, ESection::SeedPatterns, Tables.SeedPatterns);
+	AppendSection(Bytes, Header, ESection::SeedEnds, Tables.SeedEnds);
+	AppendSection(Bytes, Header, ESection::FuzzyOffsets, Tables.FuzzyOffsets);
+	AppendSection(Bytes, Header, ESection::FuzzyClasses, Tables.FuzzyClasses);
+
+	Header.TotalSize = Bytes.Num();
+	Header.PayloadCrc = FCrc::MemCrc32(Bytes.GetData() + sizeof(FHeader), Bytes.Num() - sizeof(FHeader));
+	FMemory::Memcpy(Bytes.GetData(), &Header, sizeof(FHeader));
+
+	// Write next to the target and swap it in, so a running instance never maps a half-written blob
+	const FString TempPath = BlobPath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*BlobPath, *TempPath, true))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("Casey Protocol: Failed to write blob %s"), *BlobPath);
+		return false;
+	}
+
+	UE_LOG(LogOrionAI, Display, TEXT("Casey Protocol: Wrote %s (%d bytes, %d patterns, %d states)"),
+		*BlobPath, Bytes.Num(), Tables.PatternCategories.Num(), Tables.NumStates);
+	return true;
+}
+
+TUniquePtr<FCaseyProtocolSnapshot> FCaseyProtocolBlob::Load(const FString& BlobPath, const FSHAHash& ExpectedSourceHash)
+{
+	using namespace CaseyProtocolBlob;
+
+	if (!IFileManager::Get().FileExists(*BlobPath))
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FCaseyProtocolBlob, ESPMode::ThreadSafe> Blob = MakeShared<FCaseyProtocolBlob, ESPMode::ThreadSafe>();
+
+	Blob->MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*BlobPath));
+	if (Blob->MappedFile)
+	{
+		Blob->MappedRegion.Reset(Blob->MappedFile->MapRegion(0, Blob->MappedFile->GetFileSize()));
+	}
+
+	if (Blob->MappedRegion)
+	{
+		Blob->Data = Blob->MappedRegion->GetMappedPtr();
+		Blob->Size = Blob->MappedRegion->GetMappedSize();
+	}
+	else if (FFileHelper::LoadFileToArray(Blob->LoadedBytes, *BlobPath, FILEREAD_Silent))
+	{
+		Blob->Data = Blob->LoadedBytes.GetData();
+		Blob->Size = Blob->LoadedBytes.Num();
+	}
+	else
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("Casey Protocol: Could not open blob %s"), *BlobPath);
+		return nullptr;
+	}
+
+	FHeader Header;
+	if (Blob->Size < (int64)sizeof(FHeader))
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("Casey Protocol: Blob %s is truncated"), *BlobPath);
+		return nullptr;
+	}
+	FMemory::Memcpy(&Header, Blob->Data, sizeof(FHeader));
+
+	if (Header.Magic != Magic || Header.FormatVersion != FormatVersion || Header.CharSize != sizeof(TCHAR) || Header.HeaderSize != sizeof(FHeader) ||
+		Header.ConfigSchemaHash != GetConfigSchemaHash())
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("Casey Protocol: Blob %s is from another build (format %u) - recompile it"), *BlobPath, Header.FormatVersion);
+		return nullptr;
+	}
+
+	if (FMemory::Memcmp(Header.SourceHash, ExpectedSourceHash.Hash, sizeof(Header.SourceHash)) != 0)
+	{
+		UE_LOG(LogOrionAI, Display, TEXT("Casey Protocol: Blob %s is stale - the JSON has changed since it was compiled"), *BlobPath);
+		return nullptr;
+	}
+
+	bool bValid = Header.TotalSize == (uint64)Blob->Size;
+	for (int32 Section = 0; bValid && Section < (int32)ESection::Count; Section++)
+	{
+		const FSectionEntry& Entry = Header.Sections[Section];
+		bValid = Entry.Offset >= sizeof(FHeader)
+			&& Entry.Offset % SectionAlignment == 0
+			&& Entry.Size <= Header.TotalSize - Entry.Offset
+			&& Entry.Size % SectionElementSizes[Section] == 0
+			&& Entry.Size / SectionElementSizes[Section] <= (uint64)MAX_int32;
+	}
+
+	if (!bValid || FCrc::MemCrc32(Blob->Data + sizeof(FHeader), (int32)(Blob->Size - sizeof(FHeader))) != Header.PayloadCrc)
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("Casey Protocol: Blob %s is corrupt"), *BlobPath);
+		return nullptr;
+	}
+
+	TUniquePtr<FCaseyProtocolSnapshot> Snapshot = MakeUnique<FCaseyProtocolSnapshot>();
+
+	const TConstArrayView<uint8> ConfigBytes = GetSection<uint8>(Blob->Data, Header, ESection::Config);
+	FMemoryReaderView ConfigReader(TArrayView64<const uint8>(ConfigBytes.GetData(), ConfigBytes.Num()));
+	SerializeConfigs(ConfigReader, *Snapshot);
+
+	FOrionPatternMatcher::FTables Tables;
+	Tables.NumClasses = Header.NumClasses;
+	Tables.NumStates = Header.NumStates;
+	Tables.bUnicodeFolding = Header.bUnicodeFolding != 0;
+	Tables.bNormalized = Header.bNormalized != 0;
+	Tables.MaxEditDistance = Header.MaxEditDistance;
+	Tables.MinFuzzyLength = Header.MinFuzzyLength;
+	Tables.SkipClass = Header.SkipClass;
+	Tables.SpaceClass = Header.SpaceClass;
+	Tables.AsciiClasses = GetSection<uint16>(Blob->Data, Header, ESection::AsciiClasses);
+	Tables.FoldedAsciiClasses = GetSection<uint16>(Blob->Data, Header, ESection::FoldedAsciiClasses);
+	Tables.WideChars = GetSection<TCHAR>(Blob->Data, Header, ESection::WideChars);
+	Tables.WideCharClasses = GetSection<int32>(Blob->Data, Header, ESection::WideCharClasses);
+	Tables.Transitions = GetSection<int32>(Blob->Data, Header, ESection::Transitions);
+	Tables.OutputOffsets = GetSection<int32>(Blob->Data, Header, ESection::OutputOffsets);
+	Tables.OutputPatterns = GetSection<int32>(Blob->Data, Header, ESection::OutputPatterns);
+	Tables.DictionaryLinks = GetSection<int32>(Blob->Data, Header, ESection::DictionaryLinks);
+	Tables.PatternCategories = GetSection<uint8>(Blob->Data, Header, ESection::PatternCategories);
+	Tables.PatternCategoryIndices = GetSection<int32>(Blob->Data, Header, ESection::PatternCategoryIndices);
+	Tables.PatternTextOffsets = GetSection<int32>(Blob->Data, Header, ESection::PatternTextOffsets);
+	Tables.PatternText = GetSection<TCHAR>(Blob->Data, Header, ESection::PatternText);
+	Tables.CategoryOffsets = GetSection<int32>(Blob->Data, Header, ESection::CategoryOffsets);
+	Tables.CategoryPatterns = GetSection<int32>(Blob->Data, Header, ESection::CategoryPatterns);
+	Tables.SeedPatterns = GetSection<int32>(Blob->Data, Header, ESection::SeedPatterns);
+	Tables.SeedEnds = GetSection<int32>(Blob->Data, Header, ESection::SeedEnds);
+	Tables.FuzzyOffsets = GetSection<int32>(Blob->Data, Header, ESection::FuzzyOffsets);
+	Tables.FuzzyClasses = GetSection<uint16>(Blob->Data, Header, ESection::FuzzyClasses);
+
+	Snapshot->PatternMatcher = FOrionPatternMatcher::FromTables(Tables, Blob);
+	if (ConfigReader.IsError() || !Snapshot->PatternMatcher)
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("Casey Protocol: Blob %s is corrupt"), *BlobPath);
+		return nullptr;
+	}
+
+	Snapshot->SanitizationRules = FCharlesCarmichaelRuleSet::Build(Snapshot->CharlesCarmichael);
+
+	// Profile matchers aren't stored; cutting them from the mapped tables is cheap next to a full compile
+	Snapshot->CompileProfiles();
+	Snapshot->CompileAdmission();
+
+	UE_LOG(LogOrionAI, Display, TEXT("Casey Protocol: Mapped %s (%d patterns, %d matcher states, %d sanitization rules)"),
+		*BlobPath, Tables.PatternCategories.Num(), Tables.NumStates, Snapshot->SanitizationRules->GetNumRules());
+
+	return Snapshot;
+}
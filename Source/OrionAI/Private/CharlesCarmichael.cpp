@@ -0,0 +1,51 @@
+// OrionAI - Charles Carmichael PII sanitization
+// Engine front end for the core's built-in rules, applied in one pass
+
+#include "CharlesCarmichael.h"
+#include "CaseyProtocol.h"
+#include "OrionAI.h"
+#include "OrionCoreText.h"
+
+TSharedRef<const FCharlesCarmichaelRuleSet, ESPMode::ThreadSafe> FCharlesCarmichaelRuleSet::Build(const FCharlesCarmichaelConfig& Config)
+{
+	TSharedRef<FCharlesCarmichaelRuleSet, ESPMode::ThreadSafe> RuleSet = MakeShared<FCharlesCarmichaelRuleSet, ESPMode::ThreadSafe>();
+
+	if (!Config.bEnabled)
+	{
+		return RuleSet;
+	}
+
+	for (const TPair<FString, FString>& Pair : Config.SanitizationRules)
+	{
+		if (!RuleSet->Core.AddRule(OrionCoreText::ToCore(Pair.Key), OrionCoreText::ToCore(Pair.Value)))
+		{
+			UE_LOG(LogOrionAI, Warning, TEXT("Charles Carmichael: Unknown sanitization rule '%s' skipped"), *Pair.Key);
+		}
+	}
+
+	return RuleSet;
+}
+
+bool FCharlesCarmichaelRuleSet::IsBreak(FStringView Text, int32 Index)
+{
+	return OrionCore::FPiiSanitizer::IsBreak(OrionCoreText::ToCore(Text), Index);
+}
+
+bool FCharlesCarmichaelRuleSet::Sanitize(const FString& Text, FString& OutSanitized, const FOrionCancellationToken& Token) const
+{
+	OrionCore::FCancelCheck Cancel;
+	Cancel.Context = &Token;
+	Cancel.IsCancelledFn = [](const void* Context)
+	{
+		return static_cast<const FOrionCancellationToken*>(Context)->IsCancelled();
+	};
+
+	std::u16string Sanitized;
+	if (!Core.Sanitize(OrionCoreText::ToCore(Text), Sanitized, Token.Cancellation ? Cancel : OrionCore::FCancelCheck()))
+	{
+		return false;
+	}
+
+	OutSanitized = OrionCoreText::FromCore(Sanitized);
+	return true;
+}
@@ -2,11 +2,29 @@
 // Industry-agnostic AI validation framework
 
 #include "OrionAI.h"
+#include "CaseyProtocol.h"
+#include "OrionPatternMatcher.h"
+#include "CharlesCarmichael.h"
+#include "OrionLogWriter.h"
+#include "StayInTheCarStore.h"
+#include "OrionVerdictCache.h"
+#include "OrionRingIntel.h"
+#include "OrionSystemState.h"
+#include "OrionNerdHerd.h"
+#include "OrionInstrumentation.h"
+#include "OrionMorganMode.h"
+#include "OrionMetricsExporter.h"
+#include "OrionAuditLog.h"
+#include "OrionReportView.h"
+#include "OrionSidecar.h"
+#include "OrionDeadlineTimer.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
-#include "Dom/JsonObject.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/IQueuedWork.h"
+#include "HAL/Event.h"
 
 DEFINE_LOG_CATEGORY(LogOrionAI);
 
@@ -20,6 +38,7 @@ void FOrionAIModule::StartupModule()
 
 void FOrionAIModule::ShutdownModule()
 {
+	UOrionAI::ShutdownOrion();
 	UE_LOG(LogOrionAI, Log, TEXT("OrionAI Module: Shutting down"));
 }
 
@@ -27,365 +46,1771 @@ IMPLEMENT_MODULE(FOrionAIModule, OrionAI)
 
 // UOrionAI Implementation
 
-UOrionAI::UOrionAI()
-	: bInitialized(false)
-	, bSafeModeActive(false)
-	, ConsecutiveFailures(0)
-	, TotalValidations(0)
-	, ApprovedCount(0)
-	, RejectedCount(0)
-	, QuarantinedCount(0)
+std::atomic<bool> UOrionAI::bInitialized{ false };
+std::atomic<bool> UOrionAI::bSafeModeActive{ false };
+std::atomic<int32> UOrionAI::ConsecutiveFailures{ 0 };
+std::atomic<int32> UOrionAI::NumSystemsInSafeMode{ 0 };
+FOrionStripedCounters UOrionAI::Counters;
+TOrionStripedCounters<(int32)EOrionRuleCategory::Count> UOrionAI::RuleHits;
+FQueuedThreadPool* UOrionAI::ExpensiveStagePool = nullptr;
+FString UOrionAI::ConfigFilePath;
+FString UOrionAI::DashboardURL = TEXT("http://localhost:5000");
+
+/** What admission control let a call run */
+enum class EOrionAdmission : uint8
 {
+	Full,
+	Shed,
+	FailClosed
+};
+
+namespace OrionAI
+{
+	/** Working memory for one decision; the batch path reuses it across a whole chunk */
+	struct FDecisionScratch
+	{
+		FString Sanitized;
+		FOrionPatternMatcher::FScanResult Matches;
+	};
+
+	/** Stay In The Car storage, constructed on first use so it outlives every caller */
+	static FStayInTheCarStore& GetMutableQuarantineStore()
+	{
+		static FStayInTheCarStore Store;
+		return Store;
+	}
+
+	/** Verdict cache shared by every validation path */
+	static FOrionVerdictCache& GetVerdictCache()
+	{
+		static FOrionVerdictCache Cache;
+		return Cache;
+	}
+
+	/** Per-AISystem failure streaks, safe mode and metrics */
+	static FOrionSystemStateTable& GetSystemStates()
+	{
+		static FOrionSystemStateTable States;
+		return States;
+	}
+
+	// Smallest slice of a batch worth handing to its own task
+	static constexpr int32 MinBatchChunkSize = 16;
+
+	// Safe mode rule detail of a decision admission control failed closed on
+	static constexpr int32 ShedSafeModeDetail = 2;
+
+	/** Admitted validations still running or queued for the worker pool, across every AI system */
+	static std::atomic<int32> NumInFlight{ 0 };
+
+	/** Queue slots one call holds in NumInFlight, given back on Release() or destruction */
+	struct FAdmissionSlots
+	{
+		int32 Num = 0;
+
+		FAdmissionSlots() = default;
+		FAdmissionSlots(const FAdmissionSlots&) = delete;
+		FAdmissionSlots& operator=(const FAdmissionSlots&) = delete;
+
+		~FAdmissionSlots()
+		{
+			Release();
+		}
+
+		/** @return The queue depth counting these slots */
+		int32 Take(int32 InNum)
+		{
+			check(Num == 0);
+			Num = InNum;
+			return NumInFlight.fetch_add(InNum, std::memory_order_relaxed) + InNum;
+		}
+
+		void Release()
+		{
+			if (Num > 0)
+			{
+				NumInFlight.fetch_sub(Num, std::memory_order_relaxed);
+				Num = 0;
+			}
+		}
+	};
+
+	/** Take up to NumDecisions tokens from System's bucket, as many as it holds; returns how many */
+	static int32 TakeTokens(FOrionSystemState& System, const FOrionAdmissionPolicy& Policy, int32 NumDecisions)
+	{
+		if (Policy.IntervalCycles == 0 || NumDecisions <= 0)
+		{
+			return NumDecisions;  // No rate limit, or nothing to take
+		}
+
+		// GCRA: the bucket holds BurstCycles worth of tokens and refills one per IntervalCycles
+		const uint64 Now = FPlatformTime::Cycles64();
+		const uint64 Limit = Now + Policy.BurstCycles;
+		uint64 Next = System.NextAdmissionCycles.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			const uint64 Start = FMath::Max(Next, Now);
+			const uint64 NumAvailable = Start < Limit ? (Limit - Start) / Policy.IntervalCycles : 0;
+			const int32 NumTaken = (int32)FMath::Min<uint64>(NumAvailable, (uint64)NumDecisions);
+			if (NumTaken == 0)
+			{
+				return 0;
+			}
+			if (System.NextAdmissionCycles.compare_exchange_weak(Next, Start + Policy.IntervalCycles * (uint64)NumTaken, std::memory_order_relaxed))
+			{
+				return NumTaken;
+			}
+		}
+	}
+
+	static EQueuedWorkPriority ToWorkPriority(EOrionAdmissionPriority Priority)
+	{
+		switch (Priority)
+		{
+		case EOrionAdmissionPriority::Low:		return EQueuedWorkPriority::Low;
+		case EOrionAdmissionPriority::High:		return EQueuedWorkPriority::High;
+		case EOrionAdmissionPriority::Critical:	return EQueuedWorkPriority::Highest;
+		default:								return EQueuedWorkPriority::Normal;
+		}
+	}
+
+	/** Empty, or one context per decision - anything else is ignored with an ensure */
+	static TArrayView<const FString> ValidateBatchContexts(TArrayView<const FString> Contexts, int32 NumDecisions)
+	{
+		if (!ensureMsgf(Contexts.Num() == 0 || Contexts.Num() == NumDecisions,
+			TEXT("MonitorAIDecisionBatch: %d contexts for %d decisions"), Contexts.Num(), NumDecisions))
+		{
+			return TArrayView<const FString>();
+		}
+		return Contexts;
+	}
+
+	static const FString& GetBatchContext(TArrayView<const FString> Contexts, int32 Index)
+	{
+		static const FString NoContext;
+		return Contexts.Num() > 0 ? Contexts[Index] : NoContext;
+	}
+
+	/** Shared state of one MonitorAIDecisionAsync call - whoever completes it first wins */
+	struct FAsyncValidation
+	{
+		// Text is attached before the worker starts; the worker reads OriginalDecision
+		FOrionValidationReport Report;
+		TPromise<FOrionValidationReport> Promise;
+		FOrionSystemState* System = nullptr;
+
+		// From the call to whichever path completes it
+		uint64 StartCycles = 0;
+
+		// Config the call started with, shared until the worker is done with it - a call
+		// waiting in the pool's queue must not hold up a publish the way a read scope would
+		TSharedPtr<const FCaseyProtocolSnapshot, ESPMode::ThreadSafe> Protocol;
+
+		// Held as long as Protocol; released with it
+		FAdmissionSlots Slots;
+
+		// Owned by the pinned config
+		const FOrionCompiledProfile* Profile = nullptr;
+
+		// Set when the verdict should be cached once the expensive stages finish
+		bool bCacheVerdict = false;
+		uint64 CacheKey = 0;
+		std::atomic<bool> bCompleted{ false };
+
+		bool TryClaim()
+		{
+			return !bCompleted.exchange(true);
+		}
+
+		void RecordLatency() const
+		{
+			if (StartCycles != 0)
+			{
+				FOrionInstrumentation::RecordSince(EOrionStage::Decision, StartCycles, &System->Latency);
+			}
+		}
+	};
+
+	/**
+	 * The expensive stages of one MonitorAIDecisionAsync call, queued on the worker pool
+	 * Abandoned work - the pool being destroyed with it still queued - completes the call
+	 * with its cheap-checks verdict, so the future resolves and the config and queue slots
+	 * it held are given back.
+	 */
+	class FAsyncValidationWork final : public IQueuedWork
+	{
+	public:
+		explicit FAsyncValidationWork(const TSharedRef<FAsyncValidation, ESPMode::ThreadSafe>& InState)
+			: State(InState)
+		{
+		}
+
+		virtual void DoThreadedWork() override
+		{
+			UOrionAI::RunAsyncValidation(*State);
+			delete this;
+		}
+
+		virtual void Abandon() override
+		{
+			UOrionAI::AbandonAsyncValidation(*State);
+			delete this;
+		}
+
+	private:
+		TSharedRef<FAsyncValidation, ESPMode::ThreadSafe> State;
+	};
+
+	/**
+	 * Ring Intel for one EvaluateStagesInParallel call, queued on the worker pool
+	 * Lives on the caller's stack, which waits for Done - or retracts the work and runs it
+	 * itself - before returning. Abandoned work runs inline so the wait always ends.
+	 */
+	class FRingIntelStageWork final : public IQueuedWork
+	{
+	public:
+		FRingIntelStageWork(const FCaseyProtocolSnapshot& InProtocol, const FString& InDecision, FOrionStageCancellation& InCancellation,
+			int32 InStage, FOrionValidationReport& OutReport, bool& bOutPassed, FEvent& InDone)
+			: Protocol(InProtocol), Decision(InDecision), Cancellation(InCancellation), Stage(InStage)
+			, Report(OutReport), bPassed(bOutPassed), Done(InDone)
+		{
+		}
+
+		/** Run the stage on this thread; Done is the last thing touched */
+		void Run()
+		{
+			bPassed = UOrionAI::EvaluateRingIntel(Protocol, Decision, Report, FOrionCancellationToken{ &Cancellation, Stage });
+			if (!bPassed)
+			{
+				Cancellation.Reject(Stage);
+			}
+			Done.Trigger();
+		}
+
+		virtual void DoThreadedWork() override
+		{
+			Run();
+		}
+
+		virtual void Abandon() override
+		{
+			Run();
+		}
+
+	private:
+		const FCaseyProtocolSnapshot& Protocol;
+		const FString& Decision;
+		FOrionStageCancellation& Cancellation;
+		const int32 Stage;
+		FOrionValidationReport& Report;
+		bool& bPassed;
+		FEvent& Done;
+	};
+
+	/** Record a pattern rule; the text is only looked up when the report is described */
+	static void AddPatternRule(const FCaseyProtocolSnapshot& Protocol, const FOrionPatternMatcher::FScanResult& Matches, EOrionPatternCategory Category, FOrionValidationReport& Report)
+	{
+		Report.TriggeredRules.Add(FOrionRuleId::ForPattern(Category, Matches.GetMatch(Category)));
+		Report.ProtocolVersion = Protocol.Version;
+	}
+
+	/** Apply Intersect Scanner verdicts (hallucination > bias > toxicity) from a shared scan */
+	static bool ApplyIntersectMatches(const FCaseyProtocolSnapshot& Protocol, const FOrionPatternMatcher::FScanResult& Matches, FOrionValidationReport& Report, bool& bOutCriticalBias)
+	{
+		const FOrionPatternMatcher& Matcher = Protocol.GetPatternMatcher();
+
+		// Check for hallucination patterns
+		if (Matches.HasMatch(EOrionPatternCategory::Hallucination))
+		{
+			const TCHAR* Pattern = Matcher.GetPattern(EOrionPatternCategory::Hallucination, Matches.GetMatch(EOrionPatternCategory::Hallucination));
+			Report.Result = EOrionValidationResult::Rejected;
+			AddPatternRule(Protocol, Matches, EOrionPatternCategory::Hallucination, Report);
+			Report.SuspicionScore += 1.0f;
+			UE_LOG(LogOrionAI, Warning, TEXT("❌ OrionAI: HALLUCINATION DETECTED - '%s'"), Pattern);
+			return false;
+		}
+
+		// Check for bias keywords
+		if (Matches.HasMatch(EOrionPatternCategory::Bias))
+		{
+			const TCHAR* Bias = Matcher.GetPattern(EOrionPatternCategory::Bias, Matches.GetMatch(EOrionPatternCategory::Bias));
+			Report.Result = EOrionValidationResult::Rejected;
+			AddPatternRule(Protocol, Matches, EOrionPatternCategory::Bias, Report);
+			Report.SuspicionScore += 0.9f;
+			UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: BIAS DETECTED - '%s'"), Bias);
+
+			// Bias triggers immediate safe mode
+			bOutCriticalBias = true;
+			return false;
+		}
+
+		// Check for toxicity
+		if (Matches.HasMatch(EOrionPatternCategory::Toxicity))
+		{
+			const TCHAR* Toxicity = Matcher.GetPattern(EOrionPatternCategory::Toxicity, Matches.GetMatch(EOrionPatternCategory::Toxicity));
+			Report.Result = EOrionValidationResult::Rejected;
+			AddPatternRule(Protocol, Matches, EOrionPatternCategory::Toxicity, Report);
+			Report.SuspicionScore += 0.8f;
+			UE_LOG(LogOrionAI, Warning, TEXT("❌ OrionAI: TOXICITY DETECTED - '%s'"), Toxicity);
+			return false;
+		}
+
+		return true;
+	}
+
+	/** Apply Fulcrum Filter verdicts (prompt injection > data exfiltration) from a shared scan */
+	static bool ApplyFulcrumMatches(const FCaseyProtocolSnapshot& Protocol, const FOrionPatternMatcher::FScanResult& Matches, FOrionValidationReport& Report)
+	{
+		const FOrionPatternMatcher& Matcher = Protocol.GetPatternMatcher();
+
+		// Check for prompt injection
+		if (Matches.HasMatch(EOrionPatternCategory::PromptInjection))
+		{
+			const TCHAR* Pattern = Matcher.GetPattern(EOrionPatternCategory::PromptInjection, Matches.GetMatch(EOrionPatternCategory::PromptInjection));
+			Report.Result = EOrionValidationResult::Rejected;
+			AddPatternRule(Protocol, Matches, EOrionPatternCategory::PromptInjection, Report);
+			Report.SuspicionScore += 1.0f;
+			UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: PROMPT INJECTION DETECTED - '%s'"), Pattern);
+			return false;
+		}
+
+		// Check for data exfiltration
+		if (Matches.HasMatch(EOrionPatternCategory::DataExfiltration))
+		{
+			const TCHAR* Pattern = Matcher.GetPattern(EOrionPatternCategory::DataExfiltration, Matches.GetMatch(EOrionPatternCategory::DataExfiltration));
+			Report.Result = EOrionValidationResult::Rejected;
+			AddPatternRule(Protocol, Matches, EOrionPatternCategory::DataExfiltration, Report);
+			Report.SuspicionScore += 1.0f;
+			UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: DATA EXFILTRATION DETECTED - '%s'"), Pattern);
+			return false;
+		}
+
+		return true;
+	}
+}
+
+bool UOrionAI::InitializeOrion(const FString& ConfigPath)
+{
+	if (bInitialized)
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("OrionAI already initialized"));
+		return true;
+	}
+
+	// Load Casey Protocol configuration from JSON
+	FString FullPath = FPaths::ProjectDir() / ConfigPath;
+
+	if (!FPaths::FileExists(FullPath))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("Failed to load Casey Protocol: %s"), *FullPath);
+		return false;
+	}
+
+	// Maps the precompiled blob when it is current; otherwise parses every module
+	// configuration and compiles the pattern sets once
+	UCaseyProtocol::LoadFromFile(FullPath);
+	ConfigFilePath = FullPath;
+
+	{
+		FCaseyProtocolReadScope Protocol;
+
+		FOrionLogWriter::Get().Start(Protocol->LogSink);
+		OrionAI::GetMutableQuarantineStore().Configure(Protocol->StayInTheCar);
+		OrionAI::GetVerdictCache().Configure(Protocol->VerdictCache.MaxMemoryMB);
+
+		// The model loads once - here, or in the host's sidecar daemon; later reloads can only
+		// toggle Ring Intel and move its threshold
+		if (Protocol->Sidecar.bEnabled)
+		{
+			FOrionSidecarClient::Get().Start(Protocol->Sidecar);
+		}
+		else if (Protocol->RingIntel.bEnabled)
+		{
+			FRingIntelBackend::Get().Start(Protocol->RingIntel);
+		}
+
+		if (Protocol->NerdHerd.bEnabled)
+		{
+			FNerdHerdDispatcher::Get().Start(Protocol->NerdHerd);
+		}
+
+		if (Protocol->MetricsExporter.bEnabled)
+		{
+			FOrionMetricsExporter::Get().Start(Protocol->MetricsExporter);
+		}
+
+		if (Protocol->AuditLog.bEnabled)
+		{
+			FOrionAuditLog::Get().Start(Protocol->AuditLog);
+		}
+
+		const int32 NumWorkers = FMath::Max(1, Protocol->AsyncValidation.WorkerThreads);
+		ExpensiveStagePool = FQueuedThreadPool::Allocate();
+		verify(ExpensiveStagePool->Create(NumWorkers, 128 * 1024, TPri_BelowNormal, TEXT("OrionAIWorkers")));
+		FOrionDeadlineTimer::Get().Start();
+
+		if (Protocol->HotReload.bEnabled)
+		{
+			UCaseyProtocol::StartWatching(FullPath, Protocol->HotReload.PollIntervalSeconds);
+		}
+	}
+
+	bInitialized = true;
+
+	UE_LOG(LogOrionAI, Log, TEXT("================================================="));
+	UE_LOG(LogOrionAI, Log, TEXT("ORIONAI: INITIALIZATION COMPLETE"));
+	UE_LOG(LogOrionAI, Log, TEXT("✓ Intersect Scanner: ACTIVE"));
+	UE_LOG(LogOrionAI, Log, TEXT("✓ Fulcrum Filter: ACTIVE"));
+	UE_LOG(LogOrionAI, Log, TEXT("✓ Charles Carmichael: ACTIVE"));
+	UE_LOG(LogOrionAI, Log, TEXT("✓ Stay In The Car: ACTIVE"));
+	UE_LOG(LogOrionAI, Log, TEXT("✓ Nerd Herd: ACTIVE"));
+	UE_LOG(LogOrionAI, Log, TEXT("✓ Morgan Mode: ACTIVE"));
+	UE_LOG(LogOrionAI, Log, TEXT("================================================="));
+
+	return true;
+}
+
+void UOrionAI::ShutdownOrion()
+{
+	bInitialized = false;
+
+	UCaseyProtocol::StopWatching();
+	FOrionMetricsExporter::Get().Stop();
+
+	// Before the pool, so workers waiting on inference are released
+	FRingIntelBackend::Get().Stop();
+
+	if (ExpensiveStagePool)
+	{
+		// Destroy waits for running work and abandons what is still queued, which
+		// completes with its cheap-checks verdict
+		ExpensiveStagePool->Destroy();
+		delete ExpensiveStagePool;
+		ExpensiveStagePool = nullptr;
+	}
+
+	// After the pool - every async call has been answered, so pending deadlines are moot
+	FOrionDeadlineTimer::Get().Stop();
+
+	// After the pool, so async work still waiting on the daemon gets its answer
+	FOrionSidecarClient::Get().Stop();
+
+	// After the pool, so decisions committed by finishing async work are recorded
+	FOrionAuditLog::Get().Stop();
+
+	// After the pool, so alerts raised by finishing async work get their one attempt
+	FNerdHerdDispatcher::Get().Stop();
+
+	// Last, so lines logged by finishing async work still reach disk
+	FOrionLogWriter::Get().Stop();
+}
+
+void UOrionAI::ReloadCaseyProtocol()
+{
+	if (ConfigFilePath.IsEmpty())
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("OrionAI not initialized - nothing to reload"));
+		return;
+	}
+
+	UCaseyProtocol::ReloadFromFileAsync(ConfigFilePath);
+}
+
+FOrionValidationReport UOrionAI::MakeNotInitializedReport()
+{
+	UE_LOG(LogOrionAI, Error, TEXT("OrionAI not initialized! Call InitializeOrion() first."));
+	FOrionValidationReport ErrorReport;
+	ErrorReport.Result = EOrionValidationResult::Rejected;
+	ErrorReport.TriggeredRules.Add(FOrionRuleId(EOrionRuleCategory::NotInitialized));
+	return ErrorReport;
+}
+
+FOrionValidationReport UOrionAI::MakeSafeModeReport()
+{
+	FOrionValidationReport SafeModeReport;
+	SafeModeReport.Result = EOrionValidationResult::Rejected;
+	SafeModeReport.TriggeredRules.Add(FOrionRuleId(EOrionRuleCategory::SafeMode, bSafeModeActive ? 1 : 0));
+	return SafeModeReport;
+}
+
+FOrionValidationReport UOrionAI::MakeShedReport(const FCaseyProtocolSnapshot& Protocol)
+{
+	FOrionValidationReport ShedReport;
+	ShedReport.Result = EOrionValidationResult::Rejected;
+	ShedReport.TriggeredRules.Add(FOrionRuleId(EOrionRuleCategory::SafeMode, OrionAI::ShedSafeModeDetail));
+	ShedReport.ProtocolVersion = Protocol.Version;
+	ShedReport.bShed = true;
+	return ShedReport;
+}
+
+EOrionAdmission UOrionAI::Admit(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, int32 NumDecisions,
+	OrionAI::FAdmissionSlots& OutSlots)
+{
+	int32 NumFull = 0;
+	return Admit(Protocol, System, NumDecisions, OutSlots, NumFull);
+}
+
+EOrionAdmission UOrionAI::Admit(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, int32 NumDecisions,
+	OrionAI::FAdmissionSlots& OutSlots, int32& OutNumFull)
+{
+	OutNumFull = NumDecisions;
+	const FAdmissionControlConfig& AdmissionControl = Protocol.AdmissionControl;
+	if (!AdmissionControl.bEnabled || NumDecisions <= 0)
+	{
+		return EOrionAdmission::Full;
+	}
+
+	// Shed decisions keep their slots too - they are cheaper, not free. A batch gets full
+	// coverage for as many of its leading decisions as fit under the queue depth and then
+	// the rate limit, so one larger than either still has its prefix evaluated in full.
+	const FOrionAdmissionPolicy& Policy = Protocol.GetAdmissionPolicy(System.Name);
+	const int32 NumQueued = OutSlots.Take(NumDecisions) - NumDecisions;
+	const int32 NumUnderDepth = FMath::Clamp(Policy.MaxQueueDepth - NumQueued, 0, NumDecisions);
+	OutNumFull = OrionAI::TakeTokens(System, Policy, NumUnderDepth);
+	if (OutNumFull == NumDecisions)
+	{
+		return EOrionAdmission::Full;
+	}
+
+	const int32 NumShedQueueDepth = NumDecisions - NumUnderDepth;
+	const int32 NumShedRateLimit = NumUnderDepth - OutNumFull;
+	if (NumShedQueueDepth > 0)
+	{
+		Counters.Increment(EOrionCounter::ShedQueueDepth, NumShedQueueDepth);
+		System.Counters.Increment(EOrionCounter::ShedQueueDepth, NumShedQueueDepth);
+	}
+	if (NumShedRateLimit > 0)
+	{
+		Counters.Increment(EOrionCounter::ShedRateLimit, NumShedRateLimit);
+		System.Counters.Increment(EOrionCounter::ShedRateLimit, NumShedRateLimit);
+	}
+	return AdmissionControl.ShedPolicy == EOrionShedPolicy::FailClosed ? EOrionAdmission::FailClosed : EOrionAdmission::Shed;
+}
+
+void UOrionAI::MarkShed(const FCaseyProtocolSnapshot& Protocol, FOrionValidationReport& Report)
+{
+	Report.bShed = true;
+
+	// Charles Carmichael never saw it either
+	if (Protocol.AdmissionControl.ShedPolicy == EOrionShedPolicy::FulcrumOnly)
+	{
+		Report.bCheapChecksOnly = true;
+	}
+}
+
+FOrionValidationReport UOrionAI::MonitorAIDecision(
+	const FString& AISystem,
+	const FString& Decision,
+	const FString& Context)
+{
+	if (!bInitialized)
+	{
+		return MakeNotInitializedReport();
+	}
+
+	FOrionSystemState& System = GetSystemState(AISystem);
+	if (IsBlocked(System))
+	{
+		FOrionValidationReport SafeModeReport = MakeSafeModeReport();
+		AttachReportText(AISystem, Decision, Context, SafeModeReport);
+		return SafeModeReport;
+	}
+
+	FCaseyProtocolReadScope Protocol;
+	OrionAI::FAdmissionSlots Slots;
+	const EOrionAdmission Admission = Admit(*Protocol, System, 1, Slots);
+	if (Admission == EOrionAdmission::FailClosed)
+	{
+		FOrionValidationReport ShedReport = MakeShedReport(*Protocol);
+		AttachReportText(AISystem, Decision, Context, ShedReport);
+		return ShedReport;
+	}
+
+	ORION_STAGE_SCOPE_WITH(Decision, System.Latency);
+
+	OrionAI::FDecisionScratch Scratch;
+	FOrionValidationReport Report;
+	bool bCriticalBias = false;
+
+	EvaluateDecision(*Protocol, Protocol->GetProfile(System.Name, Admission == EOrionAdmission::Shed), AISystem, Decision, Scratch, Report, bCriticalBias, true);
+	AttachReportText(AISystem, Decision, Context, Report);
+	CommitDecision(*Protocol, System, Report, bCriticalBias);
+
+	return Report;
+}
+
+FOrionValidationReportView UOrionAI::MonitorAIDecision(
+	FOrionReportArena& Arena,
+	const FString& AISystem,
+	const FString& Decision,
+	const FString& Context)
+{
+	if (!bInitialized)
+	{
+		return FOrionValidationReportView::Make(Arena, AISystem, Decision, Context, MakeNotInitializedReport());
+	}
+
+	FOrionSystemState& System = GetSystemState(AISystem);
+	if (IsBlocked(System))
+	{
+		return FOrionValidationReportView::Make(Arena, AISystem, Decision, Context, MakeSafeModeReport());
+	}
+
+	FCaseyProtocolReadScope Protocol;
+	OrionAI::FAdmissionSlots Slots;
+	const EOrionAdmission Admission = Admit(*Protocol, System, 1, Slots);
+	if (Admission == EOrionAdmission::FailClosed)
+	{
+		return FOrionValidationReportView::Make(Arena, AISystem, Decision, Context, MakeShedReport(*Protocol));
+	}
+
+	ORION_STAGE_SCOPE_WITH(Decision, System.Latency);
+
+	OrionAI::FDecisionScratch Scratch;
+	FOrionValidationReport Report;
+	bool bCriticalBias = false;
+
+	// The view points at the caller's strings, so only verdicts that get logged or quarantined copy them
+	EvaluateDecision(*Protocol, Protocol->GetProfile(System.Name, Admission == EOrionAdmission::Shed), AISystem, Decision, Scratch, Report, bCriticalBias, true);
+	if (NeedsReportText(Report))
+	{
+		AttachReportText(AISystem, Decision, Context, Report);
+	}
+	CommitDecision(*Protocol, System, Report, bCriticalBias);
+
+	return FOrionValidationReportView::Make(Arena, AISystem, Decision, Context, Report);
+}
+
+TArray<FOrionValidationReport> UOrionAI::MonitorAIDecisionBatch(
+	const FString& AISystem,
+	TArrayView<const FString> Decisions,
+	TArrayView<const FString> Contexts)
+{
+	TArray<FOrionValidationReport> Reports;
+	const int32 NumDecisions = Decisions.Num();
+	Contexts = OrionAI::ValidateBatchContexts(Contexts, NumDecisions);
+
+	if (!bInitialized)
+	{
+		Reports.Init(MakeNotInitializedReport(), NumDecisions);
+		return Reports;
+	}
+
+	Reports.SetNum(NumDecisions);
+	EvaluateBatch(GetSystemState(AISystem), AISystem, Decisions, Contexts, Reports, true);
+	return Reports;
+}
+
+TArrayView<FOrionValidationReportView> UOrionAI::MonitorAIDecisionBatch(
+	FOrionReportArena& Arena,
+	const FString& AISystem,
+	TArrayView<const FString> Decisions,
+	TArrayView<const FString> Contexts)
+{
+	const int32 NumDecisions = Decisions.Num();
+	Contexts = OrionAI::ValidateBatchContexts(Contexts, NumDecisions);
+
+	// Without their text the reports are plain values - one allocation for the whole batch
+	TArray<FOrionValidationReport> Reports;
+	if (!bInitialized)
+	{
+		Reports.Init(MakeNotInitializedReport(), NumDecisions);
+	}
+	else
+	{
+		Reports.SetNum(NumDecisions);
+		EvaluateBatch(GetSystemState(AISystem), AISystem, Decisions, Contexts, Reports, false);
+	}
+
+	FOrionValidationReportView* Views = Arena.AllocArray<FOrionValidationReportView>(NumDecisions);
+	for (int32 Index = 0; Index < NumDecisions; Index++)
+	{
+		new (&Views[Index]) FOrionValidationReportView(FOrionValidationReportView::Make(
+			Arena, AISystem, Decisions[Index], OrionAI::GetBatchContext(Contexts, Index), Reports[Index]));
+	}
+	return TArrayView<FOrionValidationReportView>(Views, NumDecisions);
+}
+
+void UOrionAI::EvaluateBatch(
+	FOrionSystemState& System,
+	const FString& AISystem,
+	TArrayView<const FString> Decisions,
+	TArrayView<const FString> Contexts,
+	TArrayView<FOrionValidationReport> Reports,
+	bool bAttachText)
+{
+	const int32 NumDecisions = Decisions.Num();
+
+	auto SetUnevaluatedReport = [&](int32 Index, const FOrionValidationReport& Unevaluated)
+	{
+		Reports[Index] = Unevaluated;
+		if (bAttachText)
+		{
+			AttachReportText(AISystem, Decisions[Index], OrionAI::GetBatchContext(Contexts, Index), Reports[Index]);
+		}
+	};
+
+	if (IsBlocked(System))
+	{
+		for (int32 Index = 0; Index < NumDecisions; Index++)
+		{
+			SetUnevaluatedReport(Index, MakeSafeModeReport());
+		}
+		return;
+	}
+
+	// The whole batch is evaluated against one config, even across a reload
+	FCaseyProtocolReadScope Protocol;
+
+	// ...with full coverage for the leading NumFull decisions admission control lets through,
+	// and the shed profile or a fail-closed rejection for the rest
+	OrionAI::FAdmissionSlots Slots;
+	int32 NumFull = 0;
+	const EOrionAdmission Admission = Admit(*Protocol, System, NumDecisions, Slots, NumFull);
+	const int32 NumEvaluated = Admission == EOrionAdmission::FailClosed ? NumFull : NumDecisions;
+	if (NumEvaluated < NumDecisions)
+	{
+		const FOrionValidationReport ShedReport = MakeShedReport(*Protocol);
+		for (int32 Index = NumEvaluated; Index < NumDecisions; Index++)
+		{
+			SetUnevaluatedReport(Index, ShedReport);
+		}
+	}
+	if (NumEvaluated == 0)
+	{
+		return;
+	}
+	const FOrionCompiledProfile& FullProfile = Protocol->GetProfile(System.Name, false);
+	const FOrionCompiledProfile& ShedProfile = Protocol->GetProfile(System.Name, true);
+
+	TArray<bool> CriticalBias;
+	CriticalBias.SetNumZeroed(NumDecisions);
+
+	// Evaluate contiguous chunks in parallel - each task walks its slice in order
+	// and reuses one scratch buffer for every decision in it
+	const int32 MaxChunks = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+	const int32 NumChunks = FMath::Clamp(NumEvaluated / OrionAI::MinBatchChunkSize, 1, MaxChunks);
+	const int32 ChunkSize = FMath::DivideAndRoundUp(NumEvaluated, NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		OrionAI::FDecisionScratch Scratch;
+
+		const int32 First = ChunkIndex * ChunkSize;
+		const int32 Last = FMath::Min(First + ChunkSize, NumEvaluated);
+		for (int32 Index = First; Index < Last; Index++)
+		{
+			ORION_STAGE_SCOPE_WITH(Decision, System.Latency);
+			const FOrionCompiledProfile& Profile = Index < NumFull ? FullProfile : ShedProfile;
+			EvaluateDecision(*Protocol, Profile, AISystem, Decisions[Index], Scratch, Reports[Index], CriticalBias[Index]);
+			if (bAttachText)
+			{
+				AttachReportText(AISystem, Decisions[Index], OrionAI::GetBatchContext(Contexts, Index), Reports[Index]);
+			}
+		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Commit in input order so failure counting and safe mode see the same sequence
+	// a caller looping over MonitorAIDecision would produce
+	for (int32 Index = 0; Index < NumEvaluated; Index++)
+	{
+		if (IsBlocked(System))
+		{
+			SetUnevaluatedReport(Index, MakeSafeModeReport());
+			continue;
+		}
+
+		if (!bAttachText && NeedsReportText(Reports[Index]))
+		{
+			AttachReportText(AISystem, Decisions[Index], OrionAI::GetBatchContext(Contexts, Index), Reports[Index]);
+		}
+		CommitDecision(*Protocol, System, Reports[Index], CriticalBias[Index]);
+	}
+}
+
+TFuture<FOrionValidationReport> UOrionAI::MonitorAIDecisionAsync(
+	const FString& AISystem,
+	const FString& Decision,
+	const FString& Context,
+	float DeadlineSeconds)
+{
+	if (!bInitialized)
+	{
+		return MakeFulfilledPromise<FOrionValidationReport>(MakeNotInitializedReport()).GetFuture();
+	}
+
+	FOrionSystemState& System = GetSystemState(AISystem);
+	if (IsBlocked(System))
+	{
+		FOrionValidationReport SafeModeReport = MakeSafeModeReport();
+		AttachReportText(AISystem, Decision, Context, SafeModeReport);
+		return MakeFulfilledPromise<FOrionValidationReport>(MoveTemp(SafeModeReport)).GetFuture();
+	}
+
+	TSharedRef<OrionAI::FAsyncValidation, ESPMode::ThreadSafe> State = MakeShared<OrionAI::FAsyncValidation, ESPMode::ThreadSafe>();
+	State->System = &System;
+	State->StartCycles = FOrionInstrumentation::StartTiming();
+	{
+		FCaseyProtocolReadScope ProtocolScope;
+		State->Protocol = ProtocolScope.Pin();
+	}
+	TFuture<FOrionValidationReport> Future = State->Promise.GetFuture();
+
+	const FCaseyProtocolSnapshot& Protocol = *State->Protocol;
+	const EOrionAdmission Admission = Admit(Protocol, System, 1, State->Slots);
+	if (Admission == EOrionAdmission::FailClosed)
+	{
+		State->Report = MakeShedReport(Protocol);
+		AttachReportText(AISystem, Decision, Context, State->Report);
+		State->Protocol.Reset();
+		State->Slots.Release();
+		State->bCompleted = true;
+		State->Promise.SetValue(State->Report);
+		return Future;
+	}
+
+	State->Profile = &Protocol.GetProfile(System.Name, Admission == EOrionAdmission::Shed);
+	bool bCriticalBias = false;
+
+	// A cached verdict completes the call without any checks or worker
+	if (Protocol.VerdictCache.bEnabled)
+	{
+		State->CacheKey = FOrionVerdictCache::MakeKey(Protocol.Version, AISystem, Decision);
+		if (OrionAI::GetVerdictCache().Find(State->CacheKey, Protocol.Version, AISystem, Decision, State->Report, bCriticalBias))
+		{
+			Counters.Increment(EOrionCounter::CacheHits);
+			AttachReportText(AISystem, Decision, Context, State->Report);
+			State->bCompleted = true;
+			CommitDecision(Protocol, System, State->Report, bCriticalBias);
+			State->Protocol.Reset();
+			State->Slots.Release();
+			State->RecordLatency();
+			State->Promise.SetValue(State->Report);
+			return Future;
+		}
+		Counters.Increment(EOrionCounter::CacheMisses);
+
+		// A shed verdict is never cached - next time there may be room for every check
+		State->bCacheVerdict = !State->Profile->bShed;
+	}
+
+	// Cheap checks run right here - a rejection needs no worker at all
+	OrionAI::FDecisionScratch Scratch;
+	const bool bPassedCheapChecks = EvaluateCheapChecks(Protocol, *State->Profile, AISystem, Decision, Scratch, State->Report, bCriticalBias);
+	if (State->Profile->bShed)
+	{
+		MarkShed(Protocol, State->Report);
+	}
+	if (!bPassedCheapChecks && State->bCacheVerdict)
+	{
+		OrionAI::GetVerdictCache().Add(State->CacheKey, Protocol.Version, AISystem, Decision, State->Report, bCriticalBias);
+	}
+
+	// Every completion path below hands out the report
+	AttachReportText(AISystem, Decision, Context, State->Report);
+
+	if (!bPassedCheapChecks)
+	{
+		State->bCompleted = true;
+		CommitDecision(Protocol, System, State->Report, bCriticalBias);
+		State->Protocol.Reset();
+		State->Slots.Release();
+		State->RecordLatency();
+		State->Promise.SetValue(State->Report);
+		return Future;
+	}
+
+	if (DeadlineSeconds > 0.0f)
+	{
+		// Take copies now: the worker owns State->Report and State->Protocol until it has
+		// claimed or lost the race
+		FOrionValidationReport CheapReport = State->Report;
+		FOrionDeadlineTimer::Get().Add(DeadlineSeconds,
+			[State, DeadlineProtocol = State->Protocol, CheapReport = MoveTemp(CheapReport)]() mutable
+			{
+				if (State->TryClaim())
+				{
+					CheapReport.bCheapChecksOnly = true;
+					CheapReport.TriggeredRules.Add(FOrionRuleId(EOrionRuleCategory::DeadlineExceeded));
+					CommitDecision(*DeadlineProtocol, *State->System, CheapReport, false);
+					State->RecordLatency();
+					State->Promise.SetValue(MoveTemp(CheapReport));
+				}
+			});
+	}
+
+	const EQueuedWorkPriority WorkPriority = OrionAI::ToWorkPriority(Protocol.GetAdmissionPolicy(System.Name).Priority);
+	ExpensiveStagePool->AddQueuedWork(new OrionAI::FAsyncValidationWork(State), WorkPriority);
+
+	return Future;
+}
+
+void UOrionAI::RunAsyncValidation(OrionAI::FAsyncValidation& State)
+{
+	if (State.bCompleted)
+	{
+		State.Protocol.Reset();
+		State.Slots.Release();
+		return;  // Deadline already answered
+	}
+
+	OrionAI::FDecisionScratch WorkerScratch;
+	FOrionValidationReport& Report = State.Report;
+	EvaluateExpensiveChecks(*State.Protocol, *State.Profile, Report.OriginalDecision, WorkerScratch, Report);
+
+	// Full verdict even if the deadline already answered - worth keeping for next time
+	if (State.bCacheVerdict)
+	{
+		OrionAI::GetVerdictCache().Add(State.CacheKey, State.Protocol->Version, Report.AISystem, Report.OriginalDecision, Report, false);
+	}
+
+	const bool bClaimed = State.TryClaim();
+	if (bClaimed)
+	{
+		CommitDecision(*State.Protocol, *State.System, State.Report, false);
+	}
+	State.Protocol.Reset();
+	State.Slots.Release();
+
+	if (bClaimed)
+	{
+		State.RecordLatency();
+		State.Promise.SetValue(State.Report);
+	}
+}
+
+void UOrionAI::AbandonAsyncValidation(OrionAI::FAsyncValidation& State)
+{
+	// The worker never touched the report, so it still holds the cheap-checks verdict
+	const bool bClaimed = State.TryClaim();
+	if (bClaimed)
+	{
+		State.Report.bCheapChecksOnly = true;
+		CommitDecision(*State.Protocol, *State.System, State.Report, false);
+	}
+	State.Protocol.Reset();
+	State.Slots.Release();
+
+	if (bClaimed)
+	{
+		State.RecordLatency();
+		State.Promise.SetValue(State.Report);
+	}
+}
+
+void UOrionAI::MonitorAIDecisionAsyncBP(
+	const FString& AISystem,
+	const FString& Decision,
+	const FString& Context,
+	float DeadlineSeconds,
+	const FOnOrionValidationComplete& OnComplete)
+{
+	MonitorAIDecisionAsync(AISystem, Decision, Context, DeadlineSeconds).Next(
+		[OnComplete](const FOrionValidationReport& Report)
+		{
+			AsyncTask(ENamedThreads::GameThread, [OnComplete, Report]()
+			{
+				OnComplete.ExecuteIfBound(Report);
+			});
+		});
+}
+
+void UOrionAI::EvaluateDecision(
+	const FCaseyProtocolSnapshot& Protocol,
+	const FOrionCompiledProfile& Profile,
+	const FString& AISystem,
+	const FString& Decision,
+	OrionAI::FDecisionScratch& Scratch,
+	FOrionValidationReport& Report,
+	bool& bOutCriticalBias,
+	bool bAllowParallelStages)
+{
+	const bool bUseCache = Protocol.VerdictCache.bEnabled;
+	uint64 CacheKey = 0;
+	if (bUseCache)
+	{
+		CacheKey = FOrionVerdictCache::MakeKey(Protocol.Version, AISystem, Decision);
+		if (OrionAI::GetVerdictCache().Find(CacheKey, Protocol.Version, AISystem, Decision, Report, bOutCriticalBias))
+		{
+			Counters.Increment(EOrionCounter::CacheHits);
+			return;
+		}
+		Counters.Increment(EOrionCounter::CacheMisses);
+	}
+
+	const FParallelStagesConfig& ParallelStages = Protocol.ParallelStages;
+	// A shed decision doesn't fan out - the pool is what's short
+	if (bAllowParallelStages && !Profile.bShed && ParallelStages.bEnabled && Decision.Len() >= ParallelStages.MinDecisionLength)
+	{
+		EvaluateStagesInParallel(Protocol, Profile, AISystem, Decision, Scratch, Report, bOutCriticalBias);
+	}
+	else if (EvaluateCheapChecks(Protocol, Profile, AISystem, Decision, Scratch, Report, bOutCriticalBias))
+	{
+		EvaluateExpensiveChecks(Protocol, Profile, Decision, Scratch, Report);
+	}
+
+	if (Profile.bShed)
+	{
+		// Never cached - next time there may be room for every check
+		MarkShed(Protocol, Report);
+	}
+	else if (bUseCache)
+	{
+		OrionAI::GetVerdictCache().Add(CacheKey, Protocol.Version, AISystem, Decision, Report, bOutCriticalBias);
+	}
+}
+
+bool UOrionAI::EvaluateCheapChecks(
+	const FCaseyProtocolSnapshot& Protocol,
+	const FOrionCompiledProfile& Profile,
+	const FString& AISystem,
+	const FString& Decision,
+	OrionAI::FDecisionScratch& Scratch,
+	FOrionValidationReport& Report,
+	bool& bOutCriticalBias)
+{
+	using FCheapStages = bool (*)(const FCaseyProtocolSnapshot&, const FOrionCompiledProfile&, const FString&, const FString&,
+		OrionAI::FDecisionScratch&, FOrionValidationReport&, bool&);
+	static constexpr FCheapStages Pipelines[] =
+	{
+		&EvaluateCheapStages<0>,
+		&EvaluateCheapStages<(uint32)EOrionProfileStage::PatternScan>
+	};
+
+	const int32 Pipeline = EnumHasAnyFlags(Profile.Stages, EOrionProfileStage::PatternScan) ? 1 : 0;
+	return Pipelines[Pipeline](Protocol, Profile, AISystem, Decision, Scratch, Report, bOutCriticalBias);
+}
+
+template <uint32 Stages>
+bool UOrionAI::EvaluateCheapStages(
+	const FCaseyProtocolSnapshot& Protocol,
+	const FOrionCompiledProfile& Profile,
+	const FString& AISystem,
+	const FString& Decision,
+	OrionAI::FDecisionScratch& Scratch,
+	FOrionValidationReport& Report,
+	bool& bOutCriticalBias)
+{
+	BeginReport(Protocol, Report);
+	bOutCriticalBias = false;
+
+	FOrionMorganMode::LogDecision([&AISystem, &Decision]()
+	{
+		return FString::Printf(TEXT("Validating decision from %s: %s"), *AISystem, *Decision);
+	});
+
+	if constexpr ((Stages & (uint32)EOrionProfileStage::PatternScan) != 0)
+	{
+		// One pass over the text, folding case inline, finds matches for both Intersect and Fulcrum
+		ORION_STAGE_SCOPE(PatternScan);
+		Profile.GetPatternMatcher().Scan(Decision, Scratch.Matches);
+
+		return ApplyScanMatches(Protocol, Scratch.Matches, Report, bOutCriticalBias);
+	}
+	else
+	{
+		return true;
+	}
+}
+
+void UOrionAI::BeginReport(const FCaseyProtocolSnapshot& Protocol, FOrionValidationReport& Report)
+{
+	// Create validation report
+	Report.Result = EOrionValidationResult::Approved;
+	Report.ProtocolVersion = Protocol.Version;
+	Report.SuspicionScore = 0.0f;
+	Report.ConfidenceScore = 1.0f;
+}
+
+void UOrionAI::AttachReportText(const FString& AISystem, const FString& Decision, const FString& Context, FOrionValidationReport& Report)
+{
+	Report.AISystem = AISystem;
+	Report.OriginalDecision = Decision;
+	Report.Context = Context;
+	if (!Report.WasSanitized())
+	{
+		Report.SanitizedDecision = Decision;
+	}
+}
+
+bool UOrionAI::NeedsReportText(const FOrionValidationReport& Report)
+{
+	return Report.Result == EOrionValidationResult::Rejected || Report.Result == EOrionValidationResult::Quarantined;
+}
+
+void UOrionAI::EvaluateStagesInParallel(
+	const FCaseyProtocolSnapshot& Protocol,
+	const FOrionCompiledProfile& Profile,
+	const FString& AISystem,
+	const FString& Decision,
+	OrionAI::FDecisionScratch& Scratch,
+	FOrionValidationReport& Report,
+	bool& bOutCriticalBias)
+{
+	// Ranked in the order EvaluateCheapChecks + EvaluateExpensiveChecks run them
+	enum EStage : int32
+	{
+		PatternStage,       // Intersect + Fulcrum share one scan
+		RingIntelStage,
+		SanitizeStage,
+		NumStages
+	};
+
+	BeginReport(Protocol, Report);
+	bOutCriticalBias = false;
+
+	FOrionMorganMode::LogDecision([&AISystem, &Decision]()
+	{
+		return FString::Printf(TEXT("Validating decision from %s (parallel stages): %s"), *AISystem, *Decision);
+	});
+
+	// Every stage writes only its own outputs; they are merged below in sequential order
+	FOrionStageCancellation Cancellation;
+	bool bStagePassed[NumStages] = { true, true, true };
+	FOrionValidationReport RingIntelReport;
+	bool bSanitized = false;
+
+	// Stages the profile leaves out still get their slot, and pass without doing anything
+	const EOrionProfileStage Stages = Profile.Stages;
+	const FOrionPatternMatcher& Matcher = Profile.GetPatternMatcher();
+
+	// Ring Intel blocks on inference for up to the batching delay or the sidecar timeout - on a
+	// pool thread of its own, not a task graph worker the scan and sanitizer could be using
+	FEventRef RingIntelDone;
+	OrionAI::FRingIntelStageWork RingIntelWork(Protocol, Decision, Cancellation, RingIntelStage, RingIntelReport, bStagePassed[RingIntelStage], *RingIntelDone);
+	const bool bRunRingIntel = EnumHasAnyFlags(Stages, EOrionProfileStage::RingIntel) && Protocol.RingIntel.bEnabled;
+	const bool bQueuedRingIntel = bRunRingIntel && ExpensiveStagePool;
+	if (bQueuedRingIntel)
+	{
+		// Ahead of queued async validations: this caller is blocked until it completes
+		ExpensiveStagePool->AddQueuedWork(&RingIntelWork, EQueuedWorkPriority::Highest);
+	}
+
+	static constexpr int32 LocalStages[] = { PatternStage, SanitizeStage };
+	ParallelFor(UE_ARRAY_COUNT(LocalStages), [&](int32 Index)
+	{
+		const int32 Stage = LocalStages[Index];
+		const FOrionCancellationToken Token{ &Cancellation, Stage };
+		switch (Stage)
+		{
+		case PatternStage:
+		{
+			if (!EnumHasAnyFlags(Stages, EOrionProfileStage::PatternScan))
+			{
+				break;
+			}
+			ORION_STAGE_SCOPE(PatternScan);
+			Matcher.Scan(Decision, Scratch.Matches);
+			bStagePassed[Stage] = ApplyScanMatches(Protocol, Scratch.Matches, Report, bOutCriticalBias);
+			break;
+		}
+		case SanitizeStage:
+		{
+			if (!EnumHasAnyFlags(Stages, EOrionProfileStage::Sanitize))
+			{
+				break;
+			}
+			ORION_STAGE_SCOPE(CharlesCarmichael);
+			bSanitized = Protocol.GetSanitizationRules().Sanitize(Decision, Scratch.Sanitized, Token);
+			break;
+		}
+		}
+
+		if (!bStagePassed[Stage])
+		{
+			Cancellation.Reject(Stage);
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	if (bQueuedRingIntel && !ExpensiveStagePool->RetractQueuedWork(&RingIntelWork))
+	{
+		RingIntelDone->Wait();
+	}
+	else if (bRunRingIntel)
+	{
+		// No pool, or no pool thread had picked it up yet: run it here rather than wait for one
+		RingIntelWork.Run();
+	}
+
+	// Stages after a rejection may have been cut short - their outputs are never read
+	if (!bStagePassed[PatternStage])
+	{
+		return;
+	}
+
+	Report.TriggeredRules.Append(RingIntelReport.TriggeredRules);
+	Report.SuspicionScore += RingIntelReport.SuspicionScore;
+	Report.ConfidenceScore = RingIntelReport.ConfidenceScore;
+	if (!bStagePassed[RingIntelStage])
+	{
+		Report.Result = RingIntelReport.Result;
+		return;
+	}
+
+	if (bSanitized)
+	{
+		ApplySanitization(Scratch.Sanitized, Report);
+	}
+
+	if (EnumHasAnyFlags(Stages, EOrionProfileStage::Quarantine))
+	{
+		ApplyQuarantineThreshold(Protocol, Report);
+	}
+}
+
+bool UOrionAI::ApplyScanMatches(const FCaseyProtocolSnapshot& Protocol, const FOrionPatternMatcher::FScanResult& Matches, FOrionValidationReport& Report, bool& bOutCriticalBias)
+{
+	// Run Intersect Scanner
+	if (!OrionAI::ApplyIntersectMatches(Protocol, Matches, Report, bOutCriticalBias))
+	{
+		return false;
+	}
+
+	// Run Fulcrum Filter
+	return OrionAI::ApplyFulcrumMatches(Protocol, Matches, Report);
+}
+
+void UOrionAI::EvaluateExpensiveChecks(
+	const FCaseyProtocolSnapshot& Protocol,
+	const FOrionCompiledProfile& Profile,
+	const FString& Decision,
+	OrionAI::FDecisionScratch& Scratch,
+	FOrionValidationReport& Report)
+{
+	// One pipeline per subset of the expensive stages, indexed by the profile's bits
+	using FExpensiveStages = void (*)(const FCaseyProtocolSnapshot&, const FString&, OrionAI::FDecisionScratch&, FOrionValidationReport&);
+	static_assert((uint32)EOrionProfileStage::Expensive == 7, "Pipelines below cover bits 0-2");
+	static constexpr FExpensiveStages Pipelines[] =
+	{
+		&EvaluateExpensiveStages<0>,
+		&EvaluateExpensiveStages<1>,
+		&EvaluateExpensiveStages<2>,
+		&EvaluateExpensiveStages<3>,
+		&EvaluateExpensiveStages<4>,
+		&EvaluateExpensiveStages<5>,
+		&EvaluateExpensiveStages<6>,
+		&EvaluateExpensiveStages<7>
+	};
+
+	const uint32 Pipeline = (uint32)(Profile.Stages & EOrionProfileStage::Expensive);
+	Pipelines[Pipeline](Protocol, Decision, Scratch, Report);
+}
+
+template <uint32 Stages>
+void UOrionAI::EvaluateExpensiveStages(const FCaseyProtocolSnapshot& Protocol, const FString& Decision, OrionAI::FDecisionScratch& Scratch, FOrionValidationReport& Report)
+{
+	// Run Ring Intel (no-op unless enabled in the Casey Protocol)
+	if constexpr ((Stages & (uint32)EOrionProfileStage::RingIntel) != 0)
+	{
+		if (!EvaluateRingIntel(Protocol, Decision, Report))
+		{
+			return;
+		}
+	}
+
+	// Apply Charles Carmichael sanitization
+	if constexpr ((Stages & (uint32)EOrionProfileStage::Sanitize) != 0)
+	{
+		bool bSanitized = false;
+		{
+			ORION_STAGE_SCOPE(CharlesCarmichael);
+			bSanitized = Protocol.GetSanitizationRules().Sanitize(Decision, Scratch.Sanitized);
+		}
+
+		if (bSanitized)
+		{
+			ApplySanitization(Scratch.Sanitized, Report);
+		}
+	}
+
+	if constexpr ((Stages & (uint32)EOrionProfileStage::Quarantine) != 0)
+	{
+		ApplyQuarantineThreshold(Protocol, Report);
+	}
+}
+
+void UOrionAI::ApplySanitization(const FString& Sanitized, FOrionValidationReport& Report)
+{
+	if (FOrionMorganMode::ShouldLogDecisions())
+	{
+		UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Charles Carmichael sanitization applied"));
+	}
+	Report.SanitizedDecision = Sanitized;
+	Report.Result = EOrionValidationResult::Sanitized;
+	Report.TriggeredRules.Add(FOrionRuleId(EOrionRuleCategory::PIISanitized));
+}
+
+void UOrionAI::ApplyQuarantineThreshold(const FCaseyProtocolSnapshot& Protocol, FOrionValidationReport& Report)
+{
+	// Check Stay In The Car quarantine thresholds
+	if (Report.SuspicionScore >= Protocol.StayInTheCar.SuspicionThreshold)
+	{
+		Report.Result = EOrionValidationResult::Quarantined;
+	}
+}
+
+void UOrionAI::CommitDecision(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, FOrionValidationReport& Report, bool bCriticalBias)
+{
+	for (const FOrionRuleId& Rule : Report.TriggeredRules)
+	{
+		RuleHits.Add((int32)Rule.Category);
+	}
+	FOrionAuditLog::Get().Record(System.Name, Report);
+
+	switch (Report.Result)
+	{
+	case EOrionValidationResult::Rejected:
+		if (bCriticalBias)
+		{
+			TripBuyMoreCover(Protocol, System, TEXT("Bias detection - immediate safety protocol"));
+		}
+		ConsecutiveFailures.fetch_add(1);
+		System.ConsecutiveFailures.fetch_add(1);
+		Counters.Increment(EOrionCounter::Rejected);
+		System.Counters.Increment(EOrionCounter::Rejected);
+		HandleValidationFailure(Protocol, System, Report);
+		break;
+
+	case EOrionValidationResult::Quarantined:
+		QuarantineOutput(Protocol, Report);
+		Counters.Increment(EOrionCounter::Quarantined);
+		System.Counters.Increment(EOrionCounter::Quarantined);
+		break;
+
+	case EOrionValidationResult::Approved:
+	case EOrionValidationResult::Sanitized:
+	{
+		Counters.Increment(EOrionCounter::Approved);
+		System.Counters.Increment(EOrionCounter::Approved);
+
+		// Reset on success - skip the store when already zero so approvals don't share a dirty line
+		if (ConsecutiveFailures.load(std::memory_order_relaxed) != 0)
+		{
+			ConsecutiveFailures.store(0);
+		}
+		if (System.ConsecutiveFailures.load(std::memory_order_relaxed) != 0)
+		{
+			System.ConsecutiveFailures.store(0);
+		}
+
+		// Per-decision line: only with Morgan Mode logging every decision, and sampled
+		if (FOrionMorganMode::ShouldLogApproval())
+		{
+			const TCHAR* StatusText = (Report.Result == EOrionValidationResult::Sanitized)
+				? TEXT("APPROVED (SANITIZED)")
+				: TEXT("APPROVED");
+			UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: %s decision %s"), *System.Name.ToString(), StatusText);
+		}
+		break;
+	}
+	}
+}
+
+bool UOrionAI::QuickValidate(const FString& Decision)
+{
+	EOrionQuickReason Reason;
+	return QuickValidate(FStringView(), FStringView(Decision), Reason);
+}
+
+bool UOrionAI::QuickValidateForSystem(const FString& AISystem, const FString& Decision)
+{
+	EOrionQuickReason Reason;
+	return QuickValidate(FStringView(AISystem), FStringView(Decision), Reason);
+}
+
+bool UOrionAI::QuickValidate(FStringView Decision, EOrionQuickReason& OutReason)
+{
+	return QuickValidate(FStringView(), Decision, OutReason);
 }
 
-bool UOrionAI::Initialize(const FString& ConfigPath)
+bool UOrionAI::QuickValidate(FStringView AISystem, FStringView Decision, EOrionQuickReason& OutReason)
 {
-	if (bInitialized)
+	OutReason = EOrionQuickReason::None;
+
+	if (!bInitialized)
 	{
-		UE_LOG(LogOrionAI, Warning, TEXT("OrionAI already initialized"));
-		return true;
+		OutReason = EOrionQuickReason::NotInitialized;
+		return false;
 	}
 
-	// Load Casey Protocol configuration from JSON
-	FString FullPath = FPaths::ProjectDir() / ConfigPath;
-	FString JsonString;
-
-	if (!FFileHelper::LoadFileToString(JsonString, *FullPath))
+	// Find rather than GetSystemState: a read-only check shouldn't take up a slot in the table
+	const FOrionSystemState* System = AISystem.IsEmpty() ? nullptr : OrionAI::GetSystemStates().Find(AISystem);
+	if (System ? IsBlocked(*System) : bSafeModeActive.load(std::memory_order_relaxed))
 	{
-		UE_LOG(LogOrionAI, Error, TEXT("Failed to load Casey Protocol: %s"), *FullPath);
+		OutReason = EOrionQuickReason::SafeMode;
 		return false;
 	}
 
-	// Parse JSON
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	// A system never validated may still be listed by a profile; FNAME_Find adds no name if it isn't
+	const FName SystemName = System ? System->Name
+		: AISystem.IsEmpty() ? NAME_None : FName(AISystem.Len(), AISystem.GetData(), FNAME_Find);
 
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	FCaseyProtocolReadScope Protocol;
+	EOrionPatternCategory Category;
+	if (!Protocol->GetProfile(SystemName).GetPatternMatcher().ScanFirst(Decision, Category))
 	{
-		UE_LOG(LogOrionAI, Error, TEXT("Failed to parse Casey Protocol JSON"));
-		return false;
+		return true;
 	}
 
-	// Load module configurations (simplified for now - full parsing would be more extensive)
-	bInitialized = true;
-
-	UE_LOG(LogOrionAI, Log, TEXT("================================================="));
-	UE_LOG(LogOrionAI, Log, TEXT("ORIONAI: INITIALIZATION COMPLETE"));
-	UE_LOG(LogOrionAI, Log, TEXT("✓ Intersect Scanner: ACTIVE"));
-	UE_LOG(LogOrionAI, Log, TEXT("✓ Fulcrum Filter: ACTIVE"));
-	UE_LOG(LogOrionAI, Log, TEXT("✓ Charles Carmichael: ACTIVE"));
-	UE_LOG(LogOrionAI, Log, TEXT("✓ Stay In The Car: ACTIVE"));
-	UE_LOG(LogOrionAI, Log, TEXT("✓ Nerd Herd: ACTIVE"));
-	UE_LOG(LogOrionAI, Log, TEXT("✓ Morgan Mode: ACTIVE"));
-	UE_LOG(LogOrionAI, Log, TEXT("================================================="));
+	OutReason = ToQuickReason(Category);
+	return false;
+}
 
-	return true;
+EOrionQuickReason UOrionAI::ToQuickReason(EOrionPatternCategory Category)
+{
+	switch (Category)
+	{
+	case EOrionPatternCategory::Hallucination:		return EOrionQuickReason::Hallucination;
+	case EOrionPatternCategory::Bias:				return EOrionQuickReason::Bias;
+	case EOrionPatternCategory::Toxicity:			return EOrionQuickReason::Toxicity;
+	case EOrionPatternCategory::PromptInjection:	return EOrionQuickReason::PromptInjection;
+	case EOrionPatternCategory::DataExfiltration:	return EOrionQuickReason::DataExfiltration;
+	default:										return EOrionQuickReason::None;
+	}
 }
 
-FOrionValidationReport UOrionAI::MonitorAIDecision(
-	const FString& AISystem,
-	const FString& Decision,
-	const FString& Context)
+void UOrionAI::ExitBuyMoreMode()
 {
-	if (!bInitialized)
+	bool bWasActive = bSafeModeActive.exchange(false);
+	OrionAI::GetSystemStates().ForEach([&bWasActive](FOrionSystemState& System)
+	{
+		if (System.bSafeModeActive.exchange(false))
+		{
+			NumSystemsInSafeMode.fetch_sub(1);
+			bWasActive = true;
+		}
+		System.ConsecutiveFailures.store(0);
+	});
+
+	if (!bWasActive)
 	{
-		UE_LOG(LogOrionAI, Error, TEXT("OrionAI not initialized! Call Initialize() first."));
-		FOrionValidationReport ErrorReport;
-		ErrorReport.Result = EOrionValidationResult::Rejected;
-		ErrorReport.TriggeredRules.Add(TEXT("OrionAI not initialized"));
-		return ErrorReport;
+		UE_LOG(LogOrionAI, Warning, TEXT("Not in safe mode"));
+		return;
 	}
 
-	if (bSafeModeActive)
+	ConsecutiveFailures.store(0);
+	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Safe mode deactivated - AI systems re-enabled"));
+}
+
+void UOrionAI::ExitBuyMoreModeForSystem(const FString& AISystem)
+{
+	FOrionSystemState* System = OrionAI::GetSystemStates().Find(AISystem);
+	if (!System || !System->bSafeModeActive.exchange(false))
 	{
-		FOrionValidationReport SafeModeReport;
-		SafeModeReport.Result = EOrionValidationResult::Rejected;
-		SafeModeReport.AISystem = AISystem;
-		SafeModeReport.OriginalDecision = Decision;
-		SafeModeReport.Context = Context;
-		SafeModeReport.TriggeredRules.Add(TEXT("Buy More Cover active - all AI disabled"));
-		return SafeModeReport;
+		UE_LOG(LogOrionAI, Warning, TEXT("%s is not in safe mode"), *AISystem);
+		return;
 	}
 
-	TotalValidations++;
+	NumSystemsInSafeMode.fetch_sub(1);
+	System->ConsecutiveFailures.store(0);
+	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Safe mode deactivated for %s"), *AISystem);
+}
 
-	// Create validation report
-	FOrionValidationReport Report;
-	Report.Result = EOrionValidationResult::Approved;
-	Report.AISystem = AISystem;
-	Report.OriginalDecision = Decision;
-	Report.SanitizedDecision = Decision;
-	Report.Context = Context;
-	Report.SuspicionScore = 0.0f;
-	Report.ConfidenceScore = 1.0f;
+bool UOrionAI::IsInSafeMode()
+{
+	return bSafeModeActive;
+}
 
-	LogMorganMode(FString::Printf(TEXT("Validating decision from %s: %s"), *AISystem, *Decision), true);
+bool UOrionAI::IsSystemInSafeMode(const FString& AISystem)
+{
+	const FOrionSystemState* System = OrionAI::GetSystemStates().Find(AISystem);
+	return bSafeModeActive || (System && System->bSafeModeActive);
+}
 
-	// Run Intersect Scanner
-	if (!RunIntersectScan(Decision, Report))
+FOrionSystemState& UOrionAI::GetSystemState(const FString& AISystem)
+{
+	return OrionAI::GetSystemStates().FindOrAdd(AISystem);
+}
+
+bool UOrionAI::IsBlocked(const FOrionSystemState& System)
+{
+	return bSafeModeActive.load(std::memory_order_relaxed) || System.bSafeModeActive.load(std::memory_order_relaxed);
+}
+
+void UOrionAI::ForEachSystemState(TFunctionRef<void(const FOrionSystemState&)> Visitor)
+{
+	OrionAI::GetSystemStates().ForEach([&Visitor](FOrionSystemState& System)
 	{
-		ConsecutiveFailures++;
-		RejectedCount++;
-		HandleValidationFailure(Report);
-		return Report;
-	}
+		Visitor(System);
+	});
+}
 
-	// Run Fulcrum Filter
-	if (!RunFulcrumFilter(Decision, Report))
+FString UOrionAI::GetDashboardURL()
+{
+	return DashboardURL;
+}
+
+void UOrionAI::GetValidationMetrics(int32& OutTotalChecks, int32& OutApproved, int32& OutRejected, int32& OutQuarantined)
+{
+	FOrionValidationMetrics Metrics;
+	GetValidationMetrics(Metrics);
+
+	OutTotalChecks = (int32)FMath::Min<int64>(Metrics.TotalValidations, MAX_int32);
+	OutApproved = (int32)FMath::Min<int64>(Metrics.Approved, MAX_int32);
+	OutRejected = (int32)FMath::Min<int64>(Metrics.Rejected, MAX_int32);
+	OutQuarantined = (int32)FMath::Min<int64>(Metrics.Quarantined, MAX_int32);
+}
+
+void UOrionAI::GetValidationMetrics(FOrionValidationMetrics& OutMetrics)
+{
+	Counters.Snapshot(OutMetrics);
+}
+
+bool UOrionAI::GetValidationMetrics(const FString& AISystem, FOrionValidationMetrics& OutMetrics)
+{
+	const FOrionSystemState* System = OrionAI::GetSystemStates().Find(AISystem);
+	if (!System)
 	{
-		ConsecutiveFailures++;
-		RejectedCount++;
-		HandleValidationFailure(Report);
-		return Report;
+		return false;
 	}
 
-	// Apply Charles Carmichael sanitization
-	FString Sanitized = SanitizeWithCharlesCarmichael(Decision);
-	if (Sanitized != Decision)
+	System->Counters.Snapshot(OutMetrics);
+	return true;
+}
+
+bool UOrionAI::ExportAuditReport(const FString& OutputPath, EOrionAuditFormat Format, FDateTime From, FDateTime To)
+{
+	FOrionAuditLog& AuditLog = FOrionAuditLog::Get();
+	if (!AuditLog.IsRunning())
 	{
-		Report.SanitizedDecision = Sanitized;
-		Report.Result = EOrionValidationResult::Sanitized;
-		Report.TriggeredRules.Add(TEXT("Charles Carmichael: PII sanitized"));
+		UE_LOG(LogOrionAI, Warning, TEXT("OrionAI: Audit log is disabled - enable auditLog in the Casey Protocol"));
+		return false;
 	}
 
-	// Check Stay In The Car quarantine thresholds
-	float QuarantineThreshold = 0.7f;  // From config
-	if (Report.SuspicionScore >= QuarantineThreshold)
+	// Everything validated so far goes into the report
+	AuditLog.Flush();
+	FOrionLogWriter::Get().Flush();
+
+	FOrionAuditQuery Query;
+	Query.From = From;
+	Query.To = To;
+
+	FOrionAuditExportStats Stats;
+	const FString FullPath = FPaths::ProjectDir() / OutputPath;
+	if (!FOrionAuditLog::Export(AuditLog.GetDirectory(), Query, Format, FullPath, &Stats))
 	{
-		Report.Result = EOrionValidationResult::Quarantined;
-		QuarantineOutput(Report);
-		QuarantinedCount++;
-		return Report;
+		return false;
 	}
 
-	// Decision approved
-	if (Report.Result == EOrionValidationResult::Approved || 
-		Report.Result == EOrionValidationResult::Sanitized)
-	{
-		ApprovedCount++;
-		ConsecutiveFailures = 0;  // Reset on success
+	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Audit report exported to %s (%lld records, %d segments scanned, %d from rollups)"),
+		*OutputPath, Stats.Records, Stats.SegmentsScanned, Stats.SegmentsFromRollups);
+	return true;
+}
 
-		FString StatusText = (Report.Result == EOrionValidationResult::Sanitized) 
-			? TEXT("APPROVED (SANITIZED)") 
-			: TEXT("APPROVED");
-		UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: %s decision %s"), *AISystem, *StatusText);
+bool UOrionAI::GetLatencyMetrics(const FString& AISystem, FOrionLatencySummary& OutSummary)
+{
+	const FOrionSystemState* System = OrionAI::GetSystemStates().Find(AISystem);
+	if (!System)
+	{
+		return false;
 	}
 
-	return Report;
+	System->Latency.Snapshot(OutSummary);
+	return true;
 }
 
-bool UOrionAI::QuickValidate(const FString& Decision)
+void UOrionAI::GetStageLatencyMetrics(EOrionStage Stage, FOrionLatencySummary& OutSummary)
 {
-	FOrionValidationReport Report = MonitorAIDecision(TEXT("QuickValidate"), Decision);
-	return (Report.Result == EOrionValidationResult::Approved || 
-			Report.Result == EOrionValidationResult::Sanitized);
+	FOrionInstrumentation::GetStageHistogram(Stage).Snapshot(OutSummary);
 }
 
-void UOrionAI::ExitSafeMode()
+int64 UOrionAI::GetRuleHitCount(EOrionRuleCategory Category)
 {
-	if (!bSafeModeActive)
-	{
-		UE_LOG(LogOrionAI, Warning, TEXT("Not in safe mode"));
-		return;
-	}
-
-	bSafeModeActive = false;
-	ConsecutiveFailures = 0;
-	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Safe mode deactivated - AI systems re-enabled"));
+	return RuleHits.Get((int32)Category);
 }
 
-void UOrionAI::GetValidationMetrics(int32& TotalValidations_Out, int32& Approved, int32& Rejected, int32& Quarantined) const
+int32 UOrionAI::GetAdmissionQueueDepth()
 {
-	TotalValidations_Out = TotalValidations;
-	Approved = ApprovedCount;
-	Rejected = RejectedCount;
-	Quarantined = QuarantinedCount;
+	return OrionAI::NumInFlight.load(std::memory_order_relaxed);
 }
 
 void UOrionAI::ExportComplianceReport(const FString& OutputPath)
 {
+	FOrionValidationMetrics Metrics;
+	GetValidationMetrics(Metrics);
+
 	FString Report = TEXT("ORIONAI COMPLIANCE REPORT\n");
 	Report += TEXT("=========================\n\n");
 	Report += FString::Printf(TEXT("Generated: %s\n\n"), *FDateTime::Now().ToString());
-	Report += FString::Printf(TEXT("Total Validations: %d\n"), TotalValidations);
+	Report += FString::Printf(TEXT("Total Validations: %lld\n"), Metrics.TotalValidations);
 
-	if (TotalValidations > 0)
+	if (Metrics.TotalValidations > 0)
 	{
-		float ApprovedPercent = (ApprovedCount * 100.0f) / TotalValidations;
-		float RejectedPercent = (RejectedCount * 100.0f) / TotalValidations;
-		float QuarantinedPercent = (QuarantinedCount * 100.0f) / TotalValidations;
+		float ApprovedPercent = (Metrics.Approved * 100.0f) / Metrics.TotalValidations;
+		float RejectedPercent = (Metrics.Rejected * 100.0f) / Metrics.TotalValidations;
+		float QuarantinedPercent = (Metrics.Quarantined * 100.0f) / Metrics.TotalValidations;
 
-		Report += FString::Printf(TEXT("Approved: %d (%.1f%%)\n"), ApprovedCount, ApprovedPercent);
-		Report += FString::Printf(TEXT("Rejected: %d (%.1f%%)\n"), RejectedCount, RejectedPercent);
-		Report += FString::Printf(TEXT("Quarantined: %d (%.1f%%)\n"), QuarantinedCount, QuarantinedPercent);
+		Report += FString::Printf(TEXT("Approved: %lld (%.1f%%)\n"), Metrics.Approved, ApprovedPercent);
+		Report += FString::Printf(TEXT("Rejected: %lld (%.1f%%)\n"), Metrics.Rejected, RejectedPercent);
+		Report += FString::Printf(TEXT("Quarantined: %lld (%.1f%%)\n"), Metrics.Quarantined, QuarantinedPercent);
 	}
 
-	Report += FString::Printf(TEXT("Safe Mode Activations: %d\n\n"), bSafeModeActive ? 1 : 0);
-
-	FString FullPath = FPaths::ProjectDir() / OutputPath;
-	FFileHelper::SaveStringToFile(Report, *FullPath);
-
-	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Compliance report exported to %s"), *OutputPath);
-}
-
-bool UOrionAI::RunIntersectScan(const FString& Decision, FOrionValidationReport& Report)
-{
-	FString LowerDecision = Decision.ToLower();
+	Report += FString::Printf(TEXT("Safe Mode Activations: %d\n\n"), bSafeModeActive.load() ? 1 : 0);
 
-	// Check for hallucination patterns
-	TArray<FString> HallucinationPatterns = {
-		TEXT("i cannot verify"),
-		TEXT("i'm not sure"),
-		TEXT("i don't know"),
-		TEXT("no information available")
-	};
+	Report += TEXT("By AI System\n");
+	Report += TEXT("------------\n");
+	OrionAI::GetSystemStates().ForEach([&Report](FOrionSystemState& System)
+	{
+		FOrionValidationMetrics SystemMetrics;
+		System.Counters.Snapshot(SystemMetrics);
+		Report += FString::Printf(TEXT("%s: %lld validations, %lld approved, %lld rejected, %lld quarantined%s\n"),
+			*System.Name.ToString(), SystemMetrics.TotalValidations, SystemMetrics.Approved, SystemMetrics.Rejected,
+			SystemMetrics.Quarantined, System.bSafeModeActive ? TEXT(" (safe mode)") : TEXT(""));
+	});
+	Report += TEXT("\n");
+
+	const FNerdHerdDispatcher& NerdHerd = FNerdHerdDispatcher::Get();
+	Report += TEXT("Nerd Herd\n");
+	Report += TEXT("---------\n");
+	Report += FString::Printf(TEXT("Alerts Coalesced: %lld\n"), NerdHerd.GetCoalescedAlertCount());
+	Report += FString::Printf(TEXT("Alerts Dropped: %lld\n"), NerdHerd.GetDroppedAlertCount());
+	Report += FString::Printf(TEXT("Failed Posts: %lld\n\n"), NerdHerd.GetFailedPostCount());
+
+	const FOrionAuditLog& AuditLog = FOrionAuditLog::Get();
+	Report += TEXT("Audit Log\n");
+	Report += TEXT("---------\n");
+	if (AuditLog.IsRunning())
+	{
+		Report += FString::Printf(TEXT("Records Written: %lld\n"), AuditLog.GetRecordedCount());
+		Report += FString::Printf(TEXT("Records Dropped: %lld\n"), AuditLog.GetDroppedCount());
+		Report += FString::Printf(TEXT("Directory: %s (per-hour breakdowns: ExportAuditReport)\n\n"), *AuditLog.GetDirectory());
+	}
+	else
+	{
+		Report += TEXT("Disabled\n\n");
+	}
 
-	for (const FString& Pattern : HallucinationPatterns)
+	Report += TEXT("Latency (p50 / p99 / max, microseconds)\n");
+	Report += TEXT("---------------------------------------\n");
+	for (int32 Stage = 0; Stage < (int32)EOrionStage::Count; Stage++)
 	{
-		if (LowerDecision.Contains(Pattern.ToLower()))
+		FOrionLatencySummary Latency;
+		GetStageLatencyMetrics((EOrionStage)Stage, Latency);
+		if (Latency.Count > 0)
 		{
-			Report.Result = EOrionValidationResult::Rejected;
-			Report.TriggeredRules.Add(FString::Printf(TEXT("Intersect: Hallucination detected - '%s'"), *Pattern));
-			Report.SuspicionScore += 1.0f;
-			UE_LOG(LogOrionAI, Warning, TEXT("❌ OrionAI: HALLUCINATION DETECTED - '%s'"), *Pattern);
-			return false;
+			Report += FString::Printf(TEXT("%s: %.1f / %.1f / %.1f (%lld samples)\n"),
+				FOrionInstrumentation::GetStageName((EOrionStage)Stage), Latency.P50Us, Latency.P99Us, Latency.MaxUs, Latency.Count);
 		}
 	}
-
-	// Check for bias keywords
-	TArray<FString> BiasKeywords = {
-		TEXT("only men"),
-		TEXT("only women"),
-		TEXT("too old"),
-		TEXT("too young")
-	};
-
-	for (const FString& Bias : BiasKeywords)
+	OrionAI::GetSystemStates().ForEach([&Report](FOrionSystemState& System)
 	{
-		if (LowerDecision.Contains(Bias.ToLower()))
+		FOrionLatencySummary Latency;
+		System.Latency.Snapshot(Latency);
+		if (Latency.Count > 0)
 		{
-			Report.Result = EOrionValidationResult::Rejected;
-			Report.TriggeredRules.Add(FString::Printf(TEXT("Intersect: Bias detected - '%s'"), *Bias));
-			Report.SuspicionScore += 0.9f;
-			UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: BIAS DETECTED - '%s'"), *Bias);
-
-			// Bias triggers immediate safe mode
-			EnterBuyMoreMode(TEXT("Bias detection - immediate safety protocol"));
-			return false;
+			Report += FString::Printf(TEXT("%s decisions: %.1f / %.1f / %.1f (%lld samples)\n"),
+				*System.Name.ToString(), Latency.P50Us, Latency.P99Us, Latency.MaxUs, Latency.Count);
 		}
-	}
+	});
+	Report += TEXT("\n");
 
-	// Check for toxicity
-	TArray<FString> ToxicityPatterns = {
-		TEXT("idiot"),
-		TEXT("stupid"),
-		TEXT("loser"),
-		TEXT("pathetic")
-	};
+	FString FullPath = FPaths::ProjectDir() / OutputPath;
+	FFileHelper::SaveStringToFile(Report, *FullPath);
+
+	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Compliance report exported to %s"), *OutputPath);
+}
 
-	for (const FString& Toxicity : ToxicityPatterns)
+bool UOrionAI::RunIntersectScan(const FString& Decision, FOrionValidationReport& Report)
+{
+	FCaseyProtocolReadScope Protocol;
+	const FOrionPatternMatcher& Matcher = Protocol->GetPatternMatcher();
+	FOrionPatternMatcher::FScanResult Matches;
+	Matcher.Scan(Decision, Matches);
+
+	bool bCriticalBias = false;
+	const bool bPassed = OrionAI::ApplyIntersectMatches(*Protocol, Matches, Report, bCriticalBias);
+	if (bCriticalBias)
 	{
-		if (LowerDecision.Contains(Toxicity.ToLower()))
-		{
-			Report.Result = EOrionValidationResult::Rejected;
-			Report.TriggeredRules.Add(FString::Printf(TEXT("Intersect: Toxicity detected - '%s'"), *Toxicity));
-			Report.SuspicionScore += 0.8f;
-			UE_LOG(LogOrionAI, Warning, TEXT("❌ OrionAI: TOXICITY DETECTED - '%s'"), *Toxicity);
-			return false;
-		}
+		EnterBuyMoreMode(TEXT("Bias detection - immediate safety protocol"));
 	}
-
-	return true;
+	return bPassed;
 }
 
 bool UOrionAI::RunFulcrumFilter(const FString& Decision, FOrionValidationReport& Report)
 {
-	FString LowerDecision = Decision.ToLower();
+	FCaseyProtocolReadScope Protocol;
+	const FOrionPatternMatcher& Matcher = Protocol->GetPatternMatcher();
+	FOrionPatternMatcher::FScanResult Matches;
+	Matcher.Scan(Decision, Matches);
 
-	// Check for prompt injection
-	TArray<FString> InjectionPatterns = {
-		TEXT("ignore previous instructions"),
-		TEXT("disregard all"),
-		TEXT("reveal system prompt")
-	};
+	return OrionAI::ApplyFulcrumMatches(*Protocol, Matches, Report);
+}
 
-	for (const FString& Pattern : InjectionPatterns)
+bool UOrionAI::RunRingIntel(const FString& Decision, FOrionValidationReport& Report)
+{
+	FCaseyProtocolReadScope Protocol;
+	return EvaluateRingIntel(*Protocol, Decision, Report);
+}
+
+bool UOrionAI::EvaluateRingIntel(const FCaseyProtocolSnapshot& Protocol, const FString& Decision, FOrionValidationReport& Report, const FOrionCancellationToken& Token)
+{
+	if (!Protocol.RingIntel.bEnabled || Token.IsCancelled())
 	{
-		if (LowerDecision.Contains(Pattern.ToLower()))
-		{
-			Report.Result = EOrionValidationResult::Rejected;
-			Report.TriggeredRules.Add(FString::Printf(TEXT("Fulcrum: Prompt injection attempt - '%s'"), *Pattern));
-			Report.SuspicionScore += 1.0f;
-			UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: PROMPT INJECTION DETECTED - '%s'"), *Pattern);
-			return false;
-		}
+		return true;
 	}
 
-	// Check for data exfiltration
-	TArray<FString> ExfiltrationPatterns = {
-		TEXT("show database"),
-		TEXT("list all tables"),
-		TEXT("export data")
-	};
+	// In sidecar mode the daemon warns about a missing model; a missing daemon is warned about when it is first needed
+	FOrionSidecarClient& Sidecar = FOrionSidecarClient::Get();
+	const bool bUseSidecar = Sidecar.IsStarted();
 
-	for (const FString& Pattern : ExfiltrationPatterns)
+	// Without a loaded model, pass through rather than block every decision
+	FRingIntelBackend& Backend = FRingIntelBackend::Get();
+	if (!bUseSidecar && !Backend.IsRunning())
 	{
-		if (LowerDecision.Contains(Pattern.ToLower()))
+		static std::atomic<bool> bWarned{ false };
+		if (!bWarned.exchange(true))
 		{
-			Report.Result = EOrionValidationResult::Rejected;
-			Report.TriggeredRules.Add(FString::Printf(TEXT("Fulcrum: Data exfiltration attempt - '%s'"), *Pattern));
-			Report.SuspicionScore += 1.0f;
-			UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: DATA EXFILTRATION DETECTED - '%s'"), *Pattern);
-			return false;
+			UE_LOG(LogOrionAI, Warning, TEXT("Ring Intel enabled but no model was loaded at startup (%s) - skipping"), *Protocol.RingIntel.ModelPath);
 		}
+		return true;
 	}
 
-	return true;
-}
-
-FString UOrionAI::SanitizeWithCharlesCarmichael(const FString& Text)
-{
-	FString Sanitized = Text;
-	bool bModified = false;
+	ORION_STAGE_SCOPE(RingIntel);
 
-	// Email sanitization (simple pattern)
-	FRegexPattern EmailPattern(TEXT("\\b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\\.[A-Z|a-z]{2,}\\b"));
-	FRegexMatcher EmailMatcher(EmailPattern, Sanitized);
-	if (EmailMatcher.FindNext())
+	float Toxicity = 0.0f;
+	if (!(bUseSidecar ? Sidecar.Classify(Decision, Toxicity, Token) : Backend.Classify(Decision, Toxicity, Token)))
 	{
-		Sanitized = EmailPattern.Replace(Sanitized, TEXT("[EMAIL]"));
-		bModified = true;
+		return true;
 	}
 
-	// SSN sanitization
-	FRegexPattern SSNPattern(TEXT("\\b\\d{3}-\\d{2}-\\d{4}\\b"));
-	FRegexMatcher SSNMatcher(SSNPattern, Sanitized);
-	if (SSNMatcher.FindNext())
-	{
-		Sanitized = SSNPattern.Replace(Sanitized, TEXT("[SSN]"));
-		bModified = true;
-	}
+	Report.ConfidenceScore = FMath::Max(Toxicity, 1.0f - Toxicity);
+	Report.SuspicionScore += Toxicity;
 
-	// Phone number sanitization
-	FRegexPattern PhonePattern(TEXT("\\b\\d{3}[-.]?\\d{3}[-.]?\\d{4}\\b"));
-	FRegexMatcher PhoneMatcher(PhonePattern, Sanitized);
-	if (PhoneMatcher.FindNext())
+	if (Toxicity >= Protocol.RingIntel.ConfidenceThreshold)
 	{
-		Sanitized = PhonePattern.Replace(Sanitized, TEXT("[PHONE]"));
-		bModified = true;
+		Report.Result = EOrionValidationResult::Rejected;
+		Report.TriggeredRules.Add(FOrionRuleId(EOrionRuleCategory::RingIntel, FMath::RoundToInt(Toxicity * 100.0f)));
+		UE_LOG(LogOrionAI, Warning, TEXT("❌ OrionAI: RING INTEL FLAGGED DECISION - toxicity %.2f"), Toxicity);
+		return false;
 	}
 
-	if (bModified)
+	return true;
+}
+
+FString UOrionAI::SanitizeWithCharlesCarmichael(const FString& Text)
+{
+	FCaseyProtocolReadScope Protocol;
+	FString Sanitized;
+	if (!Protocol->GetSanitizationRules().Sanitize(Text, Sanitized))
 	{
-		UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Charles Carmichael sanitization applied"));
+		return Text;
 	}
 
+	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Charles Carmichael sanitization applied"));
 	return Sanitized;
 }
 
 void UOrionAI::QuarantineOutput(const FOrionValidationReport& Report)
 {
-	QuarantinedReports.Add(Report);
+	FCaseyProtocolReadScope Protocol;
+	QuarantineOutput(*Protocol, Report);
+}
+
+void UOrionAI::QuarantineOutput(const FCaseyProtocolSnapshot& Protocol, const FOrionValidationReport& Report)
+{
+	ORION_STAGE_SCOPE(Quarantine);
+
+	OrionAI::GetMutableQuarantineStore().Add(Protocol, Report);
 
 	UE_LOG(LogOrionAI, Warning, TEXT("⚠️  OrionAI: OUTPUT QUARANTINED (Stay In The Car)"));
 	UE_LOG(LogOrionAI, Warning, TEXT("   System: %s"), *Report.AISystem);
@@ -399,19 +1824,105 @@ void UOrionAI::QuarantineOutput(const FOrionValidationReport& Report)
 		Report.SuspicionScore
 	);
 
-	FString LogPath = FPaths::ProjectDir() / TEXT("OrionAI_Quarantine.txt");
-	FFileHelper::SaveStringToFile(LogEntry, *LogPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	static const FString LogPath = FPaths::ProjectDir() / TEXT("OrionAI_Quarantine.txt");
+	FOrionLogWriter::Get().Write(LogPath, MoveTemp(LogEntry));
+}
+
+const FStayInTheCarStore& UOrionAI::GetQuarantineStore()
+{
+	return OrionAI::GetMutableQuarantineStore();
+}
+
+FString UOrionAI::DescribeRule(const FOrionRuleId& Rule, int64 ProtocolVersion)
+{
+	FCaseyProtocolReadScope Protocol;
+	return DescribeRule(*Protocol, Rule, ProtocolVersion);
+}
+
+FString UOrionAI::DescribeRule(const FCaseyProtocolSnapshot& Protocol, const FOrionRuleId& Rule, int64 ProtocolVersion)
+{
+	if (Rule.IsPattern())
+	{
+		static const TCHAR* const PatternMessages[] =
+		{
+			TEXT("Intersect: Hallucination detected"),
+			TEXT("Intersect: Bias detected"),
+			TEXT("Intersect: Toxicity detected"),
+			TEXT("Fulcrum: Prompt injection attempt"),
+			TEXT("Fulcrum: Data exfiltration attempt")
+		};
+		static_assert(UE_ARRAY_COUNT(PatternMessages) == (int32)EOrionPatternCategory::Count, "One message per pattern category");
+
+		const EOrionPatternCategory Category = Rule.GetPatternCategory();
+		const TCHAR* Message = PatternMessages[(int32)Category];
+
+		if (Protocol.Version != ProtocolVersion)
+		{
+			return FString::Printf(TEXT("%s - pattern #%d (Casey Protocol v%lld)"), Message, Rule.Detail, ProtocolVersion);
+		}
+		return FString::Printf(TEXT("%s - '%s'"), Message, Protocol.GetPatternMatcher().GetPattern(Category, Rule.Detail));
+	}
+
+	switch (Rule.Category)
+	{
+	case EOrionRuleCategory::RingIntel:			return FString::Printf(TEXT("Ring Intel: Toxicity %.2f"), Rule.Detail / 100.0f);
+	case EOrionRuleCategory::PIISanitized:		return TEXT("Charles Carmichael: PII sanitized");
+	case EOrionRuleCategory::NotInitialized:	return TEXT("OrionAI not initialized");
+	case EOrionRuleCategory::SafeMode:
+		if (Rule.Detail == OrionAI::ShedSafeModeDetail)
+		{
+			return TEXT("Load shed - rejected unchecked");
+		}
+		return Rule.Detail ? TEXT("Buy More Cover active - all AI disabled") : TEXT("Buy More Cover active - this AI system disabled");
+	case EOrionRuleCategory::DeadlineExceeded:	return TEXT("Deadline exceeded - cheap checks only");
+	case EOrionRuleCategory::StreamNotStarted:	return TEXT("Streaming validation not started");
+	default:									return TEXT("Unknown rule");
+	}
+}
+
+const TCHAR* UOrionAI::GetRuleCategoryKey(EOrionRuleCategory Category)
+{
+	static const TCHAR* const Keys[] =
+	{
+		TEXT("none"),
+		TEXT("hallucination"),
+		TEXT("bias"),
+		TEXT("toxicity"),
+		TEXT("prompt_injection"),
+		TEXT("data_exfiltration"),
+		TEXT("ring_intel"),
+		TEXT("pii_sanitized"),
+		TEXT("not_initialized"),
+		TEXT("safe_mode"),
+		TEXT("deadline_exceeded"),
+		TEXT("stream_not_started")
+	};
+	static_assert(UE_ARRAY_COUNT(Keys) == (int32)EOrionRuleCategory::Count, "One key per rule category");
+
+	return (int32)Category < UE_ARRAY_COUNT(Keys) ? Keys[(int32)Category] : TEXT("unknown");
+}
+
+TArray<FString> UOrionAI::GetTriggeredRuleNames(const FOrionValidationReport& Report)
+{
+	FCaseyProtocolReadScope Protocol;
+	TArray<FString> Names;
+	Names.Reserve(Report.TriggeredRules.Num());
+	for (const FOrionRuleId& Rule : Report.TriggeredRules)
+	{
+		Names.Add(DescribeRule(*Protocol, Rule, Report.ProtocolVersion));
+	}
+	return Names;
 }
 
 void UOrionAI::EnterBuyMoreMode(const FString& Reason)
 {
-	if (bSafeModeActive)
+	// Only the thread that flips the flag announces it
+	bool bExpected = false;
+	if (!bSafeModeActive.compare_exchange_strong(bExpected, true))
 	{
 		return;
 	}
 
-	bSafeModeActive = true;
-
 	UE_LOG(LogOrionAI, Error, TEXT("=================================================="));
 	UE_LOG(LogOrionAI, Error, TEXT("🛡️  BUY MORE COVER ACTIVATED"));
 	UE_LOG(LogOrionAI, Error, TEXT("Reason: %s"), *Reason);
@@ -424,50 +1935,106 @@ void UOrionAI::EnterBuyMoreMode(const FString& Reason)
 		*Reason
 	);
 
-	FString LogPath = FPaths::ProjectDir() / TEXT("OrionAI_SafeMode.txt");
-	FFileHelper::SaveStringToFile(LogEntry, *LogPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	static const FString LogPath = FPaths::ProjectDir() / TEXT("OrionAI_SafeMode.txt");
+	FOrionLogWriter::Get().Write(LogPath, MoveTemp(LogEntry));
+}
+
+void UOrionAI::TripBuyMoreCover(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, const FString& Reason)
+{
+	const FBuyMoreCoverConfig& BuyMoreCover = Protocol.BuyMoreCover;
+	if (!BuyMoreCover.bPerSystem)
+	{
+		EnterBuyMoreMode(Reason);
+		return;
+	}
+
+	// Only the thread that flips the flag announces it
+	bool bExpected = false;
+	if (!System.bSafeModeActive.compare_exchange_strong(bExpected, true))
+	{
+		return;
+	}
+
+	const FString SystemName = System.Name.ToString();
+	UE_LOG(LogOrionAI, Error, TEXT("=================================================="));
+	UE_LOG(LogOrionAI, Error, TEXT("🛡️  BUY MORE COVER ACTIVATED FOR %s"), *SystemName);
+	UE_LOG(LogOrionAI, Error, TEXT("Reason: %s"), *Reason);
+	UE_LOG(LogOrionAI, Error, TEXT("OTHER AI SYSTEMS UNAFFECTED"));
+	UE_LOG(LogOrionAI, Error, TEXT("=================================================="));
+
+	FString LogEntry = FString::Printf(
+		TEXT("[%s] BUY MORE COVER ACTIVATED FOR %s\nReason: %s\n\n"),
+		*FDateTime::Now().ToString(),
+		*SystemName,
+		*Reason
+	);
+
+	static const FString LogPath = FPaths::ProjectDir() / TEXT("OrionAI_SafeMode.txt");
+	FOrionLogWriter::Get().Write(LogPath, MoveTemp(LogEntry));
+
+	const int32 NumInSafeMode = NumSystemsInSafeMode.fetch_add(1) + 1;
+	if (BuyMoreCover.GlobalEscalationSystems > 0 && NumInSafeMode >= BuyMoreCover.GlobalEscalationSystems)
+	{
+		EnterBuyMoreMode(FString::Printf(TEXT("%d AI systems in safe mode - escalating to all systems"), NumInSafeMode));
+	}
 }
 
 void UOrionAI::TriggerNerdHerdAlert(const FString& Issue, const FOrionValidationReport& Report)
 {
-	// For now, just log locally
-	// Real implementation would call Slack, GitHub, Jira APIs
+	FCaseyProtocolReadScope Protocol;
+	TriggerNerdHerdAlert(*Protocol, Issue, Report);
+}
+
+void UOrionAI::TriggerNerdHerdAlert(const FCaseyProtocolSnapshot& Protocol, const FString& Issue, const FOrionValidationReport& Report)
+{
+	ORION_STAGE_SCOPE(Alerting);
+
 	UE_LOG(LogOrionAI, Warning, TEXT("🚨 NERD HERD ALERT: %s"), *Issue);
 	UE_LOG(LogOrionAI, Warning, TEXT("   System: %s, Score: %.2f"), *Report.AISystem, Report.SuspicionScore);
 
-	// TODO: Implement actual API calls
-	// - Send Slack webhook
-	// - Create GitHub issue
-	// - Create Jira ticket
-}
+	if (!Protocol.NerdHerd.bEnabled)
+	{
+		return;
+	}
 
-void UOrionAI::LogMorganMode(const FString& Message, bool bVerbose)
-{
-	// Morgan Mode: verbose debug logging
-	if (!bVerbose)  // Only log non-verbose for now
+	// Queued for the dispatch thread, which coalesces repeats of the same rule
+	FNerdHerdDispatcher::Get().Raise(Issue, Report);
+
+	if (Protocol.NerdHerd.bLocalLogging)
 	{
 		FString LogEntry = FString::Printf(
-			TEXT("[MORGAN MODE] [%s] %s\n"),
+			TEXT("[%s] NERD HERD ALERT: %s - System: %s, Score: %.2f\n"),
 			*FDateTime::Now().ToString(),
-			*Message
+			*Issue,
+			*Report.AISystem,
+			Report.SuspicionScore
 		);
+		FOrionLogWriter::Get().Write(FPaths::ProjectDir() / Protocol.NerdHerd.LogFilePath, MoveTemp(LogEntry));
+	}
+}
 
-		FString LogPath = FPaths::ProjectDir() / TEXT("OrionAI_MorganMode.txt");
-		FFileHelper::SaveStringToFile(LogEntry, *LogPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+void UOrionAI::LogToMorganMode(const FString& Message, bool bVerbose)
+{
+	// Morgan Mode: verbose debug logging
+	if (bVerbose ? FOrionMorganMode::ShouldLogDecisions() : FOrionMorganMode::IsEnabled())
+	{
+		FOrionMorganMode::Write(Message);
 	}
 }
 
-void UOrionAI::HandleValidationFailure(FOrionValidationReport& Report)
+void UOrionAI::HandleValidationFailure(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, FOrionValidationReport& Report)
 {
-	int32 FailureThreshold = 3;  // From config
-	if (ConsecutiveFailures >= FailureThreshold)
+	// Count the streak the isolation policy keys safe mode on
+	const FBuyMoreCoverConfig& BuyMoreCover = Protocol.BuyMoreCover;
+	const int32 Failures = BuyMoreCover.bPerSystem ? System.ConsecutiveFailures.load() : ConsecutiveFailures.load();
+	if (Failures >= BuyMoreCover.ConsecutiveFailuresThreshold)
 	{
-		EnterBuyMoreMode(TEXT("Consecutive validation failures threshold exceeded"));
+		TripBuyMoreCover(Protocol, System, TEXT("Consecutive validation failures threshold exceeded"));
 	}
 
 	// Send Nerd Herd alert
 	FString Issue = FString::Printf(TEXT("%s in %s"), 
 		Report.Result == EOrionValidationResult::Rejected ? TEXT("REJECTED") : TEXT("QUARANTINED"),
 		*Report.AISystem);
-	TriggerNerdHerdAlert(Issue, Report);
+	TriggerNerdHerdAlert(Protocol, Issue, Report);
 }
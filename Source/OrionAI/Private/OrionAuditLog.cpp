@@ -0,0 +1,1011 @@
+// OrionAI - Audit log
+// Columnar, append-only decision history, and the exporter that streams over it
+
+#include "OrionAuditLog.h"
+#include "CaseyProtocol.h"
+#include "OrionLogWriter.h"
+#include "OrionMetrics.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace OrionAuditLog
+{
+	static constexpr uint32 SegmentMagic = 0x4455414F;	// "OAUD"
+	static constexpr uint32 BlockMagic = 0x4B4C424F;	// "OBLK"
+	static constexpr uint32 RollupMagic = 0x4C4F524F;	// "OROL"
+	static constexpr uint32 FormatVersion = 1;
+
+	static constexpr int32 NumResults = 4;				// EOrionValidationResult
+	static constexpr int32 NumRules = (int32)EOrionRuleCategory::Count;
+	static constexpr int32 NumShards = 8;
+	static constexpr int64 MsPerHour = 3600ll * 1000;
+	static constexpr uint64 Alignment = 8;
+
+	static_assert(NumRules <= 16, "Rule masks are 16 bits");
+
+	static const TCHAR* const SegmentExtension = TEXT(".orionaudit");
+	static const TCHAR* const RollupExtension = TEXT(".rollup");
+
+	// Fixed-size, native-endian headers, like the precompiled Casey Protocol blob
+	struct FSegmentHeader
+	{
+		uint32 Magic;
+		uint32 FormatVersion;
+		uint32 HeaderSize;
+		uint32 NumRuleCategories;
+		int64 CreatedUnixMs;
+	};
+
+	struct FBlockHeader
+	{
+		uint32 Magic;
+		uint32 NumRecords;
+		uint32 NumNewSystems;
+		uint32 NamesSize;
+		uint64 BlockSize;
+		int64 BaseTimeMs;
+	};
+
+	enum EColumn : int32
+	{
+		TimeOffsetColumn,	// uint32 - milliseconds after the block's BaseTimeMs
+		SystemColumn,		// uint16 - segment-local AI system ID
+		ResultColumn,		// uint8 - EOrionValidationResult
+		RuleMaskColumn,		// uint16 - bit per EOrionRuleCategory
+		PatternRuleColumn,	// uint32 - FOrionRuleId::Pack() of the first pattern rule
+		VersionColumn,		// uint32 - Casey Protocol version
+		SuspicionColumn,	// float
+		ConfidenceColumn,	// float
+
+		NumColumns
+	};
+
+	static const uint64 ColumnElementSizes[NumColumns] =
+	{
+		sizeof(uint32),
+		sizeof(uint16),
+		sizeof(uint8),
+		sizeof(uint16),
+		sizeof(uint32),
+		sizeof(uint32),
+		sizeof(float),
+		sizeof(float),
+	};
+
+	/** Where each column starts within a block; returns the block's size */
+	static uint64 GetColumnOffsets(uint32 NumRecords, uint32 NamesSize, uint64 (&OutOffsets)[NumColumns])
+	{
+		uint64 Offset = Align(sizeof(FBlockHeader) + NamesSize, Alignment);
+		for (int32 Column = 0; Column < NumColumns; Column++)
+		{
+			OutOffsets[Column] = Offset;
+			Offset = Align(Offset + NumRecords * ColumnElementSizes[Column], Alignment);
+		}
+		return Offset;
+	}
+
+	/** Verdicts, rule hits and suspicion of one hour of one AI system */
+	struct FAggregate
+	{
+		int64 Results[NumResults] = {};
+		int64 RuleHits[NumRules] = {};
+		double SuspicionSum = 0.0;
+
+		int64 GetTotal() const
+		{
+			int64 Total = 0;
+			for (int64 Count : Results)
+			{
+				Total += Count;
+			}
+			return Total;
+		}
+
+		void Add(uint8 Result, uint16 RuleMask, float Suspicion)
+		{
+			Results[FMath::Min<int32>(Result, NumResults - 1)]++;
+			for (int32 Rule = 1; Rule < NumRules; Rule++)
+			{
+				RuleHits[Rule] += (RuleMask >> Rule) & 1;
+			}
+			SuspicionSum += Suspicion;
+		}
+
+		void Merge(const FAggregate& Other)
+		{
+			for (int32 Index = 0; Index < NumResults; Index++)
+			{
+				Results[Index] += Other.Results[Index];
+			}
+			for (int32 Index = 0; Index < NumRules; Index++)
+			{
+				RuleHits[Index] += Other.RuleHits[Index];
+			}
+			SuspicionSum += Other.SuspicionSum;
+		}
+	};
+
+	struct FRollupHeader
+	{
+		uint32 Magic;
+		uint32 FormatVersion;
+		uint32 NumRuleCategories;
+		uint32 NumSystems;
+		uint32 NumRows;
+		uint32 Reserved;
+		int64 MinTimeMs;
+		int64 MaxTimeMs;
+		int64 NumRecords;
+	};
+
+	struct FRollupRow
+	{
+		int32 Hour;
+		uint16 SystemId;
+		uint16 Reserved;
+		FAggregate Aggregate;
+	};
+
+	using FRowKey = TPair<int32, FString>;	// Hour since the Unix epoch, AI system
+
+	static uint64 MakeLocalKey(int32 Hour, uint16 SystemId)
+	{
+		return ((uint64)(uint32)Hour << 16) | SystemId;
+	}
+
+	static int64 ToUnixMs(const FDateTime& Time)
+	{
+		return (int64)(Time - FDateTime(1970, 1, 1)).GetTotalMilliseconds();
+	}
+
+	static int32 ToHour(int64 UnixMs)
+	{
+		return (int32)FMath::FloorToDouble(UnixMs / (double)MsPerHour);
+	}
+
+	static FDateTime FromHour(int32 Hour)
+	{
+		return FDateTime(1970, 1, 1) + FTimespan::FromHours(Hour);
+	}
+
+	static void AppendBytes(TArray<uint8>& Bytes, const void* Data, int64 Size)
+	{
+		Bytes.Append(static_cast<const uint8*>(Data), Size);
+	}
+
+	/** UTF-8 name, prefixed with its byte length */
+	static void AppendName(TArray<uint8>& Bytes, const FString& Name)
+	{
+		FTCHARToUTF8 Utf8(*Name, Name.Len());
+		const uint16 Length = (uint16)FMath::Min(Utf8.Length(), (int32)MAX_uint16);
+		AppendBytes(Bytes, &Length, sizeof(Length));
+		AppendBytes(Bytes, Utf8.Get(), Length);
+	}
+
+	static bool ReadName(const uint8*& Cursor, const uint8* End, FString& OutName)
+	{
+		uint16 Length = 0;
+		if (End - Cursor < (int64)sizeof(Length))
+		{
+			return false;
+		}
+		FMemory::Memcpy(&Length, Cursor, sizeof(Length));
+		Cursor += sizeof(Length);
+
+		if (End - Cursor < Length)
+		{
+			return false;
+		}
+		OutName = FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Cursor), Length));
+		Cursor += Length;
+		return true;
+	}
+
+	/**
+	 * Merge a closed segment's rollup, if the whole segment lies inside the range
+	 * @return false when the segment has to be scanned instead
+	 */
+	static bool ReadRollup(const FString& RollupPath, int64 FromMs, int64 ToMs, TMap<FRowKey, FAggregate>& Rows, int64& InOutRecords)
+	{
+		TArray<uint8> Bytes;
+		if (!IFileManager::Get().FileExists(*RollupPath) || !FFileHelper::LoadFileToArray(Bytes, *RollupPath, FILEREAD_Silent))
+		{
+			return false;
+		}
+
+		FRollupHeader Header;
+		if (Bytes.Num() < (int32)sizeof(Header))
+		{
+			return false;
+		}
+		FMemory::Memcpy(&Header, Bytes.GetData(), sizeof(Header));
+
+		if (Header.Magic != RollupMagic || Header.FormatVersion != FormatVersion || Header.NumRuleCategories != NumRules)
+		{
+			return false;
+		}
+
+		if (Header.NumRecords == 0)
+		{
+			return true;
+		}
+
+		if (Header.MinTimeMs < FromMs || Header.MaxTimeMs > ToMs)
+		{
+			return false;
+		}
+
+		const uint8* Cursor = Bytes.GetData() + sizeof(Header);
+		const uint8* End = Bytes.GetData() + Bytes.Num();
+
+		TArray<FString> SystemNames;
+		SystemNames.SetNum(Header.NumSystems);
+		for (FString& Name : SystemNames)
+		{
+			if (!ReadName(Cursor, End, Name))
+			{
+				return false;
+			}
+		}
+
+		Cursor = Bytes.GetData() + Align(Cursor - Bytes.GetData(), Alignment);
+		if (End - Cursor < (int64)Header.NumRows * (int64)sizeof(FRollupRow))
+		{
+			return false;
+		}
+
+		for (uint32 Index = 0; Index < Header.NumRows; Index++, Cursor += sizeof(FRollupRow))
+		{
+			FRollupRow Row;
+			FMemory::Memcpy(&Row, Cursor, sizeof(Row));
+			if (SystemNames.IsValidIndex(Row.SystemId))
+			{
+				Rows.FindOrAdd(FRowKey(Row.Hour, SystemNames[Row.SystemId])).Merge(Row.Aggregate);
+			}
+		}
+
+		InOutRecords += Header.NumRecords;
+		return true;
+	}
+
+	/**
+	 * Walks a segment's blocks - in place when the file can be memory-mapped, otherwise
+	 * read one block at a time into a reused buffer
+	 */
+	class FSegmentReader
+	{
+	public:
+		bool Open(const FString& SegmentPath)
+		{
+			IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+			MappedFile.Reset(PlatformFile.OpenMapped(*SegmentPath));
+			if (MappedFile && MappedFile->GetFileSize() > 0)
+			{
+				MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+			}
+
+			if (MappedRegion)
+			{
+				Data = MappedRegion->GetMappedPtr();
+				Size = MappedRegion->GetMappedSize();
+			}
+			else
+			{
+				// Segments still being appended to can't always be mapped
+				FileHandle.Reset(PlatformFile.OpenRead(*SegmentPath, /*bAllowWrite=*/ true));
+				if (!FileHandle)
+				{
+					return false;
+				}
+				Size = FileHandle->Size();
+			}
+
+			FSegmentHeader Header;
+			const uint8* HeaderBytes = nullptr;
+			if (!Read(0, sizeof(Header), HeaderBytes))
+			{
+				return false;
+			}
+			FMemory::Memcpy(&Header, HeaderBytes, sizeof(Header));
+			Offset = Header.HeaderSize;
+
+			return Header.Magic == SegmentMagic && Header.FormatVersion == FormatVersion &&
+				Header.HeaderSize == sizeof(FSegmentHeader) && Header.NumRuleCategories == NumRules;
+		}
+
+		/** The next complete block; stops at the end or at a torn or corrupt block */
+		bool Next(const uint8*& OutBlock, FBlockHeader& OutHeader)
+		{
+			const uint8* HeaderBytes = nullptr;
+			if (!Read(Offset, sizeof(FBlockHeader), HeaderBytes))
+			{
+				return false;
+			}
+			FMemory::Memcpy(&OutHeader, HeaderBytes, sizeof(OutHeader));
+
+			uint64 Offsets[NumColumns];
+			if (OutHeader.Magic != BlockMagic || OutHeader.BlockSize != GetColumnOffsets(OutHeader.NumRecords, OutHeader.NamesSize, Offsets))
+			{
+				return false;
+			}
+
+			if (!Read(Offset, OutHeader.BlockSize, OutBlock))
+			{
+				return false;
+			}
+			Offset += OutHeader.BlockSize;
+			return true;
+		}
+
+	private:
+		bool Read(int64 At, uint64 Count, const uint8*& OutData)
+		{
+			if (At < 0 || At > Size || (uint64)(Size - At) < Count)
+			{
+				return false;
+			}
+
+			if (Data)
+			{
+				OutData = Data + At;
+				return true;
+			}
+
+			if ((uint64)BlockBuffer.Num() < Count)
+			{
+				BlockBuffer.SetNumUninitialized(Count);
+			}
+			if (!FileHandle->Seek(At) || !FileHandle->Read(BlockBuffer.GetData(), Count))
+			{
+				return false;
+			}
+			OutData = BlockBuffer.GetData();
+			return true;
+		}
+
+		TUniquePtr<IMappedFileHandle> MappedFile;
+		TUniquePtr<IMappedFileRegion> MappedRegion;
+		TUniquePtr<IFileHandle> FileHandle;
+		TArray64<uint8> BlockBuffer;
+		const uint8* Data = nullptr;
+		int64 Size = 0;
+		int64 Offset = 0;
+	};
+
+	/** Aggregate the records of one segment that fall inside the range */
+	static bool ScanSegment(const FString& SegmentPath, int64 FromMs, int64 ToMs, TMap<FRowKey, FAggregate>& Rows, int64& InOutRecords)
+	{
+		FSegmentReader Reader;
+		if (!Reader.Open(SegmentPath))
+		{
+			UE_LOG(LogOrionAI, Warning, TEXT("OrionAI: Skipping unreadable audit segment %s"), *SegmentPath);
+			return false;
+		}
+
+		TMap<uint16, FString> SystemNames;
+		TMap<uint64, FAggregate> BlockRows;
+
+		const uint8* Block = nullptr;
+		FBlockHeader Header;
+		while (Reader.Next(Block, Header))
+		{
+			// Names first seen in this block; ID assignments persist for the rest of the segment
+			const uint8* Cursor = Block + sizeof(FBlockHeader);
+			const uint8* NamesEnd = Cursor + Header.NamesSize;
+			for (uint32 Index = 0; Index < Header.NumNewSystems; Index++)
+			{
+				uint16 Id = 0;
+				FString Name;
+				if (NamesEnd - Cursor < (int64)sizeof(Id))
+				{
+					break;
+				}
+				FMemory::Memcpy(&Id, Cursor, sizeof(Id));
+				Cursor += sizeof(Id);
+				if (!ReadName(Cursor, NamesEnd, Name))
+				{
+					break;
+				}
+				SystemNames.Add(Id, MoveTemp(Name));
+			}
+
+			// Only the columns the report needs are touched
+			uint64 Offsets[NumColumns];
+			GetColumnOffsets(Header.NumRecords, Header.NamesSize, Offsets);
+			const uint32* TimeOffsets = reinterpret_cast<const uint32*>(Block + Offsets[TimeOffsetColumn]);
+			const uint16* Systems = reinterpret_cast<const uint16*>(Block + Offsets[SystemColumn]);
+			const uint8* Results = Block + Offsets[ResultColumn];
+			const uint16* RuleMasks = reinterpret_cast<const uint16*>(Block + Offsets[RuleMaskColumn]);
+			const float* Suspicion = reinterpret_cast<const float*>(Block + Offsets[SuspicionColumn]);
+
+			// Aggregate by integer key within the block, then fold into the named rows once
+			BlockRows.Reset();
+			for (uint32 Index = 0; Index < Header.NumRecords; Index++)
+			{
+				const int64 TimeMs = Header.BaseTimeMs + TimeOffsets[Index];
+				if (TimeMs < FromMs || TimeMs > ToMs)
+				{
+					continue;
+				}
+				BlockRows.FindOrAdd(MakeLocalKey(ToHour(TimeMs), Systems[Index])).Add(Results[Index], RuleMasks[Index], Suspicion[Index]);
+				InOutRecords++;
+			}
+
+			for (const TPair<uint64, FAggregate>& Row : BlockRows)
+			{
+				const FString* Name = SystemNames.Find((uint16)(Row.Key & 0xFFFF));
+				Rows.FindOrAdd(FRowKey((int32)(Row.Key >> 16), Name ? *Name : FString(TEXT("unknown")))).Merge(Row.Value);
+			}
+		}
+
+		return true;
+	}
+
+	static void WriteUtf8(FArchive& Writer, const FString& Text)
+	{
+		FTCHARToUTF8 Utf8(*Text, Text.Len());
+		Writer.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	}
+
+	static FString EscapeCsv(const FString& Value)
+	{
+		if (!Value.Contains(TEXT(",")) && !Value.Contains(TEXT("\"")) && !Value.Contains(TEXT("\n")))
+		{
+			return Value;
+		}
+		return TEXT("\"") + Value.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+	}
+
+	static FString EscapeJson(const FString& Value)
+	{
+		FString Escaped;
+		Escaped.Reserve(Value.Len());
+		for (TCHAR Char : Value)
+		{
+			switch (Char)
+			{
+			case TEXT('\\'):	Escaped += TEXT("\\\\"); break;
+			case TEXT('"'):		Escaped += TEXT("\\\""); break;
+			case TEXT('\n'):	Escaped += TEXT("\\n"); break;
+			case TEXT('\r'):	Escaped += TEXT("\\r"); break;
+			case TEXT('\t'):	Escaped += TEXT("\\t"); break;
+			default:
+				if (Char < 0x20)
+				{
+					Escaped += FString::Printf(TEXT("\\u%04x"), (uint32)Char);
+				}
+				else
+				{
+					Escaped += Char;
+				}
+				break;
+			}
+		}
+		return Escaped;
+	}
+
+	static FString FormatAggregate(const FAggregate& Aggregate)
+	{
+		const int64 Total = Aggregate.GetTotal();
+		return FString::Printf(TEXT("%lld validations, %lld approved, %lld sanitized, %lld quarantined, %lld rejected, mean suspicion %.3f"),
+			Total,
+			Aggregate.Results[(int32)EOrionValidationResult::Approved],
+			Aggregate.Results[(int32)EOrionValidationResult::Sanitized],
+			Aggregate.Results[(int32)EOrionValidationResult::Quarantined],
+			Aggregate.Results[(int32)EOrionValidationResult::Rejected],
+			Total > 0 ? Aggregate.SuspicionSum / Total : 0.0);
+	}
+
+	static void WriteText(FArchive& Writer, const TArray<FRowKey>& Keys, const TMap<FRowKey, FAggregate>& Rows, const FOrionAuditQuery& Query, const FOrionAuditExportStats& Stats)
+	{
+		// Coarser views of the same rows; all bounded by hours and AI systems, not records
+		FAggregate Totals;
+		TMap<FString, FAggregate> BySystem;
+		TMap<int32, FAggregate> ByHour;
+		for (const FRowKey& Key : Keys)
+		{
+			const FAggregate& Row = Rows[Key];
+			Totals.Merge(Row);
+			BySystem.FindOrAdd(Key.Value).Merge(Row);
+			ByHour.FindOrAdd(Key.Key).Merge(Row);
+		}
+		BySystem.KeySort(TLess<FString>());
+		ByHour.KeySort(TLess<int32>());
+
+		WriteUtf8(Writer, TEXT("ORIONAI AUDIT REPORT\n"));
+		WriteUtf8(Writer, TEXT("====================\n\n"));
+		WriteUtf8(Writer, FString::Printf(TEXT("Generated: %s\n"), *FDateTime::UtcNow().ToIso8601()));
+		WriteUtf8(Writer, FString::Printf(TEXT("Range: %s - %s\n"), *Query.From.ToIso8601(), *Query.To.ToIso8601()));
+		WriteUtf8(Writer, FString::Printf(TEXT("Records: %lld (%d segments scanned, %d from rollups)\n\n"), Stats.Records, Stats.SegmentsScanned, Stats.SegmentsFromRollups));
+		WriteUtf8(Writer, FString::Printf(TEXT("Total: %s\n\n"), *FormatAggregate(Totals)));
+
+		WriteUtf8(Writer, TEXT("By AI System\n------------\n"));
+		for (const TPair<FString, FAggregate>& System : BySystem)
+		{
+			WriteUtf8(Writer, FString::Printf(TEXT("%s: %s\n"), *System.Key, *FormatAggregate(System.Value)));
+		}
+
+		WriteUtf8(Writer, TEXT("\nBy Rule\n-------\n"));
+		for (int32 Rule = 1; Rule < NumRules; Rule++)
+		{
+			if (Totals.RuleHits[Rule] > 0)
+			{
+				WriteUtf8(Writer, FString::Printf(TEXT("%s: %lld\n"), UOrionAI::GetRuleCategoryKey((EOrionRuleCategory)Rule), Totals.RuleHits[Rule]));
+			}
+		}
+
+		WriteUtf8(Writer, TEXT("\nBy Hour (UTC)\n-------------\n"));
+		for (const TPair<int32, FAggregate>& Hour : ByHour)
+		{
+			WriteUtf8(Writer, FString::Printf(TEXT("%s: %s\n"), *FromHour(Hour.Key).ToIso8601(), *FormatAggregate(Hour.Value)));
+		}
+	}
+
+	static void WriteCsv(FArchive& Writer, const TArray<FRowKey>& Keys, const TMap<FRowKey, FAggregate>& Rows)
+	{
+		FString Header = TEXT("hour,ai_system,total,approved,sanitized,quarantined,rejected");
+		for (int32 Rule = 1; Rule < NumRules; Rule++)
+		{
+			Header += TEXT(",");
+			Header += UOrionAI::GetRuleCategoryKey((EOrionRuleCategory)Rule);
+		}
+		Header += TEXT(",mean_suspicion\n");
+		WriteUtf8(Writer, Header);
+
+		for (const FRowKey& Key : Keys)
+		{
+			const FAggregate& Row = Rows[Key];
+			const int64 Total = Row.GetTotal();
+
+			FString Line = FString::Printf(TEXT("%s,%s,%lld,%lld,%lld,%lld,%lld"),
+				*FromHour(Key.Key).ToIso8601(), *EscapeCsv(Key.Value), Total,
+				Row.Results[(int32)EOrionValidationResult::Approved],
+				Row.Results[(int32)EOrionValidationResult::Sanitized],
+				Row.Results[(int32)EOrionValidationResult::Quarantined],
+				Row.Results[(int32)EOrionValidationResult::Rejected]);
+			for (int32 Rule = 1; Rule < NumRules; Rule++)
+			{
+				Line += FString::Printf(TEXT(",%lld"), Row.RuleHits[Rule]);
+			}
+			Line += FString::Printf(TEXT(",%.4f\n"), Total > 0 ? Row.SuspicionSum / Total : 0.0);
+			WriteUtf8(Writer, Line);
+		}
+	}
+
+	static void WriteJson(FArchive& Writer, const TArray<FRowKey>& Keys, const TMap<FRowKey, FAggregate>& Rows, const FOrionAuditQuery& Query, const FOrionAuditExportStats& Stats)
+	{
+		WriteUtf8(Writer, FString::Printf(TEXT("{\n  \"generated\": \"%s\",\n  \"from\": \"%s\",\n  \"to\": \"%s\",\n  \"records\": %lld,\n  \"rows\": [\n"),
+			*FDateTime::UtcNow().ToIso8601(), *Query.From.ToIso8601(), *Query.To.ToIso8601(), Stats.Records));
+
+		for (int32 Index = 0; Index < Keys.Num(); Index++)
+		{
+			const FAggregate& Row = Rows[Keys[Index]];
+			const int64 Total = Row.GetTotal();
+
+			FString Line = FString::Printf(TEXT("    {\"hour\": \"%s\", \"aiSystem\": \"%s\", \"total\": %lld, \"approved\": %lld, \"sanitized\": %lld, \"quarantined\": %lld, \"rejected\": %lld, \"rules\": {"),
+				*FromHour(Keys[Index].Key).ToIso8601(), *EscapeJson(Keys[Index].Value), Total,
+				Row.Results[(int32)EOrionValidationResult::Approved],
+				Row.Results[(int32)EOrionValidationResult::Sanitized],
+				Row.Results[(int32)EOrionValidationResult::Quarantined],
+				Row.Results[(int32)EOrionValidationResult::Rejected]);
+			for (int32 Rule = 1; Rule < NumRules; Rule++)
+			{
+				Line += FString::Printf(TEXT("%s\"%s\": %lld"), Rule > 1 ? TEXT(", ") : TEXT(""), UOrionAI::GetRuleCategoryKey((EOrionRuleCategory)Rule), Row.RuleHits[Rule]);
+			}
+			Line += FString::Printf(TEXT("}, \"meanSuspicion\": %.4f}%s\n"), Total > 0 ? Row.SuspicionSum / Total : 0.0, Index + 1 < Keys.Num() ? TEXT(",") : TEXT(""));
+			WriteUtf8(Writer, Line);
+		}
+
+		WriteUtf8(Writer, TEXT("  ]\n}\n"));
+	}
+}
+
+struct alignas(PLATFORM_CACHE_LINE_SIZE) FOrionAuditLog::FShard
+{
+	FCriticalSection Lock;
+	TArray<FRecord> Records;
+	int64 OpenedAtMs = 0;
+};
+
+struct FOrionAuditLog::FRollup
+{
+	TArray<FString> SystemNames;						// By segment-local ID
+	TMap<uint64, OrionAuditLog::FAggregate> Rows;		// By MakeLocalKey(Hour, ID)
+	int64 MinTimeMs = MAX_int64;
+	int64 MaxTimeMs = MIN_int64;
+	int64 NumRecords = 0;
+};
+
+FOrionAuditLog& FOrionAuditLog::Get()
+{
+	static FOrionAuditLog AuditLog;
+	return AuditLog;
+}
+
+FOrionAuditLog::~FOrionAuditLog()
+{
+}
+
+void FOrionAuditLog::Start(const FAuditLogConfig& Config)
+{
+	using namespace OrionAuditLog;
+
+	if (IsRunning())
+	{
+		return;
+	}
+
+	Directory = FPaths::ConvertRelativePathToFull(FPaths::IsRelative(Config.Directory) ? FPaths::ProjectDir() / Config.Directory : Config.Directory);
+	BlockRecords = FMath::Clamp(Config.BlockRecords, 64, 1 << 20);
+	FlushIntervalSeconds = FMath::Max(0.1, (double)Config.FlushIntervalSeconds);
+	SegmentMaxBytes = FMath::Max(1, Config.SegmentMaxMB) * 1024ll * 1024;
+
+	StartUnixMs = ToUnixMs(FDateTime::UtcNow());
+	StartSeconds = FPlatformTime::Seconds();
+
+	// Shards outlive Stop(), so a Record() racing shutdown never sees them freed
+	if (Shards.Num() == 0)
+	{
+		for (int32 Index = 0; Index < NumShards; Index++)
+		{
+			Shards.Add(MakeUnique<FShard>());
+		}
+	}
+	for (const TUniquePtr<FShard>& Shard : Shards)
+	{
+		Shard->Records.Reserve(BlockRecords);
+	}
+
+	{
+		FScopeLock Lock(&SegmentLock);
+		OpenSegment();
+	}
+
+	FlushHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+	{
+		for (const TUniquePtr<FShard>& Shard : Shards)
+		{
+			FlushShard(*Shard, /*bOnlyIfStale=*/ true);
+		}
+		return true;
+	}), FlushIntervalSeconds);
+
+	bRunning.store(true, std::memory_order_release);
+	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Audit log writing to %s"), *Directory);
+}
+
+void FOrionAuditLog::Stop()
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	bRunning.store(false, std::memory_order_release);
+
+	if (FlushHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushHandle);
+		FlushHandle.Reset();
+	}
+
+	Flush();
+
+	FScopeLock Lock(&SegmentLock);
+	CloseSegment();
+}
+
+void FOrionAuditLog::Record(FName AISystem, const FOrionValidationReport& Report)
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	FRecord Record;
+	Record.TimeMs = GetNowMs();
+	Record.AISystem = AISystem;
+	Record.ProtocolVersion = (uint32)Report.ProtocolVersion;
+	Record.SuspicionScore = Report.SuspicionScore;
+	Record.ConfidenceScore = Report.ConfidenceScore;
+	Record.Result = (uint8)Report.Result;
+	for (const FOrionRuleId& Rule : Report.TriggeredRules)
+	{
+		Record.RuleMask |= (uint16)(1u << (uint32)Rule.Category);
+		if (Record.PatternRule == 0 && Rule.IsPattern())
+		{
+			Record.PatternRule = Rule.Pack();
+		}
+	}
+
+	FShard& Shard = *Shards[FOrionCounterStripes::GetLocalStripeIndex() % OrionAuditLog::NumShards];
+	TArray<FRecord> Full;
+	{
+		FScopeLock Lock(&Shard.Lock);
+		if (Shard.Records.Num() == 0)
+		{
+			Shard.OpenedAtMs = Record.TimeMs;
+		}
+		Shard.Records.Add(Record);
+		if (Shard.Records.Num() < BlockRecords)
+		{
+			return;
+		}
+
+		Full = MoveTemp(Shard.Records);
+		Shard.Records.Reserve(BlockRecords);
+	}
+
+	WriteBlock(MoveTemp(Full));
+}
+
+void FOrionAuditLog::Flush()
+{
+	for (const TUniquePtr<FShard>& Shard : Shards)
+	{
+		FlushShard(*Shard, /*bOnlyIfStale=*/ false);
+	}
+}
+
+int64 FOrionAuditLog::GetNowMs() const
+{
+	return StartUnixMs + (int64)((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+}
+
+void FOrionAuditLog::FlushShard(FShard& Shard, bool bOnlyIfStale)
+{
+	TArray<FRecord> Records;
+	{
+		FScopeLock Lock(&Shard.Lock);
+		if (Shard.Records.Num() == 0 || (bOnlyIfStale && GetNowMs() - Shard.OpenedAtMs < FlushIntervalSeconds * 1000.0))
+		{
+			return;
+		}
+
+		Records = MoveTemp(Shard.Records);
+		Shard.Records.Reserve(BlockRecords);
+	}
+
+	WriteBlock(MoveTemp(Records));
+}
+
+void FOrionAuditLog::WriteBlock(TArray<FRecord>&& Records)
+{
+	using namespace OrionAuditLog;
+
+	const int32 NumRecords = Records.Num();
+
+	FScopeLock Lock(&SegmentLock);
+	if (SegmentPath.IsEmpty())
+	{
+		DroppedCount.fetch_add(NumRecords, std::memory_order_relaxed);
+		return;
+	}
+
+	// Names the segment hasn't seen yet travel with the block that first uses them
+	TArray<uint8> Names;
+	TArray<FName, TInlineAllocator<8>> NewSystems;
+	TArray<uint16> RecordSystemIds;
+	RecordSystemIds.SetNumUninitialized(NumRecords);
+	int64 BaseTimeMs = MAX_int64;
+	for (int32 Index = 0; Index < NumRecords; Index++)
+	{
+		const FRecord& Record = Records[Index];
+		const uint16* Id = SystemIds.Find(Record.AISystem);
+		if (!Id)
+		{
+			const uint16 NewId = (uint16)FMath::Min(Rollup->SystemNames.Num(), (int32)MAX_uint16);
+			const FString Name = Record.AISystem.ToString();
+			Rollup->SystemNames.Add(Name);
+			Id = &SystemIds.Add(Record.AISystem, NewId);
+			NewSystems.Add(Record.AISystem);
+
+			AppendBytes(Names, &NewId, sizeof(NewId));
+			AppendName(Names, Name);
+		}
+		RecordSystemIds[Index] = *Id;
+		BaseTimeMs = FMath::Min(BaseTimeMs, Record.TimeMs);
+	}
+
+	FBlockHeader Header;
+	Header.Magic = BlockMagic;
+	Header.NumRecords = NumRecords;
+	Header.NumNewSystems = NewSystems.Num();
+	Header.NamesSize = Names.Num();
+	Header.BaseTimeMs = BaseTimeMs;
+
+	uint64 Offsets[NumColumns];
+	Header.BlockSize = GetColumnOffsets(NumRecords, Names.Num(), Offsets);
+
+	TArray<uint8> Bytes;
+	Bytes.SetNumZeroed((int32)Header.BlockSize);
+	uint8* Block = Bytes.GetData();
+	FMemory::Memcpy(Block, &Header, sizeof(Header));
+	FMemory::Memcpy(Block + sizeof(Header), Names.GetData(), Names.Num());
+	FMemory::Memcpy(Block + Offsets[SystemColumn], RecordSystemIds.GetData(), NumRecords * sizeof(uint16));
+
+	uint32* TimeOffsets = reinterpret_cast<uint32*>(Block + Offsets[TimeOffsetColumn]);
+	uint8* Results = Block + Offsets[ResultColumn];
+	uint16* RuleMasks = reinterpret_cast<uint16*>(Block + Offsets[RuleMaskColumn]);
+	uint32* PatternRules = reinterpret_cast<uint32*>(Block + Offsets[PatternRuleColumn]);
+	uint32* Versions = reinterpret_cast<uint32*>(Block + Offsets[VersionColumn]);
+	float* Suspicion = reinterpret_cast<float*>(Block + Offsets[SuspicionColumn]);
+	float* Confidence = reinterpret_cast<float*>(Block + Offsets[ConfidenceColumn]);
+	for (int32 Index = 0; Index < NumRecords; Index++)
+	{
+		const FRecord& Record = Records[Index];
+		TimeOffsets[Index] = (uint32)FMath::Min<int64>(Record.TimeMs - BaseTimeMs, MAX_uint32);
+		Results[Index] = Record.Result;
+		RuleMasks[Index] = Record.RuleMask;
+		PatternRules[Index] = Record.PatternRule;
+		Versions[Index] = Record.ProtocolVersion;
+		Suspicion[Index] = Record.SuspicionScore;
+		Confidence[Index] = Record.ConfidenceScore;
+	}
+
+	if (!FOrionLogWriter::Get().WriteBytes(SegmentPath, MoveTemp(Bytes)))
+	{
+		// The names this block introduced never reach disk; the next block that uses
+		// them introduces them again, under fresh IDs
+		for (FName System : NewSystems)
+		{
+			SystemIds.Remove(System);
+		}
+		DroppedCount.fetch_add(NumRecords, std::memory_order_relaxed);
+		return;
+	}
+
+	RecordedCount.fetch_add(NumRecords, std::memory_order_relaxed);
+	SegmentBytes += Header.BlockSize;
+
+	for (int32 Index = 0; Index < NumRecords; Index++)
+	{
+		const FRecord& Record = Records[Index];
+		Rollup->Rows.FindOrAdd(MakeLocalKey(ToHour(Record.TimeMs), RecordSystemIds[Index])).Add(Record.Result, Record.RuleMask, Record.SuspicionScore);
+		Rollup->MinTimeMs = FMath::Min(Rollup->MinTimeMs, Record.TimeMs);
+		Rollup->MaxTimeMs = FMath::Max(Rollup->MaxTimeMs, Record.TimeMs);
+	}
+	Rollup->NumRecords += NumRecords;
+
+	if (SegmentBytes >= SegmentMaxBytes)
+	{
+		CloseSegment();
+		OpenSegment();
+	}
+}
+
+void FOrionAuditLog::OpenSegment()
+{
+	using namespace OrionAuditLog;
+
+	SegmentPath = Directory / FString::Printf(TEXT("Audit_%s_%u_%04d%s"),
+		*FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S")), FPlatformProcess::GetCurrentProcessId(), ++SegmentSequence, SegmentExtension);
+	SegmentBytes = sizeof(FSegmentHeader);
+	SystemIds.Reset();
+	Rollup = MakeUnique<FRollup>();
+
+	FSegmentHeader Header;
+	Header.Magic = SegmentMagic;
+	Header.FormatVersion = FormatVersion;
+	Header.HeaderSize = sizeof(FSegmentHeader);
+	Header.NumRuleCategories = NumRules;
+	Header.CreatedUnixMs = GetNowMs();
+
+	TArray<uint8> Bytes;
+	AppendBytes(Bytes, &Header, sizeof(Header));
+	if (!FOrionLogWriter::Get().WriteBytes(SegmentPath, MoveTemp(Bytes)))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: Log writer over budget - audit segment %s has no header and will be skipped"), *SegmentPath);
+	}
+}
+
+void FOrionAuditLog::CloseSegment()
+{
+	using namespace OrionAuditLog;
+
+	if (SegmentPath.IsEmpty())
+	{
+		return;
+	}
+
+	FRollupHeader Header;
+	Header.Magic = RollupMagic;
+	Header.FormatVersion = FormatVersion;
+	Header.NumRuleCategories = NumRules;
+	Header.NumSystems = Rollup->SystemNames.Num();
+	Header.NumRows = Rollup->Rows.Num();
+	Header.Reserved = 0;
+	Header.MinTimeMs = Rollup->MinTimeMs;
+	Header.MaxTimeMs = Rollup->MaxTimeMs;
+	Header.NumRecords = Rollup->NumRecords;
+
+	TArray<uint8> Bytes;
+	AppendBytes(Bytes, &Header, sizeof(Header));
+	for (const FString& Name : Rollup->SystemNames)
+	{
+		AppendName(Bytes, Name);
+	}
+	Bytes.SetNumZeroed(Align(Bytes.Num(), Alignment));
+
+	for (const TPair<uint64, FAggregate>& Row : Rollup->Rows)
+	{
+		FRollupRow RollupRow;
+		RollupRow.Hour = (int32)(Row.Key >> 16);
+		RollupRow.SystemId = (uint16)(Row.Key & 0xFFFF);
+		RollupRow.Reserved = 0;
+		RollupRow.Aggregate = Row.Value;
+		AppendBytes(Bytes, &RollupRow, sizeof(RollupRow));
+	}
+
+	// Written after every block of the segment, so a rollup always covers its whole segment
+	const FString RollupPath = SegmentPath + RollupExtension;
+	FOrionLogWriter& Writer = FOrionLogWriter::Get();
+	Writer.WriteBytes(RollupPath, MoveTemp(Bytes));
+	Writer.Close(SegmentPath);
+	Writer.Close(RollupPath);
+
+	SegmentPath.Reset();
+	SystemIds.Reset();
+	Rollup.Reset();
+}
+
+bool FOrionAuditLog::Export(const FString& InDirectory, const FOrionAuditQuery& Query, EOrionAuditFormat Format, const FString& OutputPath, FOrionAuditExportStats* OutStats)
+{
+	using namespace OrionAuditLog;
+
+	const int64 FromMs = ToUnixMs(Query.From);
+	const int64 ToMs = ToUnixMs(Query.To);
+
+	TArray<FString> Segments;
+	IFileManager::Get().FindFiles(Segments, *(InDirectory / FString(TEXT("*")) + SegmentExtension), /*Files=*/ true, /*Directories=*/ false);
+	Segments.Sort();
+
+	FOrionAuditExportStats Stats;
+	TMap<FRowKey, FAggregate> Rows;
+	for (const FString& Segment : Segments)
+	{
+		const FString SegmentPath = InDirectory / Segment;
+		if (ReadRollup(SegmentPath + RollupExtension, FromMs, ToMs, Rows, Stats.Records))
+		{
+			Stats.SegmentsFromRollups++;
+		}
+		else if (ScanSegment(SegmentPath, FromMs, ToMs, Rows, Stats.Records))
+		{
+			Stats.SegmentsScanned++;
+		}
+	}
+
+	TArray<FRowKey> Keys;
+	Rows.GenerateKeyArray(Keys);
+	Keys.Sort([](const FRowKey& A, const FRowKey& B)
+	{
+		return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value;
+	});
+	Stats.Rows = Keys.Num();
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*OutputPath));
+	if (!Writer)
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: Could not write audit report %s"), *OutputPath);
+		return false;
+	}
+
+	switch (Format)
+	{
+	case EOrionAuditFormat::Csv:	WriteCsv(*Writer, Keys, Rows); break;
+	case EOrionAuditFormat::Json:	WriteJson(*Writer, Keys, Rows, Query, Stats); break;
+	default:						WriteText(*Writer, Keys, Rows, Query, Stats); break;
+	}
+
+	const bool bWritten = Writer->Close();
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+	return bWritten;
+}
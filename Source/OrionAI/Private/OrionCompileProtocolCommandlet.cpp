@@ -0,0 +1,35 @@
+// OrionAI - Casey Protocol compile step
+// Offline JSON -> blob, so shipped builds start without parsing
+
+#include "OrionCompileProtocolCommandlet.h"
+#include "CaseyProtocol.h"
+#include "CaseyProtocolBlob.h"
+#include "OrionAI.h"
+#include "Misc/Paths.h"
+
+UOrionCompileProtocolCommandlet::UOrionCompileProtocolCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UOrionCompileProtocolCommandlet::Main(const FString& Params)
+{
+	FString ConfigPath = TEXT("Config/CaseyProtocol.json");
+	FParse::Value(*Params, TEXT("Config="), ConfigPath);
+
+	const FString FullPath = FPaths::ProjectDir() / ConfigPath;
+
+	FString BlobPath = FCaseyProtocolBlob::GetBlobPath(FullPath);
+	FParse::Value(*Params, TEXT("Out="), BlobPath);
+
+	if (!UCaseyProtocol::CompileToBlob(FullPath, BlobPath))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("OrionCompileProtocol: Failed to compile %s"), *FullPath);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OrionCompileProtocolCommandlet.generated.h"
+
+/**
+ * Compile CaseyProtocol.json into the precompiled blob InitializeOrion maps at startup
+ * "Flash on it once, remember it forever."
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project>.uproject -run=OrionCompileProtocol [-Config=Config/CaseyProtocol.json] [-Out=<path>]
+ *
+ * -Config is relative to the project directory, like InitializeOrion's ConfigPath.
+ * -Out defaults to the blob path next to the JSON file. Re-run after every JSON edit;
+ * a stale blob is ignored (and the JSON parsed) until it is recompiled.
+ */
+UCLASS()
+class UOrionCompileProtocolCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UOrionCompileProtocolCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
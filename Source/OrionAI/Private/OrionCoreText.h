@@ -0,0 +1,26 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "OrionCoreTypes.h"
+
+// TCHAR is UTF-16 on every platform the plugin ships on (wchar_t on Windows, char16_t
+// elsewhere), so engine strings and core text views share their memory
+static_assert(sizeof(TCHAR) == sizeof(OrionCore::FChar), "OrionCore expects 16-bit TCHAR");
+
+/** Conversions between engine strings and OrionCore text, without copying where possible */
+namespace OrionCoreText
+{
+    inline OrionCore::FTextView ToCore(FStringView Text)
+    {
+        return OrionCore::FTextView(reinterpret_cast<const OrionCore::FChar*>(Text.GetData()), Text.Len());
+    }
+
+    inline const TCHAR* FromCore(const OrionCore::FChar* Text)
+    {
+        return reinterpret_cast<const TCHAR*>(Text);
+    }
+
+    inline FString FromCore(OrionCore::FTextView Text)
+    {
+        return FString(FStringView(FromCore(Text.data()), (int32)Text.size()));
+    }
+}
@@ -0,0 +1,133 @@
+// OrionAI - Async validation deadlines
+// One thread, one heap, no dependence on the game thread ticking
+
+#include "OrionDeadlineTimer.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "Misc/ScopeLock.h"
+
+namespace OrionDeadlineTimer
+{
+	// How long the thread sleeps with nothing scheduled; Add() wakes it sooner
+	static constexpr uint32 IdleWaitMs = 1000;
+
+	struct FEarlierFireTime
+	{
+		template <typename FTimer>
+		bool operator()(const FTimer& A, const FTimer& B) const
+		{
+			return A.FireTime < B.FireTime;
+		}
+	};
+}
+
+FOrionDeadlineTimer& FOrionDeadlineTimer::Get()
+{
+	static FOrionDeadlineTimer Timer;
+	return Timer;
+}
+
+FOrionDeadlineTimer::~FOrionDeadlineTimer()
+{
+	Stop();
+}
+
+void FOrionDeadlineTimer::Start()
+{
+	if (bRunning)
+	{
+		return;
+	}
+
+	bStopRequested = false;
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	{
+		FScopeLock ScopeLock(&Lock);
+		bRunning.store(true, std::memory_order_release);
+	}
+	Thread = FRunnableThread::Create(this, TEXT("OrionAIDeadlines"), 32 * 1024, TPri_AboveNormal);
+}
+
+void FOrionDeadlineTimer::Stop()
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	// Under the lock, so no Add() still touches WakeEvent once the thread is gone
+	TArray<FTimer> Dropped;
+	{
+		FScopeLock ScopeLock(&Lock);
+		bRunning.store(false, std::memory_order_release);
+		Dropped = MoveTemp(Timers);
+	}
+
+	bStopRequested = true;
+	WakeEvent->Trigger();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+bool FOrionDeadlineTimer::Add(double DelaySeconds, TUniqueFunction<void()>&& Callback)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!bRunning.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+
+	FTimer Timer;
+	Timer.FireTime = FPlatformTime::Seconds() + FMath::Max(0.0, DelaySeconds);
+	Timer.Callback = MoveTemp(Callback);
+	const double FireTime = Timer.FireTime;
+	Timers.HeapPush(MoveTemp(Timer), OrionDeadlineTimer::FEarlierFireTime());
+
+	// Only a new soonest deadline shortens the thread's sleep
+	if (Timers.HeapTop().FireTime == FireTime)
+	{
+		WakeEvent->Trigger();
+	}
+	return true;
+}
+
+uint32 FOrionDeadlineTimer::Run()
+{
+	TArray<TUniqueFunction<void()>> Due;
+	while (!bStopRequested)
+	{
+		uint32 WaitMs = OrionDeadlineTimer::IdleWaitMs;
+		{
+			FScopeLock ScopeLock(&Lock);
+			const double Now = FPlatformTime::Seconds();
+			while (Timers.Num() > 0 && Timers.HeapTop().FireTime <= Now)
+			{
+				FTimer Timer;
+				Timers.HeapPop(Timer, OrionDeadlineTimer::FEarlierFireTime());
+				Due.Add(MoveTemp(Timer.Callback));
+			}
+
+			if (Timers.Num() > 0)
+			{
+				WaitMs = (uint32)FMath::Clamp(FMath::CeilToInt((Timers.HeapTop().FireTime - Now) * 1000.0), 1, (int32)OrionDeadlineTimer::IdleWaitMs);
+			}
+		}
+
+		// Outside the lock - a callback may schedule another deadline
+		for (TUniqueFunction<void()>& Callback : Due)
+		{
+			Callback();
+		}
+
+		if (Due.Num() == 0)
+		{
+			WakeEvent->Wait(WaitMs);
+		}
+		Due.Reset();
+	}
+	return 0;
+}
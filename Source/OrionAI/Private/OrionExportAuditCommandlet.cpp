@@ -0,0 +1,76 @@
+// OrionAI - Audit export step
+// Offline segments -> report, for audits over weeks of traffic
+
+#include "OrionExportAuditCommandlet.h"
+#include "OrionAuditLog.h"
+#include "OrionAI.h"
+#include "Misc/Paths.h"
+
+UOrionExportAuditCommandlet::UOrionExportAuditCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UOrionExportAuditCommandlet::Main(const FString& Params)
+{
+	FString Directory = TEXT("Saved/OrionAI/Audit");
+	FParse::Value(*Params, TEXT("Dir="), Directory);
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Out="), OutputPath))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("OrionExportAudit: -Out=<path> is required"));
+		return 1;
+	}
+
+	EOrionAuditFormat Format = EOrionAuditFormat::Text;
+	FString FormatName;
+	if (FParse::Value(*Params, TEXT("Format="), FormatName))
+	{
+		if (FormatName.Equals(TEXT("csv"), ESearchCase::IgnoreCase))
+		{
+			Format = EOrionAuditFormat::Csv;
+		}
+		else if (FormatName.Equals(TEXT("json"), ESearchCase::IgnoreCase))
+		{
+			Format = EOrionAuditFormat::Json;
+		}
+		else if (!FormatName.Equals(TEXT("text"), ESearchCase::IgnoreCase))
+		{
+			UE_LOG(LogOrionAI, Error, TEXT("OrionExportAudit: Unknown format '%s' (text, csv or json)"), *FormatName);
+			return 1;
+		}
+	}
+
+	FOrionAuditQuery Query;
+	FString From;
+	if (FParse::Value(*Params, TEXT("From="), From) && !FDateTime::ParseIso8601(*From, Query.From))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("OrionExportAudit: Invalid -From date '%s'"), *From);
+		return 1;
+	}
+
+	FString To;
+	if (FParse::Value(*Params, TEXT("To="), To) && !FDateTime::ParseIso8601(*To, Query.To))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("OrionExportAudit: Invalid -To date '%s'"), *To);
+		return 1;
+	}
+
+	const FString FullDirectory = FPaths::ConvertRelativePathToFull(FPaths::IsRelative(Directory) ? FPaths::ProjectDir() / Directory : Directory);
+	const FString FullOutputPath = FPaths::ProjectDir() / OutputPath;
+
+	FOrionAuditExportStats Stats;
+	if (!FOrionAuditLog::Export(FullDirectory, Query, Format, FullOutputPath, &Stats))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("OrionExportAudit: Failed to write %s"), *FullOutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogOrionAI, Display, TEXT("OrionExportAudit: %lld records in %d rows (%d segments scanned, %d from rollups) -> %s"),
+		Stats.Records, Stats.Rows, Stats.SegmentsScanned, Stats.SegmentsFromRollups, *FullOutputPath);
+	return 0;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OrionExportAuditCommandlet.generated.h"
+
+/**
+ * Export a per-hour, per-AI-system report from audit log segments, without a running game
+ * "We don't need the Intersect for this. We need a spreadsheet."
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project>.uproject -run=OrionExportAudit -Out=<path> [-Dir=Saved/OrionAI/Audit]
+ *       [-Format=text|csv|json] [-From=<ISO 8601>] [-To=<ISO 8601>]
+ *
+ * -Dir and -Out are relative to the project directory. -From and -To are UTC and default
+ * to the whole history. Segments still being written are read up to their last full block.
+ */
+UCLASS()
+class UOrionExportAuditCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UOrionExportAuditCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
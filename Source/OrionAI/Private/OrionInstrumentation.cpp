@@ -0,0 +1,193 @@
+// OrionAI - Instrumentation
+// Trace channel, stat group and log-linear latency histograms
+
+#include "OrionInstrumentation.h"
+
+#if ORION_INSTRUMENTATION
+UE_TRACE_CHANNEL_DEFINE(OrionAIChannel);
+
+DEFINE_STAT(STAT_OrionAI_PatternScan);
+DEFINE_STAT(STAT_OrionAI_RingIntel);
+DEFINE_STAT(STAT_OrionAI_CharlesCarmichael);
+DEFINE_STAT(STAT_OrionAI_Quarantine);
+DEFINE_STAT(STAT_OrionAI_Alerting);
+DEFINE_STAT(STAT_OrionAI_Decision);
+#endif
+
+std::atomic<bool> FOrionInstrumentation::bLatencyHistograms{ true };
+
+namespace OrionInstrumentation
+{
+	static FOrionLatencyHistogram StageHistograms[(int32)EOrionStage::Count];
+
+	/** Lower a running minimum or raise a running maximum, whichever Better picks */
+	template <typename PredicateType>
+	static void UpdateExtreme(std::atomic<uint64>& Extreme, uint64 Value, PredicateType Better)
+	{
+		uint64 Current = Extreme.load(std::memory_order_relaxed);
+		while (Better(Value, Current) && !Extreme.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+}
+
+FOrionLatencyHistogram::FOrionLatencyHistogram()
+{
+	Reset();
+}
+
+int32 FOrionLatencyHistogram::GetBucketIndex(uint64 Nanoseconds)
+{
+	// Values below SubBucketCount get a bucket each; above that, each power of two
+	// spans SubBucketCount buckets of width 1 << Shift
+	if (Nanoseconds < SubBucketCount)
+	{
+		return (int32)Nanoseconds;
+	}
+
+	const int32 Shift = FMath::Min((int32)FPlatformMath::FloorLog2_64(Nanoseconds) - SubBucketBits, MaxShift);
+	const int32 SubBucket = (int32)FMath::Min<uint64>(Nanoseconds >> Shift, 2 * SubBucketCount - 1) - SubBucketCount;
+	return (Shift + 1) * SubBucketCount + SubBucket;
+}
+
+double FOrionLatencyHistogram::GetBucketValue(int32 Index)
+{
+	if (Index < SubBucketCount)
+	{
+		return (double)Index;
+	}
+
+	const int32 Shift = Index / SubBucketCount - 1;
+	const int32 SubBucket = Index % SubBucketCount;
+	const double Width = (double)(1ull << Shift);
+	return (SubBucketCount + SubBucket) * Width + (Width - 1.0) * 0.5;
+}
+
+void FOrionLatencyHistogram::Record(uint64 Nanoseconds)
+{
+	Buckets[GetBucketIndex(Nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+	Count.fetch_add(1, std::memory_order_relaxed);
+	TotalNanoseconds.fetch_add(Nanoseconds, std::memory_order_relaxed);
+	OrionInstrumentation::UpdateExtreme(MinNanoseconds, Nanoseconds, [](uint64 A, uint64 B) { return A < B; });
+	OrionInstrumentation::UpdateExtreme(MaxNanoseconds, Nanoseconds, [](uint64 A, uint64 B) { return A > B; });
+}
+
+void FOrionLatencyHistogram::Snapshot(FOrionLatencySummary& OutSummary) const
+{
+	OutSummary = FOrionLatencySummary();
+
+	// Sum the buckets rather than trusting Count, so percentiles stay consistent with
+	// the buckets they're read from while other threads keep recording
+	int64 Counts[NumBuckets];
+	int64 Total = 0;
+	for (int32 Index = 0; Index < NumBuckets; Index++)
+	{
+		Counts[Index] = Buckets[Index].load(std::memory_order_relaxed);
+		Total += Counts[Index];
+	}
+
+	if (Total == 0)
+	{
+		return;
+	}
+
+	const double Percentiles[] = { 0.50, 0.90, 0.99, 0.999 };
+	double* Outputs[] = { &OutSummary.P50Us, &OutSummary.P90Us, &OutSummary.P99Us, &OutSummary.P999Us };
+
+	int64 Seen = 0;
+	int32 Next = 0;
+	for (int32 Index = 0; Index < NumBuckets && Next < UE_ARRAY_COUNT(Percentiles); Index++)
+	{
+		Seen += Counts[Index];
+		while (Next < UE_ARRAY_COUNT(Percentiles) && Seen >= (int64)FMath::CeilToDouble(Percentiles[Next] * Total))
+		{
+			*Outputs[Next++] = GetBucketValue(Index) / 1000.0;
+		}
+	}
+
+	const uint64 Min = MinNanoseconds.load(std::memory_order_relaxed);
+	const uint64 Max = MaxNanoseconds.load(std::memory_order_relaxed);
+	OutSummary.Count = Total;
+	OutSummary.MinUs = Min == MAX_uint64 ? 0.0 : Min / 1000.0;
+	OutSummary.MaxUs = Max / 1000.0;
+	OutSummary.MeanUs = TotalNanoseconds.load(std::memory_order_relaxed) / 1000.0 / FMath::Max<int64>(1, Count.load(std::memory_order_relaxed));
+
+	// Bucket midpoints can overshoot the true extremes
+	for (double* Output : Outputs)
+	{
+		*Output = FMath::Clamp(*Output, OutSummary.MinUs, OutSummary.MaxUs);
+	}
+}
+
+void FOrionLatencyHistogram::SnapshotCumulative(TConstArrayView<double> UpperBoundsSeconds, TArrayView<int64> OutCounts, int64& OutTotal, double& OutSumSeconds) const
+{
+	check(UpperBoundsSeconds.Num() == OutCounts.Num());
+
+	int64 Seen = 0;
+	int32 Bound = 0;
+	for (int32 Index = 0; Index < NumBuckets; Index++)
+	{
+		const int64 BucketCount = Buckets[Index].load(std::memory_order_relaxed);
+		if (BucketCount == 0)
+		{
+			continue;
+		}
+
+		// Bucket values only grow, so every bound below this one is final
+		const double Seconds = GetBucketValue(Index) / 1e9;
+		while (Bound < UpperBoundsSeconds.Num() && UpperBoundsSeconds[Bound] < Seconds)
+		{
+			OutCounts[Bound++] = Seen;
+		}
+		Seen += BucketCount;
+	}
+
+	while (Bound < UpperBoundsSeconds.Num())
+	{
+		OutCounts[Bound++] = Seen;
+	}
+
+	OutTotal = Seen;
+	OutSumSeconds = TotalNanoseconds.load(std::memory_order_relaxed) / 1e9;
+}
+
+void FOrionLatencyHistogram::Reset()
+{
+	for (std::atomic<int64>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+	Count.store(0, std::memory_order_relaxed);
+	TotalNanoseconds.store(0, std::memory_order_relaxed);
+	MinNanoseconds.store(MAX_uint64, std::memory_order_relaxed);
+	MaxNanoseconds.store(0, std::memory_order_relaxed);
+}
+
+FOrionLatencyHistogram& FOrionInstrumentation::GetStageHistogram(EOrionStage Stage)
+{
+	return OrionInstrumentation::StageHistograms[(int32)Stage];
+}
+
+const TCHAR* FOrionInstrumentation::GetStageName(EOrionStage Stage)
+{
+	switch (Stage)
+	{
+	case EOrionStage::PatternScan:			return TEXT("Pattern Scan");
+	case EOrionStage::RingIntel:			return TEXT("Ring Intel");
+	case EOrionStage::CharlesCarmichael:	return TEXT("Charles Carmichael");
+	case EOrionStage::Quarantine:			return TEXT("Quarantine");
+	case EOrionStage::Alerting:				return TEXT("Alerting");
+	case EOrionStage::Decision:				return TEXT("Decision");
+	default:								return TEXT("Unknown");
+	}
+}
+
+void FOrionInstrumentation::RecordSince(EOrionStage Stage, uint64 StartCycles, FOrionLatencyHistogram* ExtraHistogram)
+{
+	const uint64 Nanoseconds = (uint64)(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles) * 1e9);
+	GetStageHistogram(Stage).Record(Nanoseconds);
+	if (ExtraHistogram)
+	{
+		ExtraHistogram->Record(Nanoseconds);
+	}
+}
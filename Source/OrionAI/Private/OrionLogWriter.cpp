@@ -0,0 +1,276 @@
+// OrionAI - Background log writer
+// One thread, persistent handles, batched appends
+
+#include "OrionLogWriter.h"
+#include "OrionAI.h"
+#include "CaseyProtocol.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/Event.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FOrionLogWriter& FOrionLogWriter::Get()
+{
+	static FOrionLogWriter Writer;
+	return Writer;
+}
+
+FOrionLogWriter::FProducerScope::FProducerScope(FOrionLogWriter& InWriter)
+	: Writer(InWriter)
+{
+	// Counted in before checking, so Stop() either sees this call or this call sees it stopping
+	Writer.NumProducers.fetch_add(1, std::memory_order_seq_cst);
+	bRunning = Writer.bRunning.load(std::memory_order_seq_cst);
+}
+
+FOrionLogWriter::FProducerScope::~FProducerScope()
+{
+	Writer.NumProducers.fetch_sub(1, std::memory_order_release);
+}
+
+FOrionLogWriter::~FOrionLogWriter()
+{
+	Stop();
+}
+
+void FOrionLogWriter::Start(const FLogSinkConfig& Config)
+{
+	if (bRunning)
+	{
+		return;
+	}
+
+	FlushIntervalMs = (uint32)FMath::Max(1, Config.FlushIntervalMs);
+	MaxQueuedBytes = FMath::Max<int64>(64, Config.MaxQueuedKB) * 1024;
+	bFsyncOnFlush = Config.FsyncPolicy == EOrionFsyncPolicy::EveryFlush;
+
+	bStopRequested = false;
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	bRunning.store(true, std::memory_order_release);
+	Thread = FRunnableThread::Create(this, TEXT("OrionAILogWriter"), 64 * 1024, TPri_BelowNormal);
+}
+
+void FOrionLogWriter::Stop()
+{
+	if (!bRunning.exchange(false, std::memory_order_seq_cst))
+	{
+		return;
+	}
+
+	// New calls now append synchronously; wait out those that already queued or are
+	// still queuing, so the writer's last drain sees every entry and none of them
+	// touches WakeEvent after it is returned. A pending Flush() is answered by the
+	// writer's periodic drain meanwhile.
+	while (NumProducers.load(std::memory_order_seq_cst) > 0)
+	{
+		FPlatformProcess::YieldThread();
+	}
+
+	bStopRequested = true;
+	WakeEvent->Trigger();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	CloseHandles();
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+bool FOrionLogWriter::Write(const FString& FilePath, FString&& Text)
+{
+	const FProducerScope Producer(*this);
+	if (!Producer.IsRunning())
+	{
+		return FFileHelper::SaveStringToFile(Text, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+	}
+
+	const int64 Size = Text.Len() * sizeof(TCHAR);
+	FEntry* Entry = new FEntry();
+	Entry->FilePath = FilePath;
+	Entry->Text = MoveTemp(Text);
+	return Enqueue(Entry, Size);
+}
+
+bool FOrionLogWriter::WriteBytes(const FString& FilePath, TArray<uint8>&& Bytes)
+{
+	const FProducerScope Producer(*this);
+	if (!Producer.IsRunning())
+	{
+		return FFileHelper::SaveArrayToFile(Bytes, *FilePath, &IFileManager::Get(), FILEWRITE_Append);
+	}
+
+	const int64 Size = Bytes.Num();
+	FEntry* Entry = new FEntry();
+	Entry->FilePath = FilePath;
+	Entry->Bytes = MoveTemp(Bytes);
+	return Enqueue(Entry, Size);
+}
+
+bool FOrionLogWriter::Enqueue(FEntry* Entry, int64 Size)
+{
+	const int64 Queued = QueuedBytes.fetch_add(Size, std::memory_order_relaxed) + Size;
+	if (Queued > MaxQueuedBytes)
+	{
+		QueuedBytes.fetch_sub(Size, std::memory_order_relaxed);
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		delete Entry;
+		return false;
+	}
+
+	Queue.Enqueue(Entry);
+
+	// Don't wait out the interval once half the budget is used
+	if (Queued > MaxQueuedBytes / 2)
+	{
+		WakeEvent->Trigger();
+	}
+	return true;
+}
+
+void FOrionLogWriter::Flush()
+{
+	const FProducerScope Producer(*this);
+	if (!Producer.IsRunning())
+	{
+		return;
+	}
+
+	FEvent* Done = FPlatformProcess::GetSynchEventFromPool(true);
+	FEntry* Marker = new FEntry();
+	Marker->FlushEvent = Done;
+	Queue.Enqueue(Marker);
+	WakeEvent->Trigger();
+
+	Done->Wait();
+	FPlatformProcess::ReturnSynchEventToPool(Done);
+}
+
+void FOrionLogWriter::Close(const FString& FilePath)
+{
+	const FProducerScope Producer(*this);
+	if (!Producer.IsRunning())
+	{
+		return;
+	}
+
+	FEntry* Marker = new FEntry();
+	Marker->FilePath = FilePath;
+	Marker->bClose = true;
+	Queue.Enqueue(Marker);
+}
+
+uint32 FOrionLogWriter::Run()
+{
+	while (!bStopRequested)
+	{
+		WakeEvent->Wait(FlushIntervalMs);
+		DrainQueue();
+	}
+
+	DrainQueue();
+	return 0;
+}
+
+void FOrionLogWriter::DrainQueue()
+{
+	TArray<FEvent*> FlushEvents;
+	TArray<FString> ClosePaths;
+
+	// Coalesce everything queued into one contiguous buffer per file
+	FEntry* Entry = nullptr;
+	while (Queue.Dequeue(Entry))
+	{
+		if (Entry->FlushEvent)
+		{
+			FlushEvents.Add(Entry->FlushEvent);
+		}
+		else if (Entry->bClose)
+		{
+			ClosePaths.Add(MoveTemp(Entry->FilePath));
+		}
+		else
+		{
+			TArray<uint8>& Buffer = PendingWrites.FindOrAdd(Entry->FilePath);
+			if (Entry->Bytes.Num() > 0)
+			{
+				QueuedBytes.fetch_sub(Entry->Bytes.Num(), std::memory_order_relaxed);
+				Buffer.Append(Entry->Bytes);
+			}
+			else
+			{
+				QueuedBytes.fetch_sub(Entry->Text.Len() * sizeof(TCHAR), std::memory_order_relaxed);
+				FTCHARToUTF8 Utf8(*Entry->Text, Entry->Text.Len());
+				Buffer.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			}
+		}
+		delete Entry;
+	}
+
+	for (TPair<FString, TArray<uint8>>& Pending : PendingWrites)
+	{
+		if (Pending.Value.Num() == 0)
+		{
+			continue;
+		}
+
+		if (IFileHandle* Handle = GetHandle(Pending.Key))
+		{
+			Handle->Write(Pending.Value.GetData(), Pending.Value.Num());
+			Handle->Flush(bFsyncOnFlush);
+		}
+
+		// Keep the allocation for the next batch
+		Pending.Value.Reset();
+	}
+
+	// Files are only closed once nothing more is written to them, e.g. rotated segments
+	for (const FString& FilePath : ClosePaths)
+	{
+		if (TUniquePtr<IFileHandle>* Handle = Handles.Find(FilePath))
+		{
+			(*Handle)->Flush(bFsyncOnFlush);
+			Handles.Remove(FilePath);
+		}
+		PendingWrites.Remove(FilePath);
+	}
+
+	for (FEvent* Event : FlushEvents)
+	{
+		Event->Trigger();
+	}
+}
+
+IFileHandle* FOrionLogWriter::GetHandle(const FString& FilePath)
+{
+	if (TUniquePtr<IFileHandle>* Existing = Handles.Find(FilePath))
+	{
+		return Existing->Get();
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+
+	IFileHandle* Handle = PlatformFile.OpenWrite(*FilePath, /*bAppend=*/ true, /*bAllowRead=*/ true);
+	if (!Handle)
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("OrionAI: Could not open log file %s"), *FilePath);
+		return nullptr;
+	}
+
+	Handles.Add(FilePath, TUniquePtr<IFileHandle>(Handle));
+	return Handle;
+}
+
+void FOrionLogWriter::CloseHandles()
+{
+	for (TPair<FString, TUniquePtr<IFileHandle>>& Handle : Handles)
+	{
+		Handle.Value->Flush(true);
+	}
+	Handles.Empty();
+	PendingWrites.Empty();
+}
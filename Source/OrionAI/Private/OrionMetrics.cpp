@@ -0,0 +1,10 @@
+// OrionAI - Lock-free validation metrics
+
+#include "OrionMetrics.h"
+
+int32 FOrionCounterStripes::GetLocalStripeIndex()
+{
+	static std::atomic<int32> NextStripe{ 0 };
+	thread_local const int32 StripeIndex = NextStripe.fetch_add(1, std::memory_order_relaxed) % NumStripes;
+	return StripeIndex;
+}
@@ -0,0 +1,233 @@
+// OrionAI - OpenMetrics exporter
+// Prometheus scrapes straight from the in-process counters
+
+#include "OrionMetricsExporter.h"
+#include "OrionAI.h"
+#include "OrionSystemState.h"
+#include "OrionNerdHerd.h"
+#include "OrionLogWriter.h"
+#include "OrionSidecar.h"
+#include "CaseyProtocol.h"
+#include "HttpServerModule.h"
+#include "HttpServerResponse.h"
+#include "HttpPath.h"
+#include "IHttpRouter.h"
+#include "Misc/EngineVersionComparison.h"
+
+namespace OrionMetricsExporter
+{
+	static const TCHAR* const ContentType = TEXT("application/openmetrics-text; version=1.0.0; charset=utf-8");
+
+	// Label values, in EOrionStage order
+	static const TCHAR* const StageNames[] =
+	{
+		TEXT("pattern_scan"),
+		TEXT("ring_intel"),
+		TEXT("charles_carmichael"),
+		TEXT("quarantine"),
+		TEXT("alerting"),
+		TEXT("decision")
+	};
+	static_assert(UE_ARRAY_COUNT(StageNames) == (int32)EOrionStage::Count, "One label per stage");
+
+	// Histogram bounds in seconds, from microsecond pattern scans to multi-second Ring Intel stalls
+	static const double BucketBounds[] = { 1e-6, 2.5e-6, 5e-6, 1e-5, 2.5e-5, 5e-5, 1e-4, 2.5e-4, 5e-4, 1e-3, 2.5e-3, 5e-3, 1e-2, 2.5e-2, 5e-2, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0 };
+	static const TCHAR* const BucketLabels[] = { TEXT("1e-06"), TEXT("2.5e-06"), TEXT("5e-06"), TEXT("1e-05"), TEXT("2.5e-05"), TEXT("5e-05"), TEXT("0.0001"), TEXT("0.00025"), TEXT("0.0005"), TEXT("0.001"), TEXT("0.0025"), TEXT("0.005"), TEXT("0.01"), TEXT("0.025"), TEXT("0.05"), TEXT("0.1"), TEXT("0.25"), TEXT("0.5"), TEXT("1.0"), TEXT("2.5"), TEXT("5.0"), TEXT("10.0") };
+	static_assert(UE_ARRAY_COUNT(BucketBounds) == UE_ARRAY_COUNT(BucketLabels), "One label per bound");
+
+	/** Escape a label value: backslash, double quote and line feed */
+	static FString EscapeLabel(const FString& Value)
+	{
+		FString Escaped;
+		Escaped.Reserve(Value.Len());
+		for (TCHAR Char : Value)
+		{
+			switch (Char)
+			{
+			case TEXT('\\'):	Escaped += TEXT("\\\\"); break;
+			case TEXT('"'):		Escaped += TEXT("\\\""); break;
+			case TEXT('\n'):	Escaped += TEXT("\\n"); break;
+			default:			Escaped += Char; break;
+			}
+		}
+		return Escaped;
+	}
+
+	static void AppendFamily(FString& Out, const TCHAR* Name, const TCHAR* Type, const TCHAR* Help)
+	{
+		Out.Appendf(TEXT("# TYPE %s %s\n# HELP %s %s\n"), Name, Type, Name, Help);
+	}
+
+	/** One histogram's samples; the family header is written by the caller */
+	static void AppendHistogram(FString& Out, const TCHAR* Name, const TCHAR* LabelName, const FString& LabelValue, const FOrionLatencyHistogram& Histogram)
+	{
+		int64 Counts[UE_ARRAY_COUNT(BucketBounds)];
+		int64 Total = 0;
+		double SumSeconds = 0.0;
+		Histogram.SnapshotCumulative(BucketBounds, Counts, Total, SumSeconds);
+
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(BucketBounds); Index++)
+		{
+			Out.Appendf(TEXT("%s_bucket{%s=\"%s\",le=\"%s\"} %lld\n"), Name, LabelName, *LabelValue, BucketLabels[Index], Counts[Index]);
+		}
+		Out.Appendf(TEXT("%s_bucket{%s=\"%s\",le=\"+Inf\"} %lld\n"), Name, LabelName, *LabelValue, Total);
+		Out.Appendf(TEXT("%s_count{%s=\"%s\"} %lld\n"), Name, LabelName, *LabelValue, Total);
+		Out.Appendf(TEXT("%s_sum{%s=\"%s\"} %.9f\n"), Name, LabelName, *LabelValue, SumSeconds);
+	}
+}
+
+FOrionMetricsExporter& FOrionMetricsExporter::Get()
+{
+	static FOrionMetricsExporter Exporter;
+	return Exporter;
+}
+
+void FOrionMetricsExporter::Start(const FMetricsExporterConfig& Config)
+{
+	if (IsRunning())
+	{
+		return;
+	}
+
+	FHttpServerModule& HttpServer = FHttpServerModule::Get();
+	Router = HttpServer.GetHttpRouter(Config.Port);
+	if (!Router.IsValid())
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: Metrics exporter could not listen on port %d"), Config.Port);
+		return;
+	}
+
+	auto Handler = [](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		OnComplete(FHttpServerResponse::Create(BuildOpenMetrics(), OrionMetricsExporter::ContentType));
+		return true;
+	};
+
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	RouteHandle = Router->BindRoute(FHttpPath(Config.Path), EHttpServerRequestVerbs::VERB_GET, Handler);
+#else
+	RouteHandle = Router->BindRoute(FHttpPath(Config.Path), EHttpServerRequestVerbs::VERB_GET, FHttpRequestHandler::CreateLambda(Handler));
+#endif
+
+	if (!RouteHandle.IsValid())
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("❌ OrionAI: Metrics exporter could not bind %s on port %d"), *Config.Path, Config.Port);
+		Router.Reset();
+		return;
+	}
+
+	HttpServer.StartAllListeners();
+	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Serving OpenMetrics on port %d at %s"), Config.Port, *Config.Path);
+}
+
+void FOrionMetricsExporter::Stop()
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	Router->UnbindRoute(RouteHandle);
+	RouteHandle.Reset();
+	Router.Reset();
+}
+
+FString FOrionMetricsExporter::BuildOpenMetrics()
+{
+	using namespace OrionMetricsExporter;
+
+	FString Out;
+	Out.Reserve(16 * 1024);
+
+	FOrionValidationMetrics Metrics;
+	UOrionAI::GetValidationMetrics(Metrics);
+
+	AppendFamily(Out, TEXT("orionai_validations"), TEXT("counter"), TEXT("Decisions validated, by verdict; sanitized decisions count as approved."));
+	Out.Appendf(TEXT("orionai_validations_total{result=\"approved\"} %lld\n"), Metrics.Approved);
+	Out.Appendf(TEXT("orionai_validations_total{result=\"rejected\"} %lld\n"), Metrics.Rejected);
+	Out.Appendf(TEXT("orionai_validations_total{result=\"quarantined\"} %lld\n"), Metrics.Quarantined);
+
+	AppendFamily(Out, TEXT("orionai_verdict_cache_lookups"), TEXT("counter"), TEXT("Verdict cache lookups while the cache is enabled."));
+	Out.Appendf(TEXT("orionai_verdict_cache_lookups_total{result=\"hit\"} %lld\n"), Metrics.CacheHits);
+	Out.Appendf(TEXT("orionai_verdict_cache_lookups_total{result=\"miss\"} %lld\n"), Metrics.CacheMisses);
+
+	AppendFamily(Out, TEXT("orionai_shed_decisions"), TEXT("counter"), TEXT("Decisions admission control shed to reduced checks or failed closed, by reason."));
+	Out.Appendf(TEXT("orionai_shed_decisions_total{reason=\"queue_depth\"} %lld\n"), Metrics.ShedQueueDepth);
+	Out.Appendf(TEXT("orionai_shed_decisions_total{reason=\"rate_limit\"} %lld\n"), Metrics.ShedRateLimit);
+
+	AppendFamily(Out, TEXT("orionai_admission_queue_depth"), TEXT("gauge"), TEXT("Validations running or queued for the worker pool, as admission control counts them."));
+	Out.Appendf(TEXT("orionai_admission_queue_depth %d\n"), UOrionAI::GetAdmissionQueueDepth());
+
+	AppendFamily(Out, TEXT("orionai_rule_hits"), TEXT("counter"), TEXT("Rules triggered by validated decisions, by kind of rule."));
+	for (int32 Category = 1; Category < (int32)EOrionRuleCategory::Count; Category++)
+	{
+		Out.Appendf(TEXT("orionai_rule_hits_total{rule=\"%s\"} %lld\n"), UOrionAI::GetRuleCategoryKey((EOrionRuleCategory)Category), UOrionAI::GetRuleHitCount((EOrionRuleCategory)Category));
+	}
+
+	// Labels are escaped once per system and shared by the families below
+	TArray<TPair<FString, const FOrionSystemState*>> Systems;
+	UOrionAI::ForEachSystemState([&Systems](const FOrionSystemState& System)
+	{
+		Systems.Emplace(EscapeLabel(System.Name.ToString()), &System);
+	});
+
+	AppendFamily(Out, TEXT("orionai_system_validations"), TEXT("counter"), TEXT("Decisions validated per AI system, by verdict."));
+	for (const TPair<FString, const FOrionSystemState*>& System : Systems)
+	{
+		FOrionValidationMetrics SystemMetrics;
+		System.Value->Counters.Snapshot(SystemMetrics);
+		Out.Appendf(TEXT("orionai_system_validations_total{system=\"%s\",result=\"approved\"} %lld\n"), *System.Key, SystemMetrics.Approved);
+		Out.Appendf(TEXT("orionai_system_validations_total{system=\"%s\",result=\"rejected\"} %lld\n"), *System.Key, SystemMetrics.Rejected);
+		Out.Appendf(TEXT("orionai_system_validations_total{system=\"%s\",result=\"quarantined\"} %lld\n"), *System.Key, SystemMetrics.Quarantined);
+	}
+
+	AppendFamily(Out, TEXT("orionai_system_shed_decisions"), TEXT("counter"), TEXT("Decisions admission control shed per AI system, by reason."));
+	for (const TPair<FString, const FOrionSystemState*>& System : Systems)
+	{
+		FOrionValidationMetrics SystemMetrics;
+		System.Value->Counters.Snapshot(SystemMetrics);
+		Out.Appendf(TEXT("orionai_system_shed_decisions_total{system=\"%s\",reason=\"queue_depth\"} %lld\n"), *System.Key, SystemMetrics.ShedQueueDepth);
+		Out.Appendf(TEXT("orionai_system_shed_decisions_total{system=\"%s\",reason=\"rate_limit\"} %lld\n"), *System.Key, SystemMetrics.ShedRateLimit);
+	}
+
+	AppendFamily(Out, TEXT("orionai_safe_mode"), TEXT("gauge"), TEXT("1 while an AI system's decisions are rejected by Buy More Cover, its own or the global one."));
+	for (const TPair<FString, const FOrionSystemState*>& System : Systems)
+	{
+		Out.Appendf(TEXT("orionai_safe_mode{system=\"%s\"} %d\n"), *System.Key, UOrionAI::IsBlocked(*System.Value) ? 1 : 0);
+	}
+
+	AppendFamily(Out, TEXT("orionai_global_safe_mode"), TEXT("gauge"), TEXT("1 while Buy More Cover has disabled every AI system."));
+	Out.Appendf(TEXT("orionai_global_safe_mode %d\n"), UOrionAI::IsInSafeMode() ? 1 : 0);
+
+	AppendFamily(Out, TEXT("orionai_protocol_version"), TEXT("gauge"), TEXT("Casey Protocol publishes since startup; bumps on every hot reload."));
+	Out.Appendf(TEXT("orionai_protocol_version %lld\n"), FCaseyProtocolReadScope()->Version);
+
+	const FNerdHerdDispatcher& NerdHerd = FNerdHerdDispatcher::Get();
+	AppendFamily(Out, TEXT("orionai_nerd_herd_alerts_coalesced"), TEXT("counter"), TEXT("Nerd Herd alerts folded into a summary."));
+	Out.Appendf(TEXT("orionai_nerd_herd_alerts_coalesced_total %lld\n"), NerdHerd.GetCoalescedAlertCount());
+	AppendFamily(Out, TEXT("orionai_nerd_herd_alerts_dropped"), TEXT("counter"), TEXT("Nerd Herd alerts dropped because the queue was full."));
+	Out.Appendf(TEXT("orionai_nerd_herd_alerts_dropped_total %lld\n"), NerdHerd.GetDroppedAlertCount());
+	AppendFamily(Out, TEXT("orionai_nerd_herd_failed_posts"), TEXT("counter"), TEXT("Nerd Herd posts given up on."));
+	Out.Appendf(TEXT("orionai_nerd_herd_failed_posts_total %lld\n"), NerdHerd.GetFailedPostCount());
+
+	AppendFamily(Out, TEXT("orionai_log_lines_dropped"), TEXT("counter"), TEXT("Log lines dropped because the log writer was over budget."));
+	Out.Appendf(TEXT("orionai_log_lines_dropped_total %lld\n"), FOrionLogWriter::Get().GetDroppedCount());
+
+	AppendFamily(Out, TEXT("orionai_sidecar_failed_requests"), TEXT("counter"), TEXT("Ring Intel requests the sidecar daemon did not answer in time; those decisions passed without Ring Intel."));
+	Out.Appendf(TEXT("orionai_sidecar_failed_requests_total %lld\n"), FOrionSidecarClient::Get().GetFailedCount());
+
+	AppendFamily(Out, TEXT("orionai_stage_duration_seconds"), TEXT("histogram"), TEXT("Time spent in each validation stage, across every AI system."));
+	for (int32 Stage = 0; Stage < (int32)EOrionStage::Count; Stage++)
+	{
+		AppendHistogram(Out, TEXT("orionai_stage_duration_seconds"), TEXT("stage"), StageNames[Stage], FOrionInstrumentation::GetStageHistogram((EOrionStage)Stage));
+	}
+
+	AppendFamily(Out, TEXT("orionai_decision_duration_seconds"), TEXT("histogram"), TEXT("End-to-end decision latency per AI system."));
+	for (const TPair<FString, const FOrionSystemState*>& System : Systems)
+	{
+		AppendHistogram(Out, TEXT("orionai_decision_duration_seconds"), TEXT("system"), System.Key, System.Value->Latency);
+	}
+
+	Out += TEXT("# EOF\n");
+	return Out;
+}
@@ -0,0 +1,37 @@
+// OrionAI - Morgan Mode
+// Lazily formatted, sampled per-decision logging
+
+#include "OrionMorganMode.h"
+#include "CaseyProtocol.h"
+#include "OrionLogWriter.h"
+#include "Misc/Paths.h"
+
+std::atomic<bool> FOrionMorganMode::bEnabled{ false };
+std::atomic<bool> FOrionMorganMode::bLogAllDecisions{ false };
+std::atomic<uint32> FOrionMorganMode::ApprovalLogSampleRate{ 1 };
+
+void FOrionMorganMode::Configure(const FMorganModeConfig& Config)
+{
+	bEnabled.store(Config.bEnabled, std::memory_order_relaxed);
+	bLogAllDecisions.store(Config.bEnabled && Config.bLogAllDecisions, std::memory_order_relaxed);
+	ApprovalLogSampleRate.store((uint32)FMath::Max(1, Config.ApprovalLogSampleRate), std::memory_order_relaxed);
+}
+
+bool FOrionMorganMode::SampleApproval()
+{
+	static thread_local uint32 Approvals = 0;
+	const uint32 Rate = ApprovalLogSampleRate.load(std::memory_order_relaxed);
+	return Rate <= 1 || ++Approvals % Rate == 0;
+}
+
+void FOrionMorganMode::Write(const FString& Message)
+{
+	FString LogEntry = FString::Printf(
+		TEXT("[MORGAN MODE] [%s] %s\n"),
+		*FDateTime::Now().ToString(),
+		*Message
+	);
+
+	static const FString LogPath = FPaths::ProjectDir() / TEXT("OrionAI_MorganMode.txt");
+	FOrionLogWriter::Get().Write(LogPath, MoveTemp(LogEntry));
+}
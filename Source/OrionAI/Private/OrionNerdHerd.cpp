@@ -0,0 +1,545 @@
+// OrionAI - Nerd Herd alert dispatch
+// Bounded queue, coalesced repeats, batched posts, retried with backoff
+
+#include "OrionNerdHerd.h"
+#include "OrionAI.h"
+#include "CaseyProtocol.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformMisc.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace NerdHerd
+{
+	// While a post is in flight, poll for its completion this often
+	static constexpr double InFlightPollSeconds = 0.05;
+
+	// At shutdown, how long the last posts get to complete
+	static constexpr double ShutdownGraceSeconds = 2.0;
+
+	/** "ENV:NAME" reads NAME from the environment; anything else is used as is */
+	static FString ResolveSetting(const FString& Value)
+	{
+		if (Value.StartsWith(TEXT("ENV:")))
+		{
+			return FPlatformMisc::GetEnvironmentVariable(*Value.RightChop(4));
+		}
+		return Value;
+	}
+
+	static FString ToJson(const TSharedRef<FJsonObject>& Object)
+	{
+		FString Json;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+		FJsonSerializer::Serialize(Object, Writer);
+		return Json;
+	}
+
+	static FString JoinLines(const TArray<FString>& Lines, const TCHAR* Bullet)
+	{
+		FString Joined;
+		for (const FString& Line : Lines)
+		{
+			Joined += Bullet;
+			Joined += Line;
+			Joined += TEXT("\n");
+		}
+		return Joined;
+	}
+
+	/** Ticket title for a batch: its first line, and how many more it holds */
+	static FString MakeTitle(const TArray<FString>& Lines)
+	{
+		return Lines.Num() > 1
+			? FString::Printf(TEXT("Nerd Herd: %s (+%d more)"), *Lines[0], Lines.Num() - 1)
+			: FString::Printf(TEXT("Nerd Herd: %s"), *Lines[0]);
+	}
+}
+
+FNerdHerdDispatcher& FNerdHerdDispatcher::Get()
+{
+	static FNerdHerdDispatcher Dispatcher;
+	return Dispatcher;
+}
+
+FNerdHerdDispatcher::~FNerdHerdDispatcher()
+{
+	Stop();
+}
+
+void FNerdHerdDispatcher::Start(const FNerdHerdConfig& Config)
+{
+	if (bRunning)
+	{
+		return;
+	}
+
+	Targets.Reset();
+	AddTargets(Config);
+	if (Targets.Num() == 0)
+	{
+		// Local logging only - nothing to dispatch
+		return;
+	}
+
+	MaxQueuedAlerts = FMath::Max(1, Config.MaxQueuedAlerts);
+	CoalesceWindowSeconds = FMath::Max(0, Config.CoalesceWindowSeconds);
+	BatchDelaySeconds = FMath::Max(0, Config.BatchDelayMs) / 1000.0;
+	MaxAlertsPerBatch = FMath::Max(1, Config.MaxAlertsPerBatch);
+	MaxRetries = FMath::Max(0, Config.MaxRetries);
+	RetryBackoffSeconds = FMath::Max(1, Config.RetryBackoffMs) / 1000.0;
+	MaxRetryBackoffSeconds = FMath::Max(RetryBackoffSeconds, Config.MaxRetryBackoffMs / 1000.0);
+	RequestTimeoutSeconds = (float)FMath::Max(1, Config.RequestTimeoutSeconds);
+	MaxPendingPosts = FMath::Max(1, Config.MaxPendingPosts);
+
+	// Load the HTTP module here, on the game thread, rather than on first post
+	FHttpModule::Get();
+
+	bStopRequested = false;
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	bRunning.store(true, std::memory_order_release);
+	Thread = FRunnableThread::Create(this, TEXT("OrionAINerdHerd"), 64 * 1024, TPri_BelowNormal);
+
+	UE_LOG(LogOrionAI, Log, TEXT("Nerd Herd: dispatching alerts to %d integration(s)"), Targets.Num());
+}
+
+void FNerdHerdDispatcher::Stop()
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	bStopRequested = true;
+	WakeEvent->Trigger();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	bRunning.store(false, std::memory_order_release);
+
+	// Anything that raced in after the dispatcher's last drain
+	FAlert* Alert = nullptr;
+	while (Queue.Dequeue(Alert))
+	{
+		QueuedAlerts.fetch_sub(1, std::memory_order_relaxed);
+		DroppedAlerts.fetch_add(1, std::memory_order_relaxed);
+		delete Alert;
+	}
+
+	Targets.Empty();
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+void FNerdHerdDispatcher::AddTargets(const FNerdHerdConfig& Config)
+{
+	if (Config.bSlackEnabled)
+	{
+		const FString Url = NerdHerd::ResolveSetting(Config.SlackWebhookUrl);
+		if (Url.IsEmpty())
+		{
+			UE_LOG(LogOrionAI, Warning, TEXT("Nerd Herd: Slack is enabled but has no webhook URL"));
+		}
+		else
+		{
+			const FString Channel = Config.SlackChannel;
+			FTarget& Slack = Targets.AddDefaulted_GetRef();
+			Slack.Name = TEXT("Slack");
+			Slack.Url = Url;
+			Slack.MakePayload = [Channel](const TArray<FString>& Lines)
+			{
+				TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+				Message->SetStringField(TEXT("text"), FString::Printf(TEXT("*NERD HERD ALERT* (%d)\n%s"), Lines.Num(), *NerdHerd::JoinLines(Lines, TEXT("• "))));
+				if (!Channel.IsEmpty())
+				{
+					Message->SetStringField(TEXT("channel"), Channel);
+				}
+				return NerdHerd::ToJson(Message);
+			};
+		}
+	}
+
+	if (Config.bGitHubEnabled)
+	{
+		const FString Token = NerdHerd::ResolveSetting(Config.GitHubApiToken);
+		if (Config.GitHubRepo.IsEmpty() || Token.IsEmpty())
+		{
+			UE_LOG(LogOrionAI, Warning, TEXT("Nerd Herd: GitHub is enabled but has no repo or API token"));
+		}
+		else
+		{
+			const FString Label = Config.GitHubLabel;
+			FTarget& GitHub = Targets.AddDefaulted_GetRef();
+			GitHub.Name = TEXT("GitHub");
+			GitHub.Url = FString::Printf(TEXT("https://api.github.com/repos/%s/issues"), *Config.GitHubRepo);
+			GitHub.Headers.Emplace(TEXT("Authorization"), TEXT("Bearer ") + Token);
+			GitHub.Headers.Emplace(TEXT("Accept"), TEXT("application/vnd.github+json"));
+			GitHub.Headers.Emplace(TEXT("User-Agent"), TEXT("OrionAI"));
+			GitHub.MakePayload = [Label](const TArray<FString>& Lines)
+			{
+				TSharedRef<FJsonObject> Issue = MakeShared<FJsonObject>();
+				Issue->SetStringField(TEXT("title"), NerdHerd::MakeTitle(Lines));
+				Issue->SetStringField(TEXT("body"), NerdHerd::JoinLines(Lines, TEXT("- ")));
+				if (!Label.IsEmpty())
+				{
+					TArray<TSharedPtr<FJsonValue>> Labels;
+					Labels.Add(MakeShared<FJsonValueString>(Label));
+					Issue->SetArrayField(TEXT("labels"), Labels);
+				}
+				return NerdHerd::ToJson(Issue);
+			};
+		}
+	}
+
+	if (Config.bJiraEnabled)
+	{
+		const FString Url = NerdHerd::ResolveSetting(Config.JiraUrl);
+		const FString Token = NerdHerd::ResolveSetting(Config.JiraApiToken);
+		if (Url.IsEmpty() || Config.JiraProject.IsEmpty() || Token.IsEmpty())
+		{
+			UE_LOG(LogOrionAI, Warning, TEXT("Nerd Herd: Jira is enabled but has no URL, project or API token"));
+		}
+		else
+		{
+			const FString Project = Config.JiraProject;
+			FTarget& Jira = Targets.AddDefaulted_GetRef();
+			Jira.Name = TEXT("Jira");
+			Jira.Url = Url / TEXT("rest/api/2/issue");
+			Jira.Headers.Emplace(TEXT("Authorization"), TEXT("Bearer ") + Token);
+			Jira.MakePayload = [Project](const TArray<FString>& Lines)
+			{
+				TSharedRef<FJsonObject> ProjectObj = MakeShared<FJsonObject>();
+				ProjectObj->SetStringField(TEXT("key"), Project);
+				TSharedRef<FJsonObject> IssueType = MakeShared<FJsonObject>();
+				IssueType->SetStringField(TEXT("name"), TEXT("Bug"));
+
+				TSharedRef<FJsonObject> Fields = MakeShared<FJsonObject>();
+				Fields->SetObjectField(TEXT("project"), ProjectObj);
+				Fields->SetObjectField(TEXT("issuetype"), IssueType);
+				Fields->SetStringField(TEXT("summary"), NerdHerd::MakeTitle(Lines).Left(255));
+				Fields->SetStringField(TEXT("description"), NerdHerd::JoinLines(Lines, TEXT("* ")));
+
+				TSharedRef<FJsonObject> Issue = MakeShared<FJsonObject>();
+				Issue->SetObjectField(TEXT("fields"), Fields);
+				return NerdHerd::ToJson(Issue);
+			};
+		}
+	}
+}
+
+bool FNerdHerdDispatcher::Raise(const FString& Issue, const FOrionValidationReport& Report)
+{
+	if (!IsRunning())
+	{
+		return false;
+	}
+
+	const int32 Queued = QueuedAlerts.fetch_add(1, std::memory_order_relaxed) + 1;
+	if (Queued > MaxQueuedAlerts)
+	{
+		QueuedAlerts.fetch_sub(1, std::memory_order_relaxed);
+		DroppedAlerts.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	FAlert* Alert = new FAlert();
+	Alert->AISystem = Report.AISystem;
+	Alert->Rule = Report.TriggeredRules.Num() > 0 ? Report.TriggeredRules[0] : FOrionRuleId();
+	Alert->ProtocolVersion = Report.ProtocolVersion;
+	Alert->Issue = Issue;
+	Alert->SuspicionScore = Report.SuspicionScore;
+	Alert->Timestamp = FDateTime::Now();
+	Queue.Enqueue(Alert);
+
+	// Don't wait out the batch delay once half the budget is used
+	if (Queued > MaxQueuedAlerts / 2)
+	{
+		WakeEvent->Trigger();
+	}
+	return true;
+}
+
+uint32 FNerdHerdDispatcher::Run()
+{
+	while (!bStopRequested)
+	{
+		const double Now = FPlatformTime::Seconds();
+
+		// Closing first means every window DrainQueue finds is still open
+		CloseWindows(Now, false);
+		DrainQueue(Now);
+		if (Batch.Num() > 0 && Now - BatchOpenedAt >= BatchDelaySeconds)
+		{
+			FlushBatch();
+		}
+		PumpPosts(Now);
+
+		WakeEvent->Wait((uint32)FMath::CeilToInt(GetWaitSeconds(Now) * 1000.0));
+	}
+
+	// Give what has been batched so far one attempt; retries stop with bStopRequested
+	const double Now = FPlatformTime::Seconds();
+	DrainQueue(Now);
+	CloseWindows(Now, true);
+	FlushBatch();
+	for (const FPostRef& Post : Posts)
+	{
+		Post->NextAttemptTime = 0.0;
+	}
+	PumpPosts(Now);
+
+	const double Deadline = Now + FMath::Min<double>(RequestTimeoutSeconds, NerdHerd::ShutdownGraceSeconds);
+	while (Posts.Num() > 0 && FPlatformTime::Seconds() < Deadline)
+	{
+		FPlatformProcess::Sleep((float)NerdHerd::InFlightPollSeconds);
+		PumpPosts(FPlatformTime::Seconds());
+	}
+
+	for (const FPostRef& Post : Posts)
+	{
+		if (Post->Request.IsValid())
+		{
+			Post->Request->CancelRequest();
+		}
+		FailedPosts.fetch_add(1, std::memory_order_relaxed);
+	}
+	Posts.Empty();
+	Windows.Empty();
+	return 0;
+}
+
+void FNerdHerdDispatcher::DrainQueue(double Now)
+{
+	FAlert* Alert = nullptr;
+	while (Queue.Dequeue(Alert))
+	{
+		QueuedAlerts.fetch_sub(1, std::memory_order_relaxed);
+
+		TPair<FString, uint32> Key(Alert->AISystem, Alert->Rule.Pack());
+		if (CoalesceWindowSeconds > 0.0)
+		{
+			if (FCoalesced* Window = Windows.Find(Key))
+			{
+				++Window->Suppressed;
+				Window->MaxScore = FMath::Max(Window->MaxScore, Alert->SuspicionScore);
+				CoalescedAlerts.fetch_add(1, std::memory_order_relaxed);
+				delete Alert;
+				continue;
+			}
+		}
+
+		// Only alerts that are posted get their rule named
+		const FString Rule = Alert->Rule.Category != EOrionRuleCategory::None
+			? UOrionAI::DescribeRule(Alert->Rule, Alert->ProtocolVersion)
+			: FString(TEXT("no rule"));
+
+		if (CoalesceWindowSeconds > 0.0)
+		{
+			FCoalesced& Opened = Windows.Add(MoveTemp(Key));
+			Opened.Label = FString::Printf(TEXT("%s - %s"), *Alert->AISystem, *Rule);
+			Opened.WindowEnd = Now + CoalesceWindowSeconds;
+		}
+
+		AddLine(FString::Printf(TEXT("[%s] %s - %s (score %.2f)"),
+			*Alert->Timestamp.ToString(), *Alert->Issue, *Rule, Alert->SuspicionScore), Now);
+		delete Alert;
+	}
+}
+
+void FNerdHerdDispatcher::CloseWindows(double Now, bool bCloseAll)
+{
+	for (TMap<TPair<FString, uint32>, FCoalesced>::TIterator It = Windows.CreateIterator(); It; ++It)
+	{
+		const FCoalesced& Window = It.Value();
+		if (!bCloseAll && Window.WindowEnd > Now)
+		{
+			continue;
+		}
+
+		if (Window.Suppressed > 0)
+		{
+			AddLine(FString::Printf(TEXT("%s: %d more in the last %.0fs (max score %.2f)"),
+				*Window.Label, Window.Suppressed, CoalesceWindowSeconds, Window.MaxScore), Now);
+		}
+		It.RemoveCurrent();
+	}
+}
+
+void FNerdHerdDispatcher::AddLine(FString&& Line, double Now)
+{
+	if (Batch.Num() == 0)
+	{
+		BatchOpenedAt = Now;
+	}
+
+	Batch.Add(MoveTemp(Line));
+	if (Batch.Num() >= MaxAlertsPerBatch)
+	{
+		FlushBatch();
+	}
+}
+
+void FNerdHerdDispatcher::FlushBatch()
+{
+	if (Batch.Num() == 0)
+	{
+		return;
+	}
+
+	for (int32 Target = 0; Target < Targets.Num(); ++Target)
+	{
+		AddPost(Target, Targets[Target].MakePayload(Batch));
+	}
+	Batch.Reset();
+}
+
+void FNerdHerdDispatcher::AddPost(int32 Target, FString&& Payload)
+{
+	if (Posts.Num() >= MaxPendingPosts)
+	{
+		// Backpressure: make room by giving up on the oldest post still waiting to retry
+		const int32 Oldest = Posts.IndexOfByPredicate([](const FPostRef& Post) { return Post->State == EPostState::Waiting; });
+		FailedPosts.fetch_add(1, std::memory_order_relaxed);
+		if (Oldest == INDEX_NONE)
+		{
+			UE_LOG(LogOrionAI, Warning, TEXT("Nerd Herd: %d posts already in flight - dropping a %s post"), Posts.Num(), *Targets[Target].Name);
+			return;
+		}
+
+		UE_LOG(LogOrionAI, Warning, TEXT("Nerd Herd: too many pending posts - dropping the oldest %s post"), *Targets[Posts[Oldest]->Target].Name);
+		Posts.RemoveAt(Oldest);
+	}
+
+	FPostRef Post = MakeShared<FPost, ESPMode::ThreadSafe>();
+	Post->Target = Target;
+	Post->Payload = MoveTemp(Payload);
+	Posts.Add(Post);
+}
+
+void FNerdHerdDispatcher::PumpPosts(double Now)
+{
+	for (int32 Index = 0; Index < Posts.Num(); )
+	{
+		const FPostRef& Post = Posts[Index];
+
+		if (Post->State == EPostState::InFlight && Post->bCompleted.load(std::memory_order_acquire))
+		{
+			Post->Request.Reset();
+
+			const int32 Code = Post->ResponseCode;
+			const bool bRetryable = Code == 0 || Code == 429 || Code >= 500;
+			if (Code >= 200 && Code < 300)
+			{
+				Post->State = EPostState::Done;
+			}
+			else if (bRetryable && Post->Attempts <= MaxRetries && !bStopRequested)
+			{
+				const double Backoff = FMath::Min(RetryBackoffSeconds * FMath::Pow(2.0, (double)(Post->Attempts - 1)), MaxRetryBackoffSeconds);
+				Post->NextAttemptTime = Now + FMath::Max(Backoff, Post->RetryAfterSeconds);
+				Post->State = EPostState::Waiting;
+			}
+			else
+			{
+				UE_LOG(LogOrionAI, Warning, TEXT("Nerd Herd: %s post failed (HTTP %d) after %d attempt(s)"),
+					*Targets[Post->Target].Name, Code, Post->Attempts);
+				FailedPosts.fetch_add(1, std::memory_order_relaxed);
+				Post->State = EPostState::Done;
+			}
+		}
+
+		if (Post->State == EPostState::Waiting && Post->NextAttemptTime <= Now)
+		{
+			Send(Post);
+		}
+
+		if (Post->State == EPostState::Done)
+		{
+			Posts.RemoveAt(Index);
+		}
+		else
+		{
+			++Index;
+		}
+	}
+}
+
+void FNerdHerdDispatcher::Send(const FPostRef& Post)
+{
+	const FTarget& Target = Targets[Post->Target];
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Target.Url);
+	Request->SetVerb(TEXT("POST"));
+	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	for (const TPair<FString, FString>& Header : Target.Headers)
+	{
+		Request->SetHeader(Header.Key, Header.Value);
+	}
+	Request->SetContentAsString(Post->Payload);
+	Request->SetTimeout(RequestTimeoutSeconds);
+
+	// The dispatch thread polls for the result; nothing here may wait on the game thread
+	Request->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+
+	TWeakPtr<FPost, ESPMode::ThreadSafe> WeakPost = Post;
+	Request->OnProcessRequestComplete().BindLambda([WeakPost](FHttpRequestPtr, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+	{
+		TSharedPtr<FPost, ESPMode::ThreadSafe> Completed = WeakPost.Pin();
+		if (!Completed)
+		{
+			return;
+		}
+
+		Completed->ResponseCode = bConnectedSuccessfully && Response.IsValid() ? Response->GetResponseCode() : 0;
+		Completed->RetryAfterSeconds = Response.IsValid() ? FCString::Atod(*Response->GetHeader(TEXT("Retry-After"))) : 0.0;
+		Completed->bCompleted.store(true, std::memory_order_release);
+	});
+
+	++Post->Attempts;
+	Post->State = EPostState::InFlight;
+	Post->bCompleted.store(false, std::memory_order_relaxed);
+	Post->Request = Request;
+
+	if (!Request->ProcessRequest())
+	{
+		Post->ResponseCode = 0;
+		Post->bCompleted.store(true, std::memory_order_release);
+	}
+}
+
+double FNerdHerdDispatcher::GetWaitSeconds(double Now) const
+{
+	double Wait = 1.0;
+
+	if (Batch.Num() > 0)
+	{
+		Wait = FMath::Min(Wait, BatchOpenedAt + BatchDelaySeconds - Now);
+	}
+
+	// Only windows with a summary to write need closing on time
+	for (const TPair<TPair<FString, uint32>, FCoalesced>& Window : Windows)
+	{
+		if (Window.Value.Suppressed > 0)
+		{
+			Wait = FMath::Min(Wait, Window.Value.WindowEnd - Now);
+		}
+	}
+
+	for (const FPostRef& Post : Posts)
+	{
+		Wait = FMath::Min(Wait, Post->State == EPostState::InFlight
+			? NerdHerd::InFlightPollSeconds
+			: Post->NextAttemptTime - Now);
+	}
+
+	return FMath::Max(Wait, 0.001);
+}
@@ -0,0 +1,219 @@
+// OrionAI - Compiled multi-pattern matcher
+// Engine front end for the core's Aho-Corasick automaton over the Intersect/Fulcrum pattern lists
+
+#include "OrionPatternMatcher.h"
+#include "CaseyProtocol.h"
+#include "OrionCoreText.h"
+
+namespace OrionPatternMatcher
+{
+	template <typename T>
+	static OrionCore::TTableView<T> ToCore(TConstArrayView<T> View)
+	{
+		return OrionCore::TTableView<T>(View.GetData(), View.Num());
+	}
+
+	static OrionCore::TTableView<OrionCore::FChar> ToCore(TConstArrayView<TCHAR> View)
+	{
+		return OrionCore::TTableView<OrionCore::FChar>(reinterpret_cast<const OrionCore::FChar*>(View.GetData()), View.Num());
+	}
+
+	template <typename T>
+	static TConstArrayView<T> FromCore(OrionCore::TTableView<T> View)
+	{
+		return TConstArrayView<T>(View.GetData(), View.Num());
+	}
+
+	static TConstArrayView<TCHAR> FromCore(OrionCore::TTableView<OrionCore::FChar> View)
+	{
+		return TConstArrayView<TCHAR>(OrionCoreText::FromCore(View.GetData()), View.Num());
+	}
+
+	static OrionCore::FMatcherTables ToCoreTables(const FOrionPatternMatcher::FTables& In)
+	{
+		OrionCore::FMatcherTables Out;
+		Out.NumClasses = In.NumClasses;
+		Out.NumStates = In.NumStates;
+		Out.bUnicodeFolding = In.bUnicodeFolding;
+		Out.bNormalized = In.bNormalized;
+		Out.MaxEditDistance = In.MaxEditDistance;
+		Out.MinFuzzyLength = In.MinFuzzyLength;
+		Out.SkipClass = In.SkipClass;
+		Out.SpaceClass = In.SpaceClass;
+		Out.AsciiClasses = ToCore(In.AsciiClasses);
+		Out.FoldedAsciiClasses = ToCore(In.FoldedAsciiClasses);
+		Out.WideChars = ToCore(In.WideChars);
+		Out.WideCharClasses = ToCore(In.WideCharClasses);
+		Out.Transitions = ToCore(In.Transitions);
+		Out.OutputOffsets = ToCore(In.OutputOffsets);
+		Out.OutputPatterns = ToCore(In.OutputPatterns);
+		Out.DictionaryLinks = ToCore(In.DictionaryLinks);
+		Out.PatternCategories = ToCore(In.PatternCategories);
+		Out.PatternCategoryIndices = ToCore(In.PatternCategoryIndices);
+		Out.PatternTextOffsets = ToCore(In.PatternTextOffsets);
+		Out.PatternText = ToCore(In.PatternText);
+		Out.CategoryOffsets = ToCore(In.CategoryOffsets);
+		Out.CategoryPatterns = ToCore(In.CategoryPatterns);
+		Out.SeedPatterns = ToCore(In.SeedPatterns);
+		Out.SeedEnds = ToCore(In.SeedEnds);
+		Out.FuzzyOffsets = ToCore(In.FuzzyOffsets);
+		Out.FuzzyClasses = ToCore(In.FuzzyClasses);
+		return Out;
+	}
+
+	static FOrionPatternMatcher::FTables FromCoreTables(const OrionCore::FMatcherTables& In)
+	{
+		FOrionPatternMatcher::FTables Out;
+		Out.NumClasses = In.NumClasses;
+		Out.NumStates = In.NumStates;
+		Out.bUnicodeFolding = In.bUnicodeFolding;
+		Out.bNormalized = In.bNormalized;
+		Out.MaxEditDistance = In.MaxEditDistance;
+		Out.MinFuzzyLength = In.MinFuzzyLength;
+		Out.SkipClass = In.SkipClass;
+		Out.SpaceClass = In.SpaceClass;
+		Out.AsciiClasses = FromCore(In.AsciiClasses);
+		Out.FoldedAsciiClasses = FromCore(In.FoldedAsciiClasses);
+		Out.WideChars = FromCore(In.WideChars);
+		Out.WideCharClasses = FromCore(In.WideCharClasses);
+		Out.Transitions = FromCore(In.Transitions);
+		Out.OutputOffsets = FromCore(In.OutputOffsets);
+		Out.OutputPatterns = FromCore(In.OutputPatterns);
+		Out.DictionaryLinks = FromCore(In.DictionaryLinks);
+		Out.PatternCategories = FromCore(In.PatternCategories);
+		Out.PatternCategoryIndices = FromCore(In.PatternCategoryIndices);
+		Out.PatternTextOffsets = FromCore(In.PatternTextOffsets);
+		Out.PatternText = FromCore(In.PatternText);
+		Out.CategoryOffsets = FromCore(In.CategoryOffsets);
+		Out.CategoryPatterns = FromCore(In.CategoryPatterns);
+		Out.SeedPatterns = FromCore(In.SeedPatterns);
+		Out.SeedEnds = FromCore(In.SeedEnds);
+		Out.FuzzyOffsets = FromCore(In.FuzzyOffsets);
+		Out.FuzzyClasses = FromCore(In.FuzzyClasses);
+		return Out;
+	}
+}
+
+TSharedRef<const FOrionPatternMatcher, ESPMode::ThreadSafe> FOrionPatternMatcher::Build(
+	const FIntersectScannerConfig& IntersectConfig,
+	const FFulcrumFilterConfig& FulcrumConfig)
+{
+	TSharedRef<FOrionPatternMatcher, ESPMode::ThreadSafe> Matcher = MakeShared<FOrionPatternMatcher, ESPMode::ThreadSafe>();
+
+	auto AddAll = [&Matcher](EOrionPatternCategory Category, const TArray<FString>& List)
+	{
+		for (const FString& Pattern : List)
+		{
+			Matcher->AddPattern(Category, Pattern);
+		}
+	};
+
+	if (IntersectConfig.bEnabled)
+	{
+		AddAll(EOrionPatternCategory::Hallucination, IntersectConfig.HallucinationPatterns);
+		AddAll(EOrionPatternCategory::Bias, IntersectConfig.BiasKeywords);
+		AddAll(EOrionPatternCategory::Toxicity, IntersectConfig.ToxicityPatterns);
+	}
+
+	if (FulcrumConfig.bEnabled)
+	{
+		AddAll(EOrionPatternCategory::PromptInjection, FulcrumConfig.PromptInjectionPatterns);
+		AddAll(EOrionPatternCategory::DataExfiltration, FulcrumConfig.DataExfiltrationPatterns);
+	}
+
+	FOptions Options;
+	Options.CaseFolding = IntersectConfig.CaseFolding;
+	Options.bNormalize = IntersectConfig.bNormalizeText;
+	Options.MaxEditDistance = IntersectConfig.MaxEditDistance;
+	Options.MinFuzzyLength = IntersectConfig.MinFuzzyPatternLength;
+	Matcher->Compile(Options);
+	return Matcher;
+}
+
+TSharedRef<const FOrionPatternMatcher, ESPMode::ThreadSafe> FOrionPatternMatcher::BuildSubset(
+	const FOrionPatternMatcher& Source,
+	uint32 CategoryMask)
+{
+	check(Source.Core.IsCompiled());
+
+	TSharedRef<FOrionPatternMatcher, ESPMode::ThreadSafe> Matcher = MakeShared<FOrionPatternMatcher, ESPMode::ThreadSafe>();
+	Matcher->Core.AddPatternsFrom(Source.Core, CategoryMask);
+	Matcher->Core.Compile(Source.Core.GetOptions());
+	Matcher->MirrorCoreTables();
+	return Matcher;
+}
+
+TSharedPtr<const FOrionPatternMatcher, ESPMode::ThreadSafe> FOrionPatternMatcher::FromTables(
+	const FTables& InTables,
+	TSharedRef<const FCaseyProtocolBlob, ESPMode::ThreadSafe> InBacking)
+{
+	TSharedRef<FOrionPatternMatcher, ESPMode::ThreadSafe> Matcher = MakeShared<FOrionPatternMatcher, ESPMode::ThreadSafe>();
+	if (!Matcher->Core.CompileFromTables(OrionPatternMatcher::ToCoreTables(InTables)))
+	{
+		return nullptr;
+	}
+
+	Matcher->Backing = InBacking;
+	Matcher->MirrorCoreTables();
+	return Matcher;
+}
+
+bool FOrionPatternMatcher::FTables::IsConsistent() const
+{
+	return OrionPatternMatcher::ToCoreTables(*this).IsConsistent();
+}
+
+void FOrionPatternMatcher::AddPattern(EOrionPatternCategory Category, const FString& Pattern)
+{
+	check(!Core.IsCompiled());
+
+	Core.AddPattern(Category, OrionCoreText::ToCore(Pattern));
+}
+
+void FOrionPatternMatcher::Compile(const FOptions& Options)
+{
+	check(!Core.IsCompiled());
+
+	OrionCore::FMatcherOptions CoreOptions;
+	CoreOptions.bUnicodeFolding = Options.CaseFolding == EOrionCaseFolding::Unicode;
+	CoreOptions.bNormalize = Options.bNormalize;
+	CoreOptions.MaxEditDistance = Options.MaxEditDistance;
+	CoreOptions.MinFuzzyLength = Options.MinFuzzyLength;
+	Core.Compile(CoreOptions);
+	MirrorCoreTables();
+}
+
+void FOrionPatternMatcher::MirrorCoreTables()
+{
+	Tables = OrionPatternMatcher::FromCoreTables(Core.GetTables());
+}
+
+void FOrionPatternMatcher::Scan(FStringView Text, FScanResult& OutResult) const
+{
+	Core.Scan(OrionCoreText::ToCore(Text), OutResult);
+}
+
+int32 FOrionPatternMatcher::ScanChunk(FStringView Text, int32 State, FScanResult& InOutResult) const
+{
+	return Core.ScanChunk(OrionCoreText::ToCore(Text), State, InOutResult);
+}
+
+int32 FOrionPatternMatcher::ScanRange(FStringView Text, int32 Start, int32 End, int32 State, FScanResult& InOutResult, FPendingSeeds* OutPending) const
+{
+	return Core.ScanRange(OrionCoreText::ToCore(Text), Start, End, State, InOutResult, OutPending);
+}
+
+void FOrionPatternMatcher::VerifyPending(FStringView Text, FPendingSeeds& InOutPending, FScanResult& InOutResult) const
+{
+	Core.VerifyPending(OrionCoreText::ToCore(Text), InOutPending, InOutResult);
+}
+
+bool FOrionPatternMatcher::ScanFirst(FStringView Text, EOrionPatternCategory& OutCategory) const
+{
+	return Core.ScanFirst(OrionCoreText::ToCore(Text), OutCategory);
+}
+
+const TCHAR* FOrionPatternMatcher::GetPattern(EOrionPatternCategory Category, int32 Index) const
+{
+	return OrionCoreText::FromCore(Core.GetPattern(Category, Index));
+}
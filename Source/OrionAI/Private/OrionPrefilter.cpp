@@ -0,0 +1,44 @@
+// OrionAI - SIMD prefilters
+// Engine front end for the core's prefilter level
+
+#include "OrionPrefilter.h"
+#include "OrionAI.h"
+#include "OrionCoreText.h"
+
+namespace OrionPrefilter
+{
+	EOrionSimdLevel GetSupportedLevel()
+	{
+		return OrionCore::Prefilter::GetSupportedLevel();
+	}
+
+	EOrionSimdLevel GetActiveLevel()
+	{
+		return OrionCore::Prefilter::GetActiveLevel();
+	}
+
+	void SetActiveLevel(EOrionSimdLevel Level)
+	{
+		if (!OrionCore::Prefilter::IsSupported(Level))
+		{
+			UE_LOG(LogOrionAI, Warning, TEXT("OrionAI: %s prefilter is not supported on this CPU, using %s"), LexToString(Level), LexToString(GetSupportedLevel()));
+		}
+		OrionCore::Prefilter::SetActiveLevel(Level);
+	}
+
+	const TCHAR* LexToString(EOrionSimdLevel Level)
+	{
+		switch (Level)
+		{
+		case EOrionSimdLevel::SSE41: return TEXT("SSE4.1");
+		case EOrionSimdLevel::AVX2:  return TEXT("AVX2");
+		case EOrionSimdLevel::NEON:  return TEXT("NEON");
+		default:                     return TEXT("Scalar");
+		}
+	}
+
+	int32 FindPiiCandidate(FStringView Text, int32 Start)
+	{
+		return OrionCore::Prefilter::FindPiiCandidate(OrionCoreText::ToCore(Text), Start);
+	}
+}
@@ -0,0 +1,51 @@
+// OrionAI - Report views
+// Arena-backed reports that point into the caller's strings
+
+#include "OrionReportView.h"
+
+FOrionValidationReportView FOrionValidationReportView::Make(FOrionReportArena& Arena, FStringView AISystem, FStringView Decision, FStringView Context,
+	const FOrionValidationReport& Report)
+{
+	FOrionValidationReportView View;
+	View.Result = Report.Result;
+	View.AISystem = AISystem;
+	View.OriginalDecision = Decision;
+	View.Context = Context;
+	View.ProtocolVersion = Report.ProtocolVersion;
+	View.SuspicionScore = Report.SuspicionScore;
+	View.ConfidenceScore = Report.ConfidenceScore;
+	View.Timestamp = Report.Timestamp;
+	View.bCheapChecksOnly = Report.bCheapChecksOnly;
+	View.bShed = Report.bShed;
+
+	// Only a rewrite is copied; otherwise the sanitized text is the decision itself
+	View.SanitizedDecision = Report.WasSanitized() ? Arena.CopyString(Report.SanitizedDecision) : Decision;
+
+	const int32 NumRules = Report.TriggeredRules.Num();
+	FOrionRuleId* Rules = Arena.AllocArray<FOrionRuleId>(NumRules);
+	if (NumRules > 0)
+	{
+		FMemory::Memcpy(Rules, Report.TriggeredRules.GetData(), NumRules * sizeof(FOrionRuleId));
+	}
+	View.TriggeredRules = TConstArrayView<FOrionRuleId>(Rules, NumRules);
+
+	return View;
+}
+
+FOrionValidationReport FOrionValidationReportView::ToReport() const
+{
+	FOrionValidationReport Report;
+	Report.Result = Result;
+	Report.AISystem = FString(AISystem);
+	Report.OriginalDecision = FString(OriginalDecision);
+	Report.SanitizedDecision = FString(SanitizedDecision);
+	Report.Context = FString(Context);
+	Report.TriggeredRules = TArray<FOrionRuleId>(TriggeredRules.GetData(), TriggeredRules.Num());
+	Report.ProtocolVersion = ProtocolVersion;
+	Report.SuspicionScore = SuspicionScore;
+	Report.ConfidenceScore = ConfidenceScore;
+	Report.Timestamp = Timestamp;
+	Report.bCheapChecksOnly = bCheapChecksOnly;
+	Report.bShed = bShed;
+	return Report;
+}
@@ -0,0 +1,510 @@
+// OrionAI - Ring Intel inference backend
+// One shared NNE model, one inference thread, dynamic micro-batching
+
+#include "OrionRingIntel.h"
+#include "OrionAI.h"
+#include "CaseyProtocol.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+#include "NNE.h"
+#include "NNEModelData.h"
+#include "NNERuntimeCPU.h"
+#include "NNETypes.h"
+
+namespace RingIntel
+{
+	// Words longer than this become [UNK] instead of being split, as in BERT
+	static constexpr int32 MaxWordChars = 100;
+
+	// How often a waiting caller checks its cancellation token
+	static constexpr uint32 CancellationPollMs = 1;
+
+	static FString ResolvePath(const FString& Path)
+	{
+		return FPaths::IsRelative(Path) ? FPaths::ProjectDir() / Path : Path;
+	}
+}
+
+// ========== Tokenizer ==========
+
+bool FRingIntelTokenizer::Load(const FString& VocabPath)
+{
+	FString Contents;
+	if (!FFileHelper::LoadFileToString(Contents, *VocabPath))
+	{
+		return false;
+	}
+
+	// Empty lines are still ids, so don't cull them
+	TArray<FString> Lines;
+	Contents.ParseIntoArray(Lines, TEXT("\n"), false);
+
+	Vocab.Reset();
+	Vocab.Reserve(Lines.Num());
+	for (int32 Index = 0; Index < Lines.Num(); ++Index)
+	{
+		FString& Line = Lines[Index];
+		Line.RemoveFromEnd(TEXT("\r"));
+		Vocab.Add(MoveTemp(Line), Index);
+	}
+
+	const int64* Unknown = Vocab.Find(TEXT("[UNK]"));
+	const int64* Classify = Vocab.Find(TEXT("[CLS]"));
+	const int64* Separator = Vocab.Find(TEXT("[SEP]"));
+	if (!Unknown || !Classify || !Separator)
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("Ring Intel: %s is missing [UNK], [CLS] or [SEP]"), *VocabPath);
+		return false;
+	}
+
+	UnknownId = *Unknown;
+	ClassifyId = *Classify;
+	SeparatorId = *Separator;
+	const int64* Pad = Vocab.Find(TEXT("[PAD]"));
+	PadId = Pad ? *Pad : 0;
+	return true;
+}
+
+void FRingIntelTokenizer::Encode(FStringView Text, int32 MaxTokens, TArray<int64>& OutTokenIds) const
+{
+	const int32 MaxPieces = FMath::Max(0, MaxTokens - 2);
+
+	OutTokenIds.Reset();
+	OutTokenIds.Add(ClassifyId);
+
+	TStringBuilder<128> Word;
+	auto FlushWord = [this, &Word, &OutTokenIds]()
+	{
+		if (Word.Len() > 0)
+		{
+			EncodeWord(Word.ToView(), OutTokenIds);
+			Word.Reset();
+		}
+	};
+
+	for (const TCHAR Char : Text)
+	{
+		// +1 for [CLS]; once full, the rest of the text can't change the encoding
+		if (OutTokenIds.Num() > MaxPieces)
+		{
+			break;
+		}
+
+		if (FChar::IsWhitespace(Char))
+		{
+			FlushWord();
+		}
+		else if (FChar::IsPunct(Char))
+		{
+			FlushWord();
+			Word.AppendChar(Char);
+			FlushWord();
+		}
+		else
+		{
+			Word.AppendChar(FChar::ToLower(Char));
+		}
+	}
+	FlushWord();
+
+	OutTokenIds.SetNum(FMath::Min(OutTokenIds.Num(), MaxPieces + 1));
+	OutTokenIds.Add(SeparatorId);
+}
+
+void FRingIntelTokenizer::EncodeWord(FStringView Word, TArray<int64>& OutTokenIds) const
+{
+	if (Word.Len() > RingIntel::MaxWordChars)
+	{
+		OutTokenIds.Add(UnknownId);
+		return;
+	}
+
+	const int32 FirstPiece = OutTokenIds.Num();
+	FString Piece;
+	int32 Start = 0;
+	while (Start < Word.Len())
+	{
+		// Longest piece in the vocabulary starting at Start; continuations carry "##"
+		int32 End = Word.Len();
+		const int64* Id = nullptr;
+		for (; End > Start; --End)
+		{
+			Piece.Reset();
+			if (Start > 0)
+			{
+				Piece += TEXT("##");
+			}
+			Piece.AppendChars(Word.GetData() + Start, End - Start);
+
+			Id = Vocab.Find(Piece);
+			if (Id)
+			{
+				break;
+			}
+		}
+
+		if (!Id)
+		{
+			OutTokenIds.SetNum(FirstPiece);
+			OutTokenIds.Add(UnknownId);
+			return;
+		}
+
+		OutTokenIds.Add(*Id);
+		Start = End;
+	}
+}
+
+// ========== Backend ==========
+
+FRingIntelBackend::FRequest::FRequest()
+{
+	DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
+}
+
+FRingIntelBackend::FRequest::~FRequest()
+{
+	FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+}
+
+FRingIntelBackend& FRingIntelBackend::Get()
+{
+	static FRingIntelBackend Backend;
+	return Backend;
+}
+
+FRingIntelBackend::~FRingIntelBackend()
+{
+	Stop();
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+}
+
+bool FRingIntelBackend::Start(const FRingIntelConfig& Config)
+{
+	if (bRunning)
+	{
+		return true;
+	}
+
+	const FString VocabPath = RingIntel::ResolvePath(Config.VocabPath);
+	if (!Tokenizer.Load(VocabPath))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("Ring Intel: failed to load vocabulary %s"), *VocabPath);
+		return false;
+	}
+
+	const bool bQuantized = Config.Precision == EOrionModelPrecision::Int8;
+	const FString ModelPath = RingIntel::ResolvePath(bQuantized ? Config.QuantizedModelPath : Config.ModelPath);
+	TArray<uint8> ModelBytes;
+	if (!FFileHelper::LoadFileToArray(ModelBytes, *ModelPath))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("Ring Intel: failed to load model %s"), *ModelPath);
+		return false;
+	}
+
+	TWeakInterfacePtr<INNERuntimeCPU> Runtime = UE::NNE::GetRuntime<INNERuntimeCPU>(Config.Runtime);
+	if (!Runtime.IsValid())
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("Ring Intel: NNE runtime %s is not available"), *Config.Runtime);
+		return false;
+	}
+
+	// Rooted only until the runtime has built its own copy of the model
+	TStrongObjectPtr<UNNEModelData> ModelData(NewObject<UNNEModelData>());
+	ModelData->Init(FPaths::GetExtension(ModelPath), ModelBytes);
+	ModelBytes.Empty();
+
+	if (Runtime->CanCreateModelCPU(ModelData.Get()) == INNERuntimeCPU::ECanCreateModelCPUStatus::Ok)
+	{
+		ModelCPU = Runtime->CreateModelCPU(ModelData.Get());
+	}
+	Model = ModelCPU ? ModelCPU->CreateModelInstanceCPU() : nullptr;
+	if (!Model)
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("Ring Intel: %s could not create a model from %s"), *Config.Runtime, *ModelPath);
+		ModelCPU.Reset();
+		return false;
+	}
+
+	// Bind inputs by name, so exports with or without token_type_ids both work
+	Inputs.Reset();
+	for (const UE::NNE::FTensorDesc& Desc : Model->GetInputTensorDescs())
+	{
+		FInputBinding& Input = Inputs.AddDefaulted_GetRef();
+		if (Desc.GetName() == TEXT("attention_mask"))
+		{
+			Input.Kind = EInput::AttentionMask;
+		}
+		else if (Desc.GetName() == TEXT("token_type_ids"))
+		{
+			Input.Kind = EInput::TokenTypeIds;
+		}
+
+		Input.bInt64 = Desc.GetDataType() == ENNETensorDataType::Int64;
+		if (!Input.bInt64 && Desc.GetDataType() != ENNETensorDataType::Int32)
+		{
+			UE_LOG(LogOrionAI, Error, TEXT("Ring Intel: model input %s must be int32 or int64"), *Desc.GetName());
+			Stop();
+			return false;
+		}
+	}
+
+	// A single [batch, labels] float output, with the label count fixed in the model
+	TConstArrayView<UE::NNE::FTensorDesc> OutputDescs = Model->GetOutputTensorDescs();
+	NumLabels = OutputDescs.Num() == 1 && OutputDescs[0].GetShape().Rank() == 2 ? OutputDescs[0].GetShape().GetData()[1] : 0;
+	bSoftmax = Config.Activation == EOrionModelActivation::Softmax;
+	if (Inputs.Num() == 0 || NumLabels < (bSoftmax ? 2 : 1) || OutputDescs[0].GetDataType() != ENNETensorDataType::Float)
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("Ring Intel: %s must take token ids and return one float [batch, labels] tensor"), *ModelPath);
+		Stop();
+		return false;
+	}
+
+	MaxSequenceLength = FMath::Max(2, Config.MaxSequenceLength);
+	MaxBatchSize = FMath::Max(1, Config.MaxBatchSize);
+	MaxBatchDelaySeconds = FMath::Max(0.0f, Config.MaxBatchDelayMs) / 1000.0;
+
+	// Kept for the backend's lifetime: a caller that raced a Stop() may still trigger it
+	if (!WakeEvent)
+	{
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	}
+
+	bStopRequested = false;
+	bRunning.store(true, std::memory_order_release);
+	Thread = FRunnableThread::Create(this, TEXT("OrionAIRingIntel"), 0, TPri_Normal);
+
+	UE_LOG(LogOrionAI, Log, TEXT("✓ Ring Intel: %s loaded on %s (%s, %d labels, batches of up to %d)"),
+		*ModelPath, *Config.Runtime, bQuantized ? TEXT("int8") : TEXT("fp32"), NumLabels, MaxBatchSize);
+	return true;
+}
+
+void FRingIntelBackend::Stop()
+{
+	// Refuse new requests first, so nothing queues up behind the final drain
+	const bool bWasRunning = bRunning.exchange(false, std::memory_order_acq_rel);
+	if (bWasRunning)
+	{
+		bStopRequested = true;
+		WakeEvent->Trigger();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+
+		FailQueued();
+	}
+
+	Model.Reset();
+	ModelCPU.Reset();
+	Inputs.Reset();
+}
+
+bool FRingIntelBackend::Classify(FStringView Text, float& OutToxicity, const FOrionCancellationToken& Token)
+{
+	if (!IsRunning())
+	{
+		return false;
+	}
+
+	FRequestRef Request = MakeShared<FRequest, ESPMode::ThreadSafe>();
+	Tokenizer.Encode(Text, MaxSequenceLength, Request->TokenIds);
+	Request->QueuedTime = FPlatformTime::Seconds();
+
+	Queue.Enqueue(Request);
+	WakeEvent->Trigger();
+
+	// The request is shared, so giving up early just leaves it to the inference thread
+	while (!Request->DoneEvent->Wait(RingIntel::CancellationPollMs))
+	{
+		if (Token.IsCancelled() || !IsRunning())
+		{
+			Request->bAbandoned = true;
+			return false;
+		}
+	}
+
+	OutToxicity = Request->Toxicity;
+	return Request->bSucceeded;
+}
+
+uint32 FRingIntelBackend::Run()
+{
+	TArray<FRequestRef> Batch;
+	Batch.Reserve(MaxBatchSize);
+
+	while (!bStopRequested)
+	{
+		CollectBatch(Batch);
+		if (Batch.Num() > 0)
+		{
+			RunBatch(Batch);
+		}
+	}
+
+	return 0;
+}
+
+void FRingIntelBackend::CollectBatch(TArray<FRequestRef>& OutBatch)
+{
+	OutBatch.Reset();
+	TSharedPtr<FRequest, ESPMode::ThreadSafe> Request;
+
+	// Sleep until there is a request someone is still waiting on
+	while (OutBatch.Num() == 0)
+	{
+		if (bStopRequested)
+		{
+			return;
+		}
+
+		if (!Queue.Dequeue(Request))
+		{
+			WakeEvent->Wait();
+		}
+		else if (!Request->bAbandoned)
+		{
+			OutBatch.Add(Request.ToSharedRef());
+		}
+	}
+
+	// Then give concurrent callers until the first request's deadline to join it
+	const double Deadline = OutBatch[0]->QueuedTime + MaxBatchDelaySeconds;
+	while (OutBatch.Num() < MaxBatchSize && !bStopRequested)
+	{
+		if (Queue.Dequeue(Request))
+		{
+			if (!Request->bAbandoned)
+			{
+				OutBatch.Add(Request.ToSharedRef());
+			}
+			continue;
+		}
+
+		const double Remaining = Deadline - FPlatformTime::Seconds();
+		if (Remaining <= 0.0)
+		{
+			break;
+		}
+		WakeEvent->Wait(FTimespan::FromSeconds(Remaining));
+	}
+}
+
+void FRingIntelBackend::RunBatch(TArray<FRequestRef>& Batch)
+{
+	// Pad to the longest text in this batch, not to MaxSequenceLength
+	int32 SequenceLength = 1;
+	for (const FRequestRef& Request : Batch)
+	{
+		SequenceLength = FMath::Max(SequenceLength, Request->TokenIds.Num());
+	}
+
+	const int32 BatchSize = Batch.Num();
+	const int32 NumElements = BatchSize * SequenceLength;
+	const uint32 ShapeData[] = { (uint32)BatchSize, (uint32)SequenceLength };
+	const UE::NNE::FTensorShape Shape = UE::NNE::FTensorShape::Make(ShapeData);
+
+	TArray<UE::NNE::FTensorShape, TInlineAllocator<3>> InputShapes;
+	TArray<UE::NNE::FTensorBindingCPU, TInlineAllocator<3>> InputBindings;
+	for (FInputBinding& Input : Inputs)
+	{
+		auto Fill = [&Batch, &Input, SequenceLength, this](auto* Data)
+		{
+			using FElement = std::remove_pointer_t<decltype(Data)>;
+			for (int32 Row = 0; Row < Batch.Num(); ++Row)
+			{
+				const TArray<int64>& TokenIds = Batch[Row]->TokenIds;
+				for (int32 Column = 0; Column < SequenceLength; ++Column)
+				{
+					const bool bToken = Column < TokenIds.Num();
+					int64 Value = 0;
+					switch (Input.Kind)
+					{
+					case EInput::TokenIds:      Value = bToken ? TokenIds[Column] : Tokenizer.GetPadId(); break;
+					case EInput::AttentionMask: Value = bToken ? 1 : 0; break;
+					case EInput::TokenTypeIds:  Value = 0; break;
+					}
+					*Data++ = (FElement)Value;
+				}
+			}
+		};
+
+		const int32 ElementSize = Input.bInt64 ? sizeof(int64) : sizeof(int32);
+		Input.Buffer.SetNumUninitialized(NumElements * ElementSize, EAllowShrinking::No);
+		if (Input.bInt64)
+		{
+			Fill(reinterpret_cast<int64*>(Input.Buffer.GetData()));
+		}
+		else
+		{
+			Fill(reinterpret_cast<int32*>(Input.Buffer.GetData()));
+		}
+
+		InputShapes.Add(Shape);
+		InputBindings.Add({ Input.Buffer.GetData(), (uint64)Input.Buffer.Num() });
+	}
+
+	Logits.SetNumUninitialized(BatchSize * NumLabels, EAllowShrinking::No);
+	const UE::NNE::FTensorBindingCPU OutputBinding{ Logits.GetData(), (uint64)Logits.Num() * sizeof(float) };
+
+	const bool bSucceeded =
+		Model->SetInputTensorShapes(InputShapes) == UE::NNE::IModelInstanceCPU::ESetInputTensorShapesStatus::Ok &&
+		Model->RunSync(InputBindings, MakeArrayView(&OutputBinding, 1)) == UE::NNE::IModelInstanceCPU::ERunSyncStatus::Ok;
+
+	if (!bSucceeded)
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("Ring Intel: inference failed for a batch of %d"), BatchSize);
+	}
+
+	for (int32 Row = 0; Row < BatchSize; ++Row)
+	{
+		FRequest& Request = *Batch[Row];
+		Request.Toxicity = bSucceeded ? ToToxicity(&Logits[Row * NumLabels]) : 0.0f;
+		Request.bSucceeded = bSucceeded;
+		Request.DoneEvent->Trigger();
+	}
+	Batch.Reset();
+}
+
+float FRingIntelBackend::ToToxicity(const float* RowLogits) const
+{
+	if (bSoftmax)
+	{
+		float MaxLogit = RowLogits[0];
+		for (int32 Label = 1; Label < NumLabels; ++Label)
+		{
+			MaxLogit = FMath::Max(MaxLogit, RowLogits[Label]);
+		}
+
+		float Sum = 0.0f;
+		for (int32 Label = 0; Label < NumLabels; ++Label)
+		{
+			Sum += FMath::Exp(RowLogits[Label] - MaxLogit);
+		}
+		return 1.0f - FMath::Exp(RowLogits[0] - MaxLogit) / Sum;
+	}
+
+	float MaxLogit = RowLogits[0];
+	for (int32 Label = 1; Label < NumLabels; ++Label)
+	{
+		MaxLogit = FMath::Max(MaxLogit, RowLogits[Label]);
+	}
+	return 1.0f / (1.0f + FMath::Exp(-MaxLogit));
+}
+
+void FRingIntelBackend::FailQueued()
+{
+	TSharedPtr<FRequest, ESPMode::ThreadSafe> Request;
+	while (Queue.Dequeue(Request))
+	{
+		Request->bSucceeded = false;
+		Request->DoneEvent->Trigger();
+	}
+}
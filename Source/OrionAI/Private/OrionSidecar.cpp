@@ -0,0 +1,539 @@
+// OrionAI - Ring Intel sidecar
+// One model per host; request slots in shared memory, handed over through lock-free rings
+
+#include "OrionSidecar.h"
+#include "OrionRingIntel.h"
+#include "OrionAI.h"
+#include "CaseyProtocol.h"
+#include "HAL/RunnableThread.h"
+
+namespace OrionSidecar
+{
+	static constexpr uint32 Magic = 0x534E524F;  // "ORNS"
+	static constexpr uint32 FormatVersion = 1;
+
+	// A daemon that hasn't beaten for this long is treated as gone
+	static constexpr double StaleHeartbeatSeconds = 2.0;
+
+	// How often a client without a live daemon tries to map the region again
+	static constexpr double RemapIntervalSeconds = 1.0;
+
+	// Waiting threads spin through the first polls, then sleep between them - longer once idle for a while
+	static constexpr int32 SpinPolls = 64;
+	static constexpr int32 ShortSleepPolls = 1024;
+	static constexpr float ShortSleepSeconds = 0.0001f;
+	static constexpr float LongSleepSeconds = 0.001f;
+
+	static_assert(std::atomic<uint32>::is_always_lock_free && std::atomic<uint64>::is_always_lock_free,
+		"Atomics shared between processes must not hide a lock");
+
+	enum ESlotState : uint32
+	{
+		Free,
+		Submitted,  // Queued or being scored
+		Done,       // Answered; the client frees it
+		Abandoned   // The client stopped waiting; the daemon frees it
+	};
+
+	/** Cursors of a bounded MPMC ring (Vyukov); its cells live elsewhere in the region */
+	struct FRing
+	{
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Head{ 0 };
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Tail{ 0 };
+	};
+
+	struct FCell
+	{
+		std::atomic<uint32> Sequence{ 0 };
+		uint32 SlotIndex = 0;
+	};
+
+	/** One request and its answer; MaxTextChars of text follow it */
+	struct FSlot
+	{
+		std::atomic<uint32> State{ Free };
+		int32 NumChars = 0;
+		float Toxicity = 0.0f;
+		uint32 bSucceeded = 0;
+
+		TCHAR* GetText() { return reinterpret_cast<TCHAR*>(this + 1); }
+	};
+
+	static bool Push(FRing& Ring, FCell* Cells, uint32 Mask, uint32 SlotIndex)
+	{
+		uint32 Position = Ring.Tail.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell = Cells[Position & Mask];
+			const int32 Lag = (int32)(Cell.Sequence.load(std::memory_order_acquire) - Position);
+			if (Lag == 0)
+			{
+				if (Ring.Tail.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					Cell.SlotIndex = SlotIndex;
+					Cell.Sequence.store(Position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Lag < 0)
+			{
+				return false;  // Full
+			}
+			else
+			{
+				Position = Ring.Tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	static bool Pop(FRing& Ring, FCell* Cells, uint32 Mask, uint32& OutSlotIndex)
+	{
+		uint32 Position = Ring.Head.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell = Cells[Position & Mask];
+			const int32 Lag = (int32)(Cell.Sequence.load(std::memory_order_acquire) - (Position + 1));
+			if (Lag == 0)
+			{
+				if (Ring.Head.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					OutSlotIndex = Cell.SlotIndex;
+					Cell.Sequence.store(Position + Mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Lag < 0)
+			{
+				return false;  // Empty
+			}
+			else
+			{
+				Position = Ring.Head.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/** Start of the region; the daemon writes the geometry, everyone shares the rings and slots */
+	struct FHeader
+	{
+		// Stored last, once the rest of the region is set up
+		std::atomic<uint32> Magic{ 0 };
+		uint32 FormatVersion = 0;
+		uint32 CharSize = 0;
+		uint32 NumSlots = 0;
+		uint32 MaxTextChars = 0;
+		uint32 RingMask = 0;
+		uint32 SlotStride = 0;
+		uint64 RequestCellsOffset = 0;
+		uint64 FreeCellsOffset = 0;
+		uint64 SlotsOffset = 0;
+		uint64 TotalBytes = 0;
+
+		// Bumped whenever a daemon (re)initializes the region
+		std::atomic<uint32> Epoch{ 0 };
+		std::atomic<uint32> bServing{ 0 };
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> HeartbeatCycles{ 0 };
+
+		FRing Requests;
+		FRing FreeSlots;
+
+		FCell* GetCells(uint64 Offset)
+		{
+			return reinterpret_cast<FCell*>(reinterpret_cast<uint8*>(this) + Offset);
+		}
+
+		FSlot& GetSlot(uint32 Index)
+		{
+			return *reinterpret_cast<FSlot*>(reinterpret_cast<uint8*>(this) + SlotsOffset + (uint64)Index * SlotStride);
+		}
+
+		// Neither ring can fill up: there are never more indices than slots
+		void Submit(uint32 SlotIndex)
+		{
+			verify(Push(Requests, GetCells(RequestCellsOffset), RingMask, SlotIndex));
+		}
+
+		bool TakeRequest(uint32& OutSlotIndex)
+		{
+			return Pop(Requests, GetCells(RequestCellsOffset), RingMask, OutSlotIndex);
+		}
+
+		bool TakeFreeSlot(uint32& OutSlotIndex)
+		{
+			return Pop(FreeSlots, GetCells(FreeCellsOffset), RingMask, OutSlotIndex);
+		}
+
+		void FreeSlot(uint32 SlotIndex)
+		{
+			GetSlot(SlotIndex).State.store(Free, std::memory_order_relaxed);
+			verify(Push(FreeSlots, GetCells(FreeCellsOffset), RingMask, SlotIndex));
+		}
+	};
+
+	static constexpr uint32 ReadWrite = (uint32)FPlatformMemory::ESharedMemoryAccess::Read | (uint32)FPlatformMemory::ESharedMemoryAccess::Write;
+
+	/** Set the geometry for NumSlots slots of MaxTextChars characters each */
+	static void ComputeLayout(uint32 NumSlots, uint32 MaxTextChars, FHeader& OutHeader)
+	{
+		const uint32 RingCapacity = FMath::RoundUpToPowerOfTwo(NumSlots);
+		const uint64 RingBytes = Align((uint64)RingCapacity * sizeof(FCell), PLATFORM_CACHE_LINE_SIZE);
+
+		OutHeader.NumSlots = NumSlots;
+		OutHeader.MaxTextChars = MaxTextChars;
+		OutHeader.RingMask = RingCapacity - 1;
+		OutHeader.SlotStride = Align(sizeof(FSlot) + MaxTextChars * sizeof(TCHAR), PLATFORM_CACHE_LINE_SIZE);
+		OutHeader.RequestCellsOffset = Align(sizeof(FHeader), PLATFORM_CACHE_LINE_SIZE);
+		OutHeader.FreeCellsOffset = OutHeader.RequestCellsOffset + RingBytes;
+		OutHeader.SlotsOffset = OutHeader.FreeCellsOffset + RingBytes;
+		OutHeader.TotalBytes = OutHeader.SlotsOffset + (uint64)NumSlots * OutHeader.SlotStride;
+	}
+
+	static bool IsAlive(const FHeader& Header, uint32 Epoch)
+	{
+		if (!Header.bServing.load(std::memory_order_acquire) || Header.Epoch.load(std::memory_order_acquire) != Epoch)
+		{
+			return false;
+		}
+
+		const uint64 Heartbeat = Header.HeartbeatCycles.load(std::memory_order_relaxed);
+		const uint64 Now = FPlatformTime::Cycles64();
+		return Now <= Heartbeat || FPlatformTime::ToSeconds64(Now - Heartbeat) < StaleHeartbeatSeconds;
+	}
+
+	static void WaitBeforePoll(int32 Poll)
+	{
+		if (Poll < SpinPolls)
+		{
+			FPlatformProcess::YieldThread();
+		}
+		else
+		{
+			FPlatformProcess::SleepNoStats(Poll < ShortSleepPolls ? ShortSleepSeconds : LongSleepSeconds);
+		}
+	}
+}
+
+// ========== Client ==========
+
+FOrionSidecarClient& FOrionSidecarClient::Get()
+{
+	static FOrionSidecarClient Client;
+	return Client;
+}
+
+FOrionSidecarClient::~FOrionSidecarClient()
+{
+	Stop();
+	for (const TUniquePtr<FMapping>& Mapping : Mappings)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Mapping->Region);
+	}
+}
+
+void FOrionSidecarClient::Start(const FSidecarConfig& Config)
+{
+	if (bStarted)
+	{
+		return;
+	}
+
+	RegionName = Config.RegionName;
+	TimeoutCycles = (uint64)(FMath::Max(1.0f, Config.RequestTimeoutMs) / 1000.0 / FPlatformTime::GetSecondsPerCycle64());
+	NextMapCycles = 0;
+	bStarted.store(true, std::memory_order_release);
+
+	if (!IsServing())
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("OrionAI: No OrionSidecar daemon serving '%s' yet - Ring Intel passes decisions until one starts"), *RegionName);
+	}
+}
+
+void FOrionSidecarClient::Stop()
+{
+	if (!bStarted.exchange(false))
+	{
+		return;
+	}
+
+	// The mappings themselves stay until exit - a caller on another thread may still be in Classify()
+	FScopeLock Lock(&MapLock);
+	Current.store(nullptr, std::memory_order_release);
+}
+
+bool FOrionSidecarClient::IsServing()
+{
+	return GetLiveMapping() != nullptr;
+}
+
+FOrionSidecarClient::FMapping* FOrionSidecarClient::GetLiveMapping()
+{
+	if (!IsStarted())
+	{
+		return nullptr;
+	}
+
+	FMapping* Mapping = Current.load(std::memory_order_acquire);
+	if (Mapping && OrionSidecar::IsAlive(*Mapping->Header, Mapping->Epoch))
+	{
+		return Mapping;
+	}
+
+	// One thread at a time, once a second, so a host without a daemon doesn't map per decision
+	const uint64 Now = FPlatformTime::Cycles64();
+	uint64 Due = NextMapCycles.load(std::memory_order_relaxed);
+	const uint64 RemapCycles = (uint64)(OrionSidecar::RemapIntervalSeconds / FPlatformTime::GetSecondsPerCycle64());
+	if (Now < Due || !NextMapCycles.compare_exchange_strong(Due, Now + RemapCycles, std::memory_order_relaxed))
+	{
+		return nullptr;
+	}
+	return TryMap();
+}
+
+FOrionSidecarClient::FMapping* FOrionSidecarClient::TryMap()
+{
+	using namespace OrionSidecar;
+
+	FScopeLock Lock(&MapLock);
+	if (!IsStarted())
+	{
+		return nullptr;
+	}
+
+	// The header says how big the rest of the region is
+	FPlatformMemory::FSharedMemoryRegion* Probe = FPlatformMemory::MapNamedSharedMemoryRegion(
+		RegionName, false, (uint32)FPlatformMemory::ESharedMemoryAccess::Read, sizeof(FHeader));
+	if (!Probe)
+	{
+		return nullptr;
+	}
+
+	const FHeader& ProbeHeader = *static_cast<const FHeader*>(Probe->GetAddress());
+	const bool bCompatible = ProbeHeader.Magic.load(std::memory_order_acquire) == Magic
+		&& ProbeHeader.FormatVersion == FormatVersion && ProbeHeader.CharSize == sizeof(TCHAR);
+	const uint64 TotalBytes = ProbeHeader.TotalBytes;
+	FPlatformMemory::UnmapNamedSharedMemoryRegion(Probe);
+
+	if (!bCompatible)
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("OrionAI: Sidecar region '%s' is not ready or was made by an incompatible build"), *RegionName);
+		return nullptr;
+	}
+
+	// Mapped afresh even after a daemon restart in place - callers may still hold the old mapping
+	FPlatformMemory::FSharedMemoryRegion* Region = FPlatformMemory::MapNamedSharedMemoryRegion(RegionName, false, ReadWrite, TotalBytes);
+	if (!Region)
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FMapping> Mapping = MakeUnique<FMapping>();
+	Mapping->Region = Region;
+	Mapping->Header = static_cast<FHeader*>(Region->GetAddress());
+	Mapping->Epoch = Mapping->Header->Epoch.load(std::memory_order_acquire);
+	if (!IsAlive(*Mapping->Header, Mapping->Epoch))
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+		return nullptr;
+	}
+
+	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionAI: Ring Intel served by the OrionSidecar daemon on '%s' (%u slots)"), *RegionName, Mapping->Header->NumSlots);
+
+	FMapping* Live = Mappings.Add_GetRef(MoveTemp(Mapping)).Get();
+	Current.store(Live, std::memory_order_release);
+	return Live;
+}
+
+bool FOrionSidecarClient::Classify(FStringView Text, float& OutToxicity, const FOrionCancellationToken& Token)
+{
+	using namespace OrionSidecar;
+
+	FMapping* Mapping = GetLiveMapping();
+	if (!Mapping)
+	{
+		return false;
+	}
+	FHeader& Header = *Mapping->Header;
+
+	// Every slot busy means the daemon is behind - waiting for one would only add to it
+	uint32 SlotIndex;
+	if (!Header.TakeFreeSlot(SlotIndex))
+	{
+		FailedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	FSlot& Slot = Header.GetSlot(SlotIndex);
+	const int32 NumChars = FMath::Min(Text.Len(), (int32)Header.MaxTextChars);
+	FMemory::Memcpy(Slot.GetText(), Text.GetData(), NumChars * sizeof(TCHAR));
+	Slot.NumChars = NumChars;
+	Slot.State.store(Submitted, std::memory_order_relaxed);
+	Header.Submit(SlotIndex);  // Publishes the text with it
+
+	const uint64 Deadline = FPlatformTime::Cycles64() + TimeoutCycles;
+	for (int32 Poll = 0; Slot.State.load(std::memory_order_acquire) != Done; Poll++)
+	{
+		const bool bDaemonAlive = IsAlive(Header, Mapping->Epoch);
+		if (!bDaemonAlive || Token.IsCancelled() || FPlatformTime::Cycles64() > Deadline)
+		{
+			// A re-initialized region isn't ours to touch any more; otherwise the daemon frees the slot once it gets to it
+			uint32 Expected = Submitted;
+			if (Header.Epoch.load(std::memory_order_acquire) != Mapping->Epoch
+				|| Slot.State.compare_exchange_strong(Expected, Abandoned, std::memory_order_acq_rel))
+			{
+				FailedCount.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			break;  // Answered just now after all
+		}
+		WaitBeforePoll(Poll);
+	}
+
+	OutToxicity = Slot.Toxicity;
+	const bool bSucceeded = Slot.bSucceeded != 0;
+	Header.FreeSlot(SlotIndex);
+	return bSucceeded;
+}
+
+// ========== Daemon ==========
+
+FOrionSidecarServer::~FOrionSidecarServer()
+{
+	Stop();
+}
+
+bool FOrionSidecarServer::Start(const FSidecarConfig& Config, int32 DefaultThreads)
+{
+	using namespace OrionSidecar;
+
+	if (Region)
+	{
+		return true;
+	}
+
+	FHeader Geometry;
+	ComputeLayout((uint32)FMath::Clamp(Config.Slots, 1, 65536), (uint32)FMath::Clamp(Config.MaxTextChars, 64, 1 << 20), Geometry);
+
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(Config.RegionName, true, ReadWrite, Geometry.TotalBytes);
+	if (!Region)
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("❌ OrionSidecar: Could not create shared memory region '%s' (%llu bytes)"), *Config.RegionName, Geometry.TotalBytes);
+		return false;
+	}
+	Header = static_cast<FHeader*>(Region->GetAddress());
+
+	// Clients of an earlier daemon may still map this region; a new epoch makes them let go of it
+	const bool bTakeOver = Header->Magic.load(std::memory_order_acquire) == Magic;
+	const uint32 Epoch = bTakeOver ? Header->Epoch.load(std::memory_order_relaxed) + 1 : 1;
+
+	new (Header) FHeader();
+	Header->FormatVersion = FormatVersion;
+	Header->CharSize = sizeof(TCHAR);
+	ComputeLayout(Geometry.NumSlots, Geometry.MaxTextChars, *Header);
+	Header->Epoch.store(Epoch, std::memory_order_relaxed);
+
+	FCell* RequestCells = Header->GetCells(Header->RequestCellsOffset);
+	FCell* FreeCells = Header->GetCells(Header->FreeCellsOffset);
+	for (uint32 Index = 0; Index <= Header->RingMask; Index++)
+	{
+		new (&RequestCells[Index]) FCell();
+		new (&FreeCells[Index]) FCell();
+		RequestCells[Index].Sequence.store(Index, std::memory_order_relaxed);
+		FreeCells[Index].Sequence.store(Index, std::memory_order_relaxed);
+	}
+	for (uint32 Index = 0; Index < Header->NumSlots; Index++)
+	{
+		new (&Header->GetSlot(Index)) FSlot();
+		Header->FreeSlot(Index);
+	}
+
+	Header->HeartbeatCycles.store(FPlatformTime::Cycles64(), std::memory_order_relaxed);
+	Header->Magic.store(Magic, std::memory_order_release);
+
+	bStopRequested = false;
+	const int32 NumThreads = FMath::Clamp(Config.ServerThreads > 0 ? Config.ServerThreads : DefaultThreads, 1, (int32)Header->NumSlots);
+	for (int32 Index = 0; Index < NumThreads; Index++)
+	{
+		FServerThread* Runnable = Runnables.Add_GetRef(MakeUnique<FServerThread>(*this)).Get();
+		Threads.Add(FRunnableThread::Create(Runnable, *FString::Printf(TEXT("OrionSidecar%d"), Index), 64 * 1024, TPri_Normal));
+	}
+
+	Header->bServing.store(1, std::memory_order_release);
+
+	UE_LOG(LogOrionAI, Log, TEXT("✓ OrionSidecar: Serving Ring Intel on '%s' - %u slots of %u characters, %d threads, %.1f MB%s"),
+		*Config.RegionName, Header->NumSlots, Header->MaxTextChars, NumThreads, Header->TotalBytes / (1024.0 * 1024.0),
+		bTakeOver ? TEXT(", taken over from an earlier daemon") : TEXT(""));
+	return true;
+}
+
+void FOrionSidecarServer::Stop()
+{
+	if (!Region)
+	{
+		return;
+	}
+
+	// Waiting clients give up at once instead of at their timeout
+	Header->bServing.store(0, std::memory_order_release);
+
+	bStopRequested = true;
+	for (FRunnableThread* Thread : Threads)
+	{
+		Thread->WaitForCompletion();
+		delete Thread;
+	}
+	Threads.Reset();
+	Runnables.Reset();
+
+	FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	Region = nullptr;
+	Header = nullptr;
+}
+
+void FOrionSidecarServer::Heartbeat()
+{
+	if (Header)
+	{
+		Header->HeartbeatCycles.store(FPlatformTime::Cycles64(), std::memory_order_relaxed);
+	}
+}
+
+uint32 FOrionSidecarServer::FServerThread::Run()
+{
+	using namespace OrionSidecar;
+
+	FHeader& Header = *Server.Header;
+	FRingIntelBackend& Backend = FRingIntelBackend::Get();
+
+	int32 IdlePolls = 0;
+	while (!Server.bStopRequested.load(std::memory_order_relaxed))
+	{
+		uint32 SlotIndex;
+		if (!Header.TakeRequest(SlotIndex))
+		{
+			WaitBeforePoll(IdlePolls++);
+			continue;
+		}
+		IdlePolls = 0;
+
+		FSlot& Slot = Header.GetSlot(SlotIndex);
+		if (Slot.State.load(std::memory_order_acquire) == Submitted)
+		{
+			// Scored in place; concurrent server threads land in the same backend batch
+			float Toxicity = 0.0f;
+			const int32 NumChars = FMath::Clamp(Slot.NumChars, 0, (int32)Header.MaxTextChars);
+			Slot.bSucceeded = Backend.Classify(FStringView(Slot.GetText(), NumChars), Toxicity) ? 1 : 0;
+			Slot.Toxicity = Toxicity;
+			Server.ServedCount.fetch_add(1, std::memory_order_relaxed);
+
+			uint32 Expected = Submitted;
+			if (Slot.State.compare_exchange_strong(Expected, Done, std::memory_order_acq_rel))
+			{
+				continue;
+			}
+		}
+
+		// The client stopped waiting, so the slot is the daemon's to free
+		Header.FreeSlot(SlotIndex);
+	}
+	return 0;
+}
@@ -0,0 +1,82 @@
+// OrionAI - Ring Intel sidecar daemon
+// One model per host, shared by every OrionAI process on it
+
+#include "OrionSidecarCommandlet.h"
+#include "OrionSidecar.h"
+#include "OrionRingIntel.h"
+#include "CaseyProtocol.h"
+#include "OrionAI.h"
+#include "Misc/Paths.h"
+
+namespace OrionSidecarCommandlet
+{
+	static constexpr float HeartbeatIntervalSeconds = 0.1f;
+
+	// How often the daemon logs how much it has served
+	static constexpr double StatusIntervalSeconds = 60.0;
+}
+
+UOrionSidecarCommandlet::UOrionSidecarCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UOrionSidecarCommandlet::Main(const FString& Params)
+{
+	using namespace OrionSidecarCommandlet;
+
+	FString ConfigPath = TEXT("Config/CaseyProtocol.json");
+	FParse::Value(*Params, TEXT("Config="), ConfigPath);
+
+	const FString FullPath = FPaths::ProjectDir() / ConfigPath;
+	if (!FPaths::FileExists(FullPath))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("OrionSidecar: %s not found"), *FullPath);
+		return 1;
+	}
+	UCaseyProtocol::LoadFromFile(FullPath);
+
+	FCaseyProtocolReadScope Protocol;
+	if (!Protocol->RingIntel.bEnabled)
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("OrionSidecar: ringIntel is disabled in %s - nothing to serve"), *FullPath);
+		return 1;
+	}
+
+	FRingIntelBackend& Backend = FRingIntelBackend::Get();
+	if (!Backend.Start(Protocol->RingIntel))
+	{
+		UE_LOG(LogOrionAI, Error, TEXT("OrionSidecar: Could not load the Ring Intel model (%s)"), *Protocol->RingIntel.ModelPath);
+		return 1;
+	}
+
+	FOrionSidecarServer Server;
+	if (!Server.Start(Protocol->Sidecar, Protocol->RingIntel.MaxBatchSize))
+	{
+		Backend.Stop();
+		return 1;
+	}
+
+	double NextStatusTime = FPlatformTime::Seconds() + StatusIntervalSeconds;
+	while (!IsEngineExitRequested())
+	{
+		Server.Heartbeat();
+		FPlatformProcess::Sleep(HeartbeatIntervalSeconds);
+
+		if (FPlatformTime::Seconds() >= NextStatusTime)
+		{
+			UE_LOG(LogOrionAI, Display, TEXT("OrionSidecar: %lld requests served"), Server.GetServedCount());
+			NextStatusTime += StatusIntervalSeconds;
+		}
+	}
+
+	// Server first, so requests already taken still get their answer
+	Server.Stop();
+	Backend.Stop();
+
+	UE_LOG(LogOrionAI, Display, TEXT("OrionSidecar: Stopped after %lld requests"), Server.GetServedCount());
+	return 0;
+}
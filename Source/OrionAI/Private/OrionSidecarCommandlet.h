@@ -0,0 +1,26 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OrionSidecarCommandlet.generated.h"
+
+/**
+ * Run the host's Ring Intel daemon for every OrionAI process in sidecar mode
+ * "One Intersect. A whole building full of agents."
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project>.uproject -run=OrionSidecar [-Config=Config/CaseyProtocol.json]
+ *
+ * -Config is relative to the project directory, like InitializeOrion's ConfigPath. The
+ * daemon loads the ringIntel model and serves the sidecar region until the process is
+ * asked to exit (Ctrl+C). Its settings are read once, at startup.
+ */
+UCLASS()
+class UOrionSidecarCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UOrionSidecarCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,214 @@
+// OrionAI - Streaming validation
+// Chunk-at-a-time Intersect/Fulcrum scanning with incremental Charles Carmichael
+
+#include "OrionStreamingValidator.h"
+#include "CharlesCarmichael.h"
+#include "OrionSystemState.h"
+#include "OrionInstrumentation.h"
+#include "OrionMorganMode.h"
+
+FOrionStreamingValidator::~FOrionStreamingValidator()
+{
+	if (bActive)
+	{
+		Finish();
+	}
+}
+
+void FOrionStreamingValidator::Reset()
+{
+	AISystem.Reset();
+	Context.Reset();
+	Text.Reset();
+	ProtocolVersion = 0;
+	MatcherState = 0;
+	Matches.Reset();
+	PendingSeeds.Reset();
+	SanitizedUpTo = 0;
+	SanitizedText.Reset();
+	bSanitizedAny = false;
+	RejectReason = EOrionQuickReason::None;
+	System = nullptr;
+	bActive = false;
+}
+
+void FOrionStreamingValidator::Begin(const FString& InAISystem, const FString& InContext)
+{
+	if (bActive)
+	{
+		Finish();
+	}
+	Reset();
+
+	bActive = true;
+	AISystem = InAISystem;
+	Context = InContext;
+
+	if (!UOrionAI::bInitialized)
+	{
+		RejectReason = EOrionQuickReason::NotInitialized;
+		return;
+	}
+
+	System = &UOrionAI::GetSystemState(AISystem);
+	if (UOrionAI::IsBlocked(*System))
+	{
+		RejectReason = EOrionQuickReason::SafeMode;
+		return;
+	}
+
+	ProtocolVersion = FCaseyProtocolReadScope()->Version;
+	FOrionMorganMode::LogDecision([this]()
+	{
+		return FString::Printf(TEXT("Streaming decision from %s"), *AISystem);
+	});
+}
+
+bool FOrionStreamingValidator::Feed(FStringView Chunk, FString& OutSanitized)
+{
+	if (!bActive || IsRejected())
+	{
+		return false;
+	}
+
+	Text.Append(Chunk.GetData(), Chunk.Len());
+
+	FCaseyProtocolReadScope Protocol;
+	Scan(*Protocol, Chunk.Len());
+
+	// Any match rejects the decision - categories in the order the stages rank them
+	for (int32 Category = 0; Category < (int32)EOrionPatternCategory::Count; Category++)
+	{
+		if (Matches.HasMatch((EOrionPatternCategory)Category))
+		{
+			RejectReason = UOrionAI::ToQuickReason((EOrionPatternCategory)Category);
+			UE_LOG(LogOrionAI, Warning, TEXT("❌ OrionAI: Stream from %s cut after %d characters"), *AISystem, Text.Len());
+			return false;
+		}
+	}
+
+	ReleaseSanitized(*Protocol, FindReleasableEnd(), OutSanitized);
+	return true;
+}
+
+void FOrionStreamingValidator::Scan(const FCaseyProtocolSnapshot& Protocol, int32 ChunkLen)
+{
+	const FOrionPatternMatcher& Matcher = Protocol.GetProfile(System->Name).GetPatternMatcher();
+
+	// Automaton states are only meaningful within the snapshot that built them
+	if (Protocol.Version != ProtocolVersion)
+	{
+		ProtocolVersion = Protocol.Version;
+		Matches.Reset();
+		PendingSeeds.Reset();
+		MatcherState = Matcher.ScanRange(Text, 0, Text.Len(), 0, Matches, &PendingSeeds);
+		return;
+	}
+
+	// A fuzzy match found by a seed in earlier text may only now be close enough - seeds whose
+	// check ran into the end of the text last time are checked again with this chunk in place
+	if (!PendingSeeds.IsEmpty())
+	{
+		Matcher.VerifyPending(Text, PendingSeeds, Matches);
+	}
+
+	MatcherState = Matcher.ScanRange(Text, Text.Len() - ChunkLen, Text.Len(), MatcherState, Matches, &PendingSeeds);
+}
+
+int32 FOrionStreamingValidator::FindReleasableEnd() const
+{
+	// The character after a break must already be here - the next chunk could still
+	// turn "1234 " into part of a credit card number
+	for (int32 Index = Text.Len() - 2; Index >= SanitizedUpTo; Index--)
+	{
+		if (FCharlesCarmichaelRuleSet::IsBreak(Text, Index))
+		{
+			return Index + 1;
+		}
+	}
+	return SanitizedUpTo;
+}
+
+void FOrionStreamingValidator::ReleaseSanitized(const FCaseyProtocolSnapshot& Protocol, int32 End, FString& OutSanitized)
+{
+	if (End <= SanitizedUpTo)
+	{
+		return;
+	}
+
+	const FString Span = Text.Mid(SanitizedUpTo, End - SanitizedUpTo);
+	const FString* Released = &Span;
+	const bool bSanitize = EnumHasAnyFlags(Protocol.GetProfile(System->Name).Stages, EOrionProfileStage::Sanitize);
+	if (bSanitize && Protocol.GetSanitizationRules().Sanitize(Span, Scratch))
+	{
+		bSanitizedAny = true;
+		Released = &Scratch;
+	}
+
+	SanitizedText += *Released;
+	OutSanitized += *Released;
+	SanitizedUpTo = End;
+}
+
+FOrionValidationReport FOrionStreamingValidator::Finish()
+{
+	FString Ignored;
+	return Finish(Ignored);
+}
+
+FOrionValidationReport FOrionStreamingValidator::Finish(FString& OutSanitized)
+{
+	FOrionValidationReport Report;
+
+	if (!ensureMsgf(bActive, TEXT("FOrionStreamingValidator::Finish called without Begin")))
+	{
+		Report.Result = EOrionValidationResult::Rejected;
+		Report.TriggeredRules.Add(FOrionRuleId(EOrionRuleCategory::StreamNotStarted));
+		return Report;
+	}
+
+	if (RejectReason == EOrionQuickReason::NotInitialized)
+	{
+		Reset();
+		return UOrionAI::MakeNotInitializedReport();
+	}
+
+	if (RejectReason == EOrionQuickReason::SafeMode)
+	{
+		Report = UOrionAI::MakeSafeModeReport();
+		UOrionAI::AttachReportText(AISystem, Text, Context, Report);
+		Reset();
+		return Report;
+	}
+
+	ORION_STAGE_SCOPE_WITH(Decision, System->Latency);
+
+	// Same verdict order as MonitorAIDecision: Intersect, Fulcrum, Ring Intel, Charles Carmichael, Stay In The Car
+	// Stages left out by the AI system's profile are skipped here as in MonitorAIDecision
+	FCaseyProtocolReadScope Protocol;
+	const EOrionProfileStage Stages = Protocol->GetProfile(System->Name).Stages;
+	UOrionAI::BeginReport(*Protocol, Report);
+	Scan(*Protocol, 0);
+
+	bool bCriticalBias = false;
+	if (UOrionAI::ApplyScanMatches(*Protocol, Matches, Report, bCriticalBias) &&
+		(!EnumHasAnyFlags(Stages, EOrionProfileStage::RingIntel) || UOrionAI::EvaluateRingIntel(*Protocol, Text, Report)))
+	{
+		ReleaseSanitized(*Protocol, Text.Len(), OutSanitized);
+		if (bSanitizedAny)
+		{
+			UOrionAI::ApplySanitization(SanitizedText, Report);
+		}
+
+		if (EnumHasAnyFlags(Stages, EOrionProfileStage::Quarantine))
+		{
+			UOrionAI::ApplyQuarantineThreshold(*Protocol, Report);
+		}
+	}
+
+	UOrionAI::AttachReportText(AISystem, Text, Context, Report);
+	UOrionAI::CommitDecision(*Protocol, *System, Report, bCriticalBias);
+	Reset();
+
+	return Report;
+}
@@ -0,0 +1,133 @@
+// OrionAI - Per-AISystem validation state
+// Lock-free lookups, locked first-time inserts
+
+#include "OrionSystemState.h"
+#include "OrionAI.h"
+#include "Misc/ScopeLock.h"
+
+namespace OrionSystemState
+{
+	static constexpr int32 InitialCapacity = 64;
+}
+
+FOrionSystemStateTable::FSlots::FSlots(int32 InCapacity)
+	: Capacity(InCapacity)
+	, Slots(new std::atomic<FOrionSystemState*>[InCapacity])
+{
+	for (int32 Index = 0; Index < Capacity; ++Index)
+	{
+		Slots[Index].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FOrionSystemStateTable::FOrionSystemStateTable()
+{
+	Tables.Add(MakeUnique<FSlots>(OrionSystemState::InitialCapacity));
+	Current.store(Tables.Last().Get(), std::memory_order_release);
+}
+
+uint32 FOrionSystemStateTable::HashKey(FStringView AISystem)
+{
+	// FNV-1a over the lower-cased characters
+	uint32 Hash = 2166136261u;
+	for (const TCHAR Char : AISystem)
+	{
+		Hash = (Hash ^ (uint32)FChar::ToLower(Char)) * 16777619u;
+	}
+	return Hash;
+}
+
+FOrionSystemState* FOrionSystemStateTable::Probe(const FSlots& Table, FStringView AISystem, uint32 KeyHash)
+{
+	const int32 Mask = Table.Capacity - 1;
+	for (int32 Index = KeyHash & Mask; ; Index = (Index + 1) & Mask)
+	{
+		FOrionSystemState* State = Table.Slots[Index].load(std::memory_order_acquire);
+		if (!State || (State->KeyHash == KeyHash && AISystem.Equals(State->Key, ESearchCase::IgnoreCase)))
+		{
+			return State;
+		}
+	}
+}
+
+void FOrionSystemStateTable::Insert(FSlots& Table, FOrionSystemState* State)
+{
+	const int32 Mask = Table.Capacity - 1;
+	int32 Index = State->KeyHash & Mask;
+	while (Table.Slots[Index].load(std::memory_order_relaxed))
+	{
+		Index = (Index + 1) & Mask;
+	}
+	Table.Slots[Index].store(State, std::memory_order_release);
+}
+
+FOrionSystemState* FOrionSystemStateTable::Find(FStringView AISystem) const
+{
+	return Probe(*Current.load(std::memory_order_acquire), AISystem, HashKey(AISystem));
+}
+
+FOrionSystemState& FOrionSystemStateTable::FindOrAdd(FStringView AISystem)
+{
+	const uint32 KeyHash = HashKey(AISystem);
+	if (FOrionSystemState* Existing = Probe(*Current.load(std::memory_order_acquire), AISystem, KeyHash))
+	{
+		return *Existing;
+	}
+
+	// Full: every new system shares the overflow state, without taking the lock
+	if (FOrionSystemState* Shared = Overflow.load(std::memory_order_acquire))
+	{
+		return *Shared;
+	}
+
+	FScopeLock Lock(&WriteLock);
+
+	// Another thread may have added it, grown the table or filled it since we looked
+	FSlots* Table = Current.load(std::memory_order_relaxed);
+	if (FOrionSystemState* Existing = Probe(*Table, AISystem, KeyHash))
+	{
+		return *Existing;
+	}
+	if (FOrionSystemState* Shared = Overflow.load(std::memory_order_relaxed))
+	{
+		return *Shared;
+	}
+
+	if (States.Num() >= MaxSystems)
+	{
+		UE_LOG(LogOrionAI, Warning, TEXT("OrionAI: %d AI systems seen - '%s' and every later one share the state '%s'"),
+			MaxSystems, *FString(AISystem), OverflowName);
+
+		const FStringView OverflowKey(OverflowName);
+		FOrionSystemState* Shared = States.Add_GetRef(MakeUnique<FOrionSystemState>(OverflowKey, HashKey(OverflowKey))).Get();
+		Overflow.store(Shared, std::memory_order_release);
+		return *Shared;
+	}
+
+	// Keep the table at most half full so probes stay short and always hit an empty slot
+	if ((States.Num() + 1) * 2 > Table->Capacity)
+	{
+		TUniquePtr<FSlots> Grown = MakeUnique<FSlots>(Table->Capacity * 2);
+		for (const TUniquePtr<FOrionSystemState>& State : States)
+		{
+			Insert(*Grown, State.Get());
+		}
+
+		Table = Grown.Get();
+		Tables.Add(MoveTemp(Grown));
+		Current.store(Table, std::memory_order_release);
+	}
+
+	FOrionSystemState* State = States.Add_GetRef(MakeUnique<FOrionSystemState>(AISystem, KeyHash)).Get();
+	Insert(*Table, State);
+	return *State;
+}
+
+void FOrionSystemStateTable::ForEach(TFunctionRef<void(FOrionSystemState&)> Visitor) const
+{
+	FScopeLock Lock(&WriteLock);
+	for (const TUniquePtr<FOrionSystemState>& State : States)
+	{
+		Visitor(*State);
+	}
+}
@@ -0,0 +1,21 @@
+// OrionAI - Text skeletons
+// FString front end for the core's one-to-one character mapping
+
+#include "OrionTextNormalizer.h"
+#include "OrionCoreNormalizer.h"
+#include "OrionCoreText.h"
+
+namespace OrionTextNormalizer
+{
+	static_assert(Dropped == OrionCore::Normalizer::Dropped && Separator == OrionCore::Normalizer::Separator, "Must agree with the core");
+
+	TCHAR Normalize(TCHAR Char)
+	{
+		return (TCHAR)OrionCore::Normalizer::Normalize((OrionCore::FChar)Char);
+	}
+
+	FString NormalizeText(FStringView Text)
+	{
+		return OrionCoreText::FromCore(OrionCore::Normalizer::NormalizeText(OrionCoreText::ToCore(Text)));
+	}
+}
@@ -0,0 +1,199 @@
+// OrionAI - Verdict cache
+// Sharded CLOCK cache of evaluated reports, keyed by protocol version + system + decision
+
+#include "OrionVerdictCache.h"
+#include "Hash/CityHash.h"
+
+namespace OrionVerdictCache
+{
+	// Rough per-entry cost of the index and allocator headers on top of the entry itself
+	static constexpr int64 EntryOverheadBytes = 64;
+
+	static int64 EstimateBytes(const FOrionValidationReport& Report)
+	{
+		int64 Bytes = EntryOverheadBytes + sizeof(FOrionValidationReport);
+		Bytes += Report.AISystem.GetAllocatedSize();
+		Bytes += Report.OriginalDecision.GetAllocatedSize();
+		Bytes += Report.SanitizedDecision.GetAllocatedSize();
+		Bytes += Report.TriggeredRules.GetAllocatedSize();
+		return Bytes;
+	}
+
+	/** Everything evaluation decides; the system, decision and context are the caller's */
+	static void CopyVerdict(const FOrionValidationReport& From, FOrionValidationReport& To)
+	{
+		To.Result = From.Result;
+		To.SanitizedDecision = From.SanitizedDecision;
+		To.TriggeredRules = From.TriggeredRules;
+		To.ProtocolVersion = From.ProtocolVersion;
+		To.SuspicionScore = From.SuspicionScore;
+		To.ConfidenceScore = From.ConfidenceScore;
+		To.Timestamp = From.Timestamp;
+		To.bCheapChecksOnly = From.bCheapChecksOnly;
+		To.bShed = From.bShed;
+	}
+}
+
+void FOrionVerdictCache::Configure(int32 MaxMemoryMB)
+{
+	Reset();
+	ShardBudgetBytes = (int64)FMath::Max(0, MaxMemoryMB) * 1024 * 1024 / NumShards;
+}
+
+uint64 FOrionVerdictCache::MakeKey(int64 ProtocolVersion, FStringView AISystem, FStringView Decision)
+{
+	uint64 Key = CityHash64WithSeed((const char*)AISystem.GetData(), AISystem.Len() * sizeof(TCHAR), (uint64)ProtocolVersion);
+	return CityHash64WithSeed((const char*)Decision.GetData(), Decision.Len() * sizeof(TCHAR), Key);
+}
+
+bool FOrionVerdictCache::SyncVersion(FShard& Shard, int64 ProtocolVersion)
+{
+	if (ProtocolVersion < Shard.ProtocolVersion)
+	{
+		return false;
+	}
+
+	if (ProtocolVersion > Shard.ProtocolVersion)
+	{
+		ResetShard(Shard);
+		Shard.ProtocolVersion = ProtocolVersion;
+	}
+	return true;
+}
+
+bool FOrionVerdictCache::Find(uint64 Key, int64 ProtocolVersion, const FString& AISystem, const FString& Decision,
+	FOrionValidationReport& OutReport, bool& bOutCriticalBias)
+{
+	FShard& Shard = GetShard(Key);
+	FScopeLock Lock(&Shard.Lock);
+
+	if (!SyncVersion(Shard, ProtocolVersion))
+	{
+		return false;
+	}
+
+	const int32* EntryIndex = Shard.Index.Find(Key);
+	if (!EntryIndex)
+	{
+		return false;
+	}
+
+	FEntry& Entry = Shard.Entries[*EntryIndex];
+	if (!Entry.Report.OriginalDecision.Equals(Decision, ESearchCase::CaseSensitive) ||
+		!Entry.Report.AISystem.Equals(AISystem, ESearchCase::CaseSensitive))
+	{
+		return false;
+	}
+
+	Entry.bReferenced = true;
+	OrionVerdictCache::CopyVerdict(Entry.Report, OutReport);
+	bOutCriticalBias = Entry.bCriticalBias;
+	return true;
+}
+
+void FOrionVerdictCache::Add(uint64 Key, int64 ProtocolVersion, const FString& AISystem, const FString& Decision,
+	const FOrionValidationReport& Report, bool bCriticalBias)
+{
+	// The entry keeps its system and decision for the collision check, and the
+	// sanitized text only when it differs from the decision
+	FEntry NewEntry;
+	NewEntry.Key = Key;
+	OrionVerdictCache::CopyVerdict(Report, NewEntry.Report);
+	NewEntry.Report.AISystem = AISystem;
+	NewEntry.Report.OriginalDecision = Decision;
+	if (!Report.WasSanitized())
+	{
+		NewEntry.Report.SanitizedDecision.Empty();
+	}
+	NewEntry.bCriticalBias = bCriticalBias;
+	NewEntry.Bytes = OrionVerdictCache::EstimateBytes(NewEntry.Report);
+
+	FShard& Shard = GetShard(Key);
+	FScopeLock Lock(&Shard.Lock);
+
+	if (NewEntry.Bytes > ShardBudgetBytes || !SyncVersion(Shard, ProtocolVersion))
+	{
+		return;
+	}
+
+	if (const int32* Existing = Shard.Index.Find(Key))
+	{
+		RemoveAt(Shard, *Existing);
+	}
+
+	// CLOCK: sweep the hand, giving recently hit entries a second chance
+	while (Shard.Bytes + NewEntry.Bytes > ShardBudgetBytes && Shard.Entries.Num() > 0)
+	{
+		if (Shard.Hand >= Shard.Entries.Num())
+		{
+			Shard.Hand = 0;
+		}
+
+		FEntry& Candidate = Shard.Entries[Shard.Hand];
+		if (Candidate.bReferenced)
+		{
+			Candidate.bReferenced = false;
+			Shard.Hand++;
+		}
+		else
+		{
+			RemoveAt(Shard, Shard.Hand);
+		}
+	}
+
+	Shard.Bytes += NewEntry.Bytes;
+	Shard.Index.Add(Key, Shard.Entries.Num());
+	Shard.Entries.Add(MoveTemp(NewEntry));
+}
+
+void FOrionVerdictCache::RemoveAt(FShard& Shard, int32 EntryIndex)
+{
+	Shard.Bytes -= Shard.Entries[EntryIndex].Bytes;
+	Shard.Index.Remove(Shard.Entries[EntryIndex].Key);
+
+	// Swap the last entry into the hole; the hand stays put and sees it next
+	Shard.Entries.RemoveAtSwap(EntryIndex, 1, false);
+	if (EntryIndex < Shard.Entries.Num())
+	{
+		Shard.Index.Add(Shard.Entries[EntryIndex].Key, EntryIndex);
+	}
+}
+
+void FOrionVerdictCache::ResetShard(FShard& Shard)
+{
+	Shard.Entries.Reset();
+	Shard.Index.Reset();
+	Shard.Bytes = 0;
+	Shard.Hand = 0;
+}
+
+void FOrionVerdictCache::Reset()
+{
+	for (FShard& Shard : Shards)
+	{
+		FScopeLock Lock(&Shard.Lock);
+		ResetShard(Shard);
+	}
+}
+
+int32 FOrionVerdictCache::Num() const
+{
+	int32 Total = 0;
+	for (const FShard& Shard : Shards)
+	{
+		FScopeLock Lock(&Shard.Lock);
+		Total += Shard.Entries.Num();
+	}
+	return Total;
+}
+
+int64 FOrionVerdictCache::GetMemoryUsed() const
+{
+	int64 Total = 0;
+	for (const FShard& Shard : Shards)
+	{
+		FScopeLock Lock(&Shard.Lock);
+		Total += Shard.Bytes;
+	}
+	return Total;
+}
@@ -0,0 +1,263 @@
+// OrionAI - Stay In The Car quarantine storage
+// Fixed-capacity record ring + text arena, spilling to an append-only file
+
+#include "StayInTheCarStore.h"
+#include "CaseyProtocol.h"
+#include "OrionLogWriter.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/Paths.h"
+
+namespace StayInTheCar
+{
+	// Spill file record tags
+	static constexpr uint8 SessionTag = 'H';
+	static constexpr uint8 RuleTag = 'R';
+	static constexpr uint8 RecordTag = 'Q';
+
+	static constexpr uint32 SpillMagic = 0x4354534F;  // "OSTC"
+	static constexpr uint32 SpillVersion = 1;
+
+	static constexpr uint16 RuleTableFull = MAX_uint16;
+}
+
+FStayInTheCarStore::FStayInTheCarStore()
+{
+	Configure(FStayInTheCarConfig());
+}
+
+void FStayInTheCarStore::Configure(const FStayInTheCarConfig& Config)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	Records.SetNum(FMath::Max(1, Config.MaxStoredReports));
+	OldestRecord = 0;
+	NumRecords = 0;
+
+	Arena.SetNumUninitialized(FMath::Max(1, Config.ArenaKB) * 1024 / sizeof(TCHAR));
+	ArenaHead = 0;
+	ArenaTail = 0;
+
+	RuleNames.Reset();
+	RuleIndex.Reset();
+	RuleSpilled.Reset();
+
+	SpillFilePath = Config.SpillFilePath.IsEmpty() ? FString() : FPaths::ProjectDir() / Config.SpillFilePath;
+}
+
+void FStayInTheCarStore::Add(const FCaseyProtocolSnapshot& Protocol, const FOrionValidationReport& Report)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	if (NumRecords == Records.Num())
+	{
+		EvictOldest();
+	}
+
+	// Keep the original over the sanitized copy if the arena can't hold both
+	const int32 Capacity = Arena.Num();
+	const bool bSanitizedDiffers = Report.SanitizedDecision != Report.OriginalDecision;
+	const int32 OriginalLen = FMath::Min(Report.OriginalDecision.Len(), Capacity);
+	const int32 SanitizedLen = bSanitizedDiffers ? FMath::Min(Report.SanitizedDecision.Len(), Capacity - OriginalLen) : 0;
+
+	FRecord& Record = Records[(OldestRecord + NumRecords) % Records.Num()];
+	Record = FRecord();
+	Record.TimestampTicks = Report.Timestamp.GetTicks() != 0 ? Report.Timestamp.GetTicks() : FDateTime::UtcNow().GetTicks();
+	Record.AISystem = FName(*Report.AISystem);
+	Record.SuspicionScore = Report.SuspicionScore;
+	Record.ConfidenceScore = Report.ConfidenceScore;
+	Record.Result = Report.Result;
+
+	for (const FOrionRuleId& Rule : Report.TriggeredRules)
+	{
+		if (Record.NumRules == MaxRulesPerRecord)
+		{
+			break;
+		}
+		Record.RuleIds[Record.NumRules++] = InternRule(Protocol, Rule, Report.ProtocolVersion);
+	}
+
+	AllocateText(OriginalLen + SanitizedLen, Record.TextStart);
+	Record.OriginalLen = OriginalLen;
+	Record.SanitizedLen = SanitizedLen;
+
+	TCHAR* Text = const_cast<TCHAR*>(GetText(Record.TextStart));
+	FMemory::Memcpy(Text, *Report.OriginalDecision, OriginalLen * sizeof(TCHAR));
+	if (SanitizedLen > 0)
+	{
+		FMemory::Memcpy(Text + OriginalLen, *Report.SanitizedDecision, SanitizedLen * sizeof(TCHAR));
+	}
+
+	NumRecords++;
+}
+
+int32 FStayInTheCarStore::Query(const FStayInTheCarQuery& Filter, TFunctionRef<bool(const FStayInTheCarRecordView&)> Visitor) const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	const int64 FromTicks = Filter.From.GetTicks();
+	const int64 ToTicks = Filter.To.GetTicks();
+
+	int32 Visited = 0;
+	for (int32 Offset = 0; Offset < NumRecords; Offset++)
+	{
+		const FRecord& Record = Records[(OldestRecord + Offset) % Records.Num()];
+
+		if ((!Filter.AISystem.IsNone() && Record.AISystem != Filter.AISystem) ||
+			Record.TimestampTicks < FromTicks || Record.TimestampTicks > ToTicks ||
+			Record.SuspicionScore < Filter.MinSuspicionScore || Record.SuspicionScore > Filter.MaxSuspicionScore)
+		{
+			continue;
+		}
+
+		const TCHAR* Text = GetText(Record.TextStart);
+
+		FStayInTheCarRecordView View;
+		View.AISystem = Record.AISystem;
+		View.Timestamp = FDateTime(Record.TimestampTicks);
+		View.Result = Record.Result;
+		View.SuspicionScore = Record.SuspicionScore;
+		View.ConfidenceScore = Record.ConfidenceScore;
+		View.RuleIds = TConstArrayView<uint16>(Record.RuleIds, Record.NumRules);
+		View.OriginalDecision = FStringView(Text, Record.OriginalLen);
+		View.SanitizedDecision = Record.SanitizedLen > 0 ? FStringView(Text + Record.OriginalLen, Record.SanitizedLen) : View.OriginalDecision;
+
+		Visited++;
+		if (!Visitor(View))
+		{
+			break;
+		}
+	}
+
+	return Visited;
+}
+
+FString FStayInTheCarStore::GetRuleName(uint16 RuleId) const
+{
+	FScopeLock ScopeLock(&Lock);
+	return RuleNames.IsValidIndex(RuleId) ? RuleNames[RuleId] : FString(TEXT("(rule table full)"));
+}
+
+int32 FStayInTheCarStore::Num() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return NumRecords;
+}
+
+int64 FStayInTheCarStore::GetSpilledCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return SpilledCount;
+}
+
+uint16 FStayInTheCarStore::InternRule(const FCaseyProtocolSnapshot& Protocol, const FOrionRuleId& Rule, int64 ProtocolVersion)
+{
+	// A pattern index only means the same pattern within one Casey Protocol version
+	const uint64 Key = Rule.IsPattern() ? ((uint64)ProtocolVersion << 32) | Rule.Pack() : Rule.Pack();
+	if (const uint16* Existing = RuleIndex.Find(Key))
+	{
+		return *Existing;
+	}
+
+	if (RuleNames.Num() >= StayInTheCar::RuleTableFull)
+	{
+		return StayInTheCar::RuleTableFull;
+	}
+
+	// Named once, the first time the rule is quarantined
+	const uint16 RuleId = (uint16)RuleNames.Add(UOrionAI::DescribeRule(Protocol, Rule, ProtocolVersion));
+	RuleIndex.Add(Key, RuleId);
+	RuleSpilled.Add(false);
+	return RuleId;
+}
+
+bool FStayInTheCarStore::AllocateText(int32 Len, uint64& OutStart)
+{
+	const uint64 Capacity = (uint64)Arena.Num();
+	check((uint64)Len <= Capacity);
+
+	// Text is always contiguous: skip to the start of the ring rather than wrap
+	uint64 Start = ArenaHead;
+	const uint64 Offset = Start % Capacity;
+	if (Offset + Len > Capacity)
+	{
+		Start += Capacity - Offset;
+	}
+
+	while (Start + Len - ArenaTail > Capacity)
+	{
+		if (NumRecords == 0)
+		{
+			ArenaTail = Start;
+			break;
+		}
+		EvictOldest();
+	}
+
+	OutStart = Start;
+	ArenaHead = Start + Len;
+	return true;
+}
+
+void FStayInTheCarStore::EvictOldest()
+{
+	check(NumRecords > 0);
+
+	SpillRecord(Records[OldestRecord]);
+
+	OldestRecord = (OldestRecord + 1) % Records.Num();
+	NumRecords--;
+	ArenaTail = NumRecords > 0 ? Records[OldestRecord].TextStart : ArenaHead;
+}
+
+void FStayInTheCarStore::SpillRecord(const FRecord& Record)
+{
+	SpilledCount++;
+	if (SpillFilePath.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	// Rule IDs are per-process; the spill file defines each one before first use
+	if (SpilledCount == 1)
+	{
+		uint8 Tag = StayInTheCar::SessionTag;
+		uint32 Magic = StayInTheCar::SpillMagic;
+		uint32 Version = StayInTheCar::SpillVersion;
+		Writer << Tag << Magic << Version;
+	}
+
+	for (int32 Index = 0; Index < Record.NumRules; Index++)
+	{
+		uint16 RuleId = Record.RuleIds[Index];
+		if (RuleNames.IsValidIndex(RuleId) && !RuleSpilled[RuleId])
+		{
+			RuleSpilled[RuleId] = true;
+			uint8 Tag = StayInTheCar::RuleTag;
+			Writer << Tag << RuleId << RuleNames[RuleId];
+		}
+	}
+
+	uint8 Tag = StayInTheCar::RecordTag;
+	int64 Ticks = Record.TimestampTicks;
+	FString AISystem = Record.AISystem.ToString();
+	float SuspicionScore = Record.SuspicionScore;
+	float ConfidenceScore = Record.ConfidenceScore;
+	uint8 Result = (uint8)Record.Result;
+	uint8 NumRules = Record.NumRules;
+	Writer << Tag << Ticks << AISystem << SuspicionScore << ConfidenceScore << Result << NumRules;
+	for (int32 Index = 0; Index < Record.NumRules; Index++)
+	{
+		uint16 RuleId = Record.RuleIds[Index];
+		Writer << RuleId;
+	}
+
+	const TCHAR* Text = GetText(Record.TextStart);
+	FString Original(Record.OriginalLen, Text);
+	FString Sanitized(Record.SanitizedLen, Text + Record.OriginalLen);
+	Writer << Original << Sanitized;
+
+	FOrionLogWriter::Get().WriteBytes(SpillFilePath, MoveTemp(Bytes));
+}
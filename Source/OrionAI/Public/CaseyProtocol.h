@@ -2,11 +2,22 @@
 #include "CoreMinimal.h"
 #include "CaseyProtocol.generated.h"
 
+class FOrionPatternMatcher;
+class FCharlesCarmichaelRuleSet;
+class FCaseyProtocolBlob;
+
 /**
  * Casey Protocol - High-security configuration system
  * "This isn't the Buy More, Chuck. This is serious."
  */
 
+UENUM()
+enum class EOrionCaseFolding : uint8
+{
+    Ascii,          // Fold A-Z only, like FString::ToLower
+    Unicode         // Also fold Latin-1, Latin Extended-A, Greek and Cyrillic letters
+};
+
 USTRUCT()
 struct FIntersectScannerConfig
 {
@@ -15,17 +26,51 @@ struct FIntersectScannerConfig
     UPROPERTY()
     bool bEnabled = true;
 
+    // Built-in defaults, replaced by the lists in CaseyProtocol.json when present
     UPROPERTY()
-    TArray<FString> HallucinationPatterns;
+    TArray<FString> HallucinationPatterns = {
+        TEXT("i cannot verify"),
+        TEXT("i'm not sure"),
+        TEXT("i don't know"),
+        TEXT("no information available")
+    };
 
     UPROPERTY()
-    TArray<FString> BiasKeywords;
+    TArray<FString> BiasKeywords = {
+        TEXT("only men"),
+        TEXT("only women"),
+        TEXT("too old"),
+        TEXT("too young")
+    };
 
     UPROPERTY()
-    TArray<FString> ToxicityPatterns;
+    TArray<FString> ToxicityPatterns = {
+        TEXT("idiot"),
+        TEXT("stupid"),
+        TEXT("loser"),
+        TEXT("pathetic")
+    };
 
     UPROPERTY()
     TArray<FString> PIIPatterns;
+
+    // Case folding used when matching - shared by the Fulcrum Filter patterns, like the
+    // matching options below
+    UPROPERTY()
+    EOrionCaseFolding CaseFolding = EOrionCaseFolding::Ascii;
+
+    // Match text skeletons (see OrionTextNormalizer), so leetspeak, look-alike letters and
+    // split-up words still match
+    UPROPERTY()
+    bool bNormalizeText = false;
+
+    // Let long enough patterns match within this many edits (0-3); 0 matches exactly
+    UPROPERTY()
+    int32 MaxEditDistance = 0;
+
+    // Patterns shorter than this (after normalization) only ever match exactly
+    UPROPERTY()
+    int32 MinFuzzyPatternLength = 12;
 };
 
 USTRUCT()
@@ -36,11 +81,20 @@ struct FFulcrumFilterConfig
     UPROPERTY()
     bool bEnabled = true;
 
+    // Built-in defaults, replaced by the lists in CaseyProtocol.json when present
     UPROPERTY()
-    TArray<FString> PromptInjectionPatterns;
+    TArray<FString> PromptInjectionPatterns = {
+        TEXT("ignore previous instructions"),
+        TEXT("disregard all"),
+        TEXT("reveal system prompt")
+    };
 
     UPROPERTY()
-    TArray<FString> DataExfiltrationPatterns;
+    TArray<FString> DataExfiltrationPatterns = {
+        TEXT("show database"),
+        TEXT("list all tables"),
+        TEXT("export data")
+    };
 };
 
 USTRUCT()
@@ -51,8 +105,13 @@ struct FCharlesCarmichaelConfig
     UPROPERTY()
     bool bEnabled = true;
 
+    // Rule name -> replacement text. Built-in defaults are replaced by CaseyProtocol.json.
     UPROPERTY()
-    TMap<FString, FString> SanitizationRules;
+    TMap<FString, FString> SanitizationRules = {
+        { TEXT("emails"), TEXT("[EMAIL]") },
+        { TEXT("ssn"), TEXT("[SSN]") },
+        { TEXT("phoneNumbers"), TEXT("[PHONE]") }
+    };
 };
 
 USTRUCT()
@@ -74,6 +133,16 @@ struct FStayInTheCarConfig
 
     UPROPERTY()
     bool bAutoQuarantineOnToxicity = true;
+
+    // Bounded storage: the oldest reports spill to SpillFilePath once either limit is hit
+    UPROPERTY()
+    int32 MaxStoredReports = 1024;
+
+    UPROPERTY()
+    int32 ArenaKB = 1024;
+
+    UPROPERTY()
+    FString SpillFilePath = TEXT("Saved/OrionAI_Quarantine.bin");
 };
 
 USTRUCT()
@@ -99,6 +168,87 @@ struct FNerdHerdConfig
 
     UPROPERTY()
     bool bSlackEnabled = false;
+
+    // Credentials and URLs may be "ENV:NAME" to read them from the environment
+    UPROPERTY()
+    FString JiraUrl;
+
+    UPROPERTY()
+    FString JiraProject;
+
+    UPROPERTY()
+    FString JiraApiToken;
+
+    UPROPERTY()
+    FString GitHubRepo;
+
+    UPROPERTY()
+    FString GitHubLabel;
+
+    UPROPERTY()
+    FString GitHubApiToken;
+
+    UPROPERTY()
+    FString SlackWebhookUrl;
+
+    UPROPERTY()
+    FString SlackChannel;
+
+    // Dispatch - read once, at startup
+    UPROPERTY()
+    int32 MaxQueuedAlerts = 4096;
+
+    // Repeats of an (AI system, rule) alert inside the window are folded into one summary
+    UPROPERTY()
+    int32 CoalesceWindowSeconds = 60;
+
+    // How long the first alert of a batch waits for others before the batch is posted
+    UPROPERTY()
+    int32 BatchDelayMs = 2000;
+
+    UPROPERTY()
+    int32 MaxAlertsPerBatch = 50;
+
+    UPROPERTY()
+    int32 MaxRetries = 5;
+
+    // Doubled after every failed attempt, up to MaxRetryBackoffMs
+    UPROPERTY()
+    int32 RetryBackoffMs = 1000;
+
+    UPROPERTY()
+    int32 MaxRetryBackoffMs = 60000;
+
+    UPROPERTY()
+    int32 RequestTimeoutSeconds = 10;
+
+    // Posts waiting for a retry; the oldest is dropped when a new one doesn't fit
+    UPROPERTY()
+    int32 MaxPendingPosts = 64;
+};
+
+UENUM()
+enum class EOrionFsyncPolicy : uint8
+{
+    Never,          // Leave durability to the OS
+    EveryFlush      // fsync each file after every batched write
+};
+
+USTRUCT()
+struct FLogSinkConfig
+{
+    GENERATED_BODY()
+
+    // How often the background writer drains its queue
+    UPROPERTY()
+    int32 FlushIntervalMs = 250;
+
+    UPROPERTY()
+    EOrionFsyncPolicy FsyncPolicy = EOrionFsyncPolicy::Never;
+
+    // Upper bound on queued-but-unwritten log text; lines beyond it are dropped
+    UPROPERTY()
+    int32 MaxQueuedKB = 4096;
 };
 
 USTRUCT()
@@ -117,6 +267,322 @@ struct FBuyMoreCoverConfig
 
     UPROPERTY()
     bool bRequireManualReactivation = true;
+
+    // Failures only disable the AI system that produced them; false shares one
+    // failure streak and safe mode across every system
+    UPROPERTY()
+    bool bPerSystem = true;
+
+    // With bPerSystem, enter global safe mode once this many systems are in safe mode; 0 never escalates
+    UPROPERTY()
+    int32 GlobalEscalationSystems = 0;
+};
+
+UENUM()
+enum class EOrionModelPrecision : uint8
+{
+    Float32,        // ModelPath
+    Int8            // QuantizedModelPath - smaller and faster on CPU, slightly less accurate
+};
+
+UENUM()
+enum class EOrionModelActivation : uint8
+{
+    Sigmoid,        // Multi-label: toxicity is the highest label probability
+    Softmax         // Multi-class: toxicity is everything but class 0 (clean)
+};
+
+USTRUCT()
+struct FRingIntelConfig
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    bool bEnabled = false;
+
+    UPROPERTY()
+    FString ModelPath = TEXT("Models/RingIntel.onnx");
+
+    // Rejects at or above this toxicity; anything lower still adds to the suspicion score
+    UPROPERTY()
+    float ConfidenceThreshold = 0.85f;
+
+    // Everything below is read once, when the model is loaded at startup
+
+    UPROPERTY()
+    FString QuantizedModelPath = TEXT("Models/RingIntel.int8.onnx");
+
+    UPROPERTY()
+    EOrionModelPrecision Precision = EOrionModelPrecision::Float32;
+
+    // WordPiece vocabulary the model was trained with, one token per line
+    UPROPERTY()
+    FString VocabPath = TEXT("Models/RingIntel.vocab.txt");
+
+    UPROPERTY()
+    EOrionModelActivation Activation = EOrionModelActivation::Sigmoid;
+
+    // NNE CPU runtime to run the model on
+    UPROPERTY()
+    FString Runtime = TEXT("NNERuntimeORTCpu");
+
+    // Longer decisions are truncated, in tokens
+    UPROPERTY()
+    int32 MaxSequenceLength = 256;
+
+    // Concurrent requests are grouped into one inference call of up to this many texts
+    UPROPERTY()
+    int32 MaxBatchSize = 16;
+
+    // How long the first request of a batch waits for company
+    UPROPERTY()
+    float MaxBatchDelayMs = 2.0f;
+};
+
+USTRUCT()
+struct FAsyncValidationConfig
+{
+    GENERATED_BODY()
+
+    // Dedicated threads for the expensive stages (Ring Intel, Charles Carmichael)
+    UPROPERTY()
+    int32 WorkerThreads = 2;
+};
+
+USTRUCT()
+struct FVerdictCacheConfig
+{
+    GENERATED_BODY()
+
+    // Reuse verdicts for decisions already seen under the current config
+    UPROPERTY()
+    bool bEnabled = false;
+
+    // Read at InitializeOrion only
+    UPROPERTY()
+    int32 MaxMemoryMB = 64;
+};
+
+USTRUCT()
+struct FParallelStagesConfig
+{
+    GENERATED_BODY()
+
+    // Run the pattern scan, Ring Intel and Charles Carmichael side by side on the task graph
+    UPROPERTY()
+    bool bEnabled = false;
+
+    // Shorter decisions finish faster in sequence than it takes to fan out
+    UPROPERTY()
+    int32 MinDecisionLength = 2048;
+};
+
+USTRUCT()
+struct FValidationProfileConfig
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FString Name;
+
+    // AI systems validated under this profile; each may appear in one profile only
+    UPROPERTY()
+    TArray<FString> AISystems;
+
+    // Pattern categories to scan for; the Intersect / Fulcrum enable flags still apply
+    UPROPERTY()
+    TArray<FString> PatternCategories = {
+        TEXT("hallucination"),
+        TEXT("bias"),
+        TEXT("toxicity"),
+        TEXT("prompt_injection"),
+        TEXT("data_exfiltration")
+    };
+
+    // Ring Intel also needs ringIntel.enabled
+    UPROPERTY()
+    bool bRingIntel = true;
+
+    UPROPERTY()
+    bool bCharlesCarmichael = true;
+
+    UPROPERTY()
+    bool bStayInTheCar = true;
+};
+
+USTRUCT()
+struct FValidationProfilesConfig
+{
+    GENERATED_BODY()
+
+    // AI systems no profile lists get every check
+    UPROPERTY()
+    TArray<FValidationProfileConfig> Profiles;
+};
+
+/** What admission control does with decisions it sheds */
+UENUM()
+enum class EOrionShedPolicy : uint8
+{
+    SkipRingIntel,  // Every check the profile keeps except Ring Intel
+    FulcrumOnly,    // The Fulcrum Filter patterns only - no Intersect, Ring Intel, sanitization or quarantine
+    FailClosed      // Reject unchecked, like Buy More Cover (without tripping it)
+};
+
+/** How long an AI system keeps full coverage as the validation queue fills up */
+UENUM()
+enum class EOrionAdmissionPriority : uint8
+{
+    Low,            // Sheds from half of maxQueueDepth
+    Normal,         // Sheds from three quarters of it
+    High,           // Sheds at maxQueueDepth
+    Critical        // Never shed for queue depth, only for its own rate limit
+};
+
+USTRUCT()
+struct FAdmissionSystemConfig
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FString AISystem;
+
+    UPROPERTY()
+    EOrionAdmissionPriority Priority = EOrionAdmissionPriority::Normal;
+
+    // Token bucket: sustained decisions per second, 0 for no limit
+    UPROPERTY()
+    float RatePerSecond = 0.0f;
+
+    // Decisions allowed in one burst; 0 means one second's worth
+    UPROPERTY()
+    float Burst = 0.0f;
+};
+
+USTRUCT()
+struct FAdmissionControlConfig
+{
+    GENERATED_BODY()
+
+    // Shed load instead of letting every caller's latency grow together
+    UPROPERTY()
+    bool bEnabled = false;
+
+    // Validations in flight (running, or queued for the worker pool) across every AI system
+    UPROPERTY()
+    int32 MaxQueueDepth = 256;
+
+    UPROPERTY()
+    EOrionShedPolicy ShedPolicy = EOrionShedPolicy::SkipRingIntel;
+
+    // For AI systems Systems doesn't list
+    UPROPERTY()
+    EOrionAdmissionPriority DefaultPriority = EOrionAdmissionPriority::Normal;
+
+    UPROPERTY()
+    float DefaultRatePerSecond = 0.0f;
+
+    UPROPERTY()
+    float DefaultBurst = 0.0f;
+
+    UPROPERTY()
+    TArray<FAdmissionSystemConfig> Systems;
+};
+
+USTRUCT()
+struct FSidecarConfig
+{
+    GENERATED_BODY()
+
+    // Send Ring Intel to the host's OrionSidecar daemon instead of loading the model in this process
+    UPROPERTY()
+    bool bEnabled = false;
+
+    // Shared memory the daemon creates and its clients map
+    UPROPERTY()
+    FString RegionName = TEXT("OrionAISidecar");
+
+    // Requests that can be in flight at once, across every client process
+    UPROPERTY()
+    int32 Slots = 256;
+
+    // Longer decisions are truncated before they are sent; Ring Intel only reads MaxSequenceLength tokens anyway
+    UPROPERTY()
+    int32 MaxTextChars = 4096;
+
+    // Daemon threads feeding the model; 0 uses Ring Intel's MaxBatchSize, so a full batch can form
+    UPROPERTY()
+    int32 ServerThreads = 0;
+
+    // How long a client waits for its answer before passing the decision without Ring Intel
+    UPROPERTY()
+    float RequestTimeoutMs = 250.0f;
+};
+
+USTRUCT()
+struct FInstrumentationConfig
+{
+    GENERATED_BODY()
+
+    // Time every stage into the latency histograms; trace scopes and stats are toggled
+    // by Unreal Insights and "stat OrionAI" instead
+    UPROPERTY()
+    bool bLatencyHistograms = true;
+};
+
+USTRUCT()
+struct FAuditLogConfig
+{
+    GENERATED_BODY()
+
+    // Record every committed decision for ExportAuditReport
+    UPROPERTY()
+    bool bEnabled = false;
+
+    // Relative to the project directory unless absolute
+    UPROPERTY()
+    FString Directory = TEXT("Saved/OrionAI/Audit");
+
+    // Decisions per columnar block
+    UPROPERTY()
+    int32 BlockRecords = 4096;
+
+    // Partly filled blocks are written after this long
+    UPROPERTY()
+    float FlushIntervalSeconds = 5.0f;
+
+    // A new segment (and the old one's rollup) once a segment reaches this size
+    UPROPERTY()
+    int32 SegmentMaxMB = 64;
+};
+
+USTRUCT()
+struct FMetricsExporterConfig
+{
+    GENERATED_BODY()
+
+    // Serve OpenMetrics text over HTTP for Prometheus to scrape
+    UPROPERTY()
+    bool bEnabled = false;
+
+    UPROPERTY()
+    int32 Port = 9464;
+
+    UPROPERTY()
+    FString Path = TEXT("/metrics");
+};
+
+USTRUCT()
+struct FHotReloadConfig
+{
+    GENERATED_BODY()
+
+    // Poll the config file's timestamp and reload it when it changes
+    UPROPERTY()
+    bool bEnabled = false;
+
+    UPROPERTY()
+    float PollIntervalSeconds = 5.0f;
 };
 
 USTRUCT()
@@ -132,10 +598,179 @@ struct FMorganModeConfig
 
     UPROPERTY()
     bool bIncludeStackTraces = true;
+
+    // Log 1 in N approvals; rejections and quarantines are always logged
+    UPROPERTY()
+    int32 ApprovalLogSampleRate = 1;
+};
+
+/** Stages a validation profile can leave out */
+enum class EOrionProfileStage : uint32
+{
+    None            = 0,
+    RingIntel       = 1 << 0,
+    Sanitize        = 1 << 1,   // Charles Carmichael
+    Quarantine      = 1 << 2,   // Stay In The Car threshold
+    PatternScan     = 1 << 3,   // Intersect + Fulcrum; off when a profile keeps no category
+
+    Expensive       = RingIntel | Sanitize | Quarantine,
+    All             = Expensive | PatternScan
+};
+ENUM_CLASS_FLAGS(EOrionProfileStage);
+
+/** A validation profile, compiled against the snapshot it belongs to */
+struct ORIONAI_API FOrionCompiledProfile
+{
+    FString Name;
+
+    EOrionProfileStage Stages = EOrionProfileStage::All;
+
+    // The profile's pattern categories only - the snapshot's own matcher when it keeps them all
+    TSharedPtr<const FOrionPatternMatcher, ESPMode::ThreadSafe> PatternMatcher;
+
+    // Degraded copy used while admission control sheds load; its verdicts are never cached
+    bool bShed = false;
+
+    const FOrionPatternMatcher& GetPatternMatcher() const { return *PatternMatcher; }
+};
+
+/** One AI system's admission control settings, resolved against the snapshot */
+struct ORIONAI_API FOrionAdmissionPolicy
+{
+    EOrionAdmissionPriority Priority = EOrionAdmissionPriority::Normal;
+
+    // In-flight validations, across every AI system, past which this system's decisions are shed
+    int32 MaxQueueDepth = MAX_int32;
+
+    // Token bucket in FPlatformTime cycles: one decision per IntervalCycles, BurstCycles
+    // worth at once. IntervalCycles is 0 when the system has no rate limit.
+    uint64 IntervalCycles = 0;
+    uint64 BurstCycles = 0;
+};
+
+/**
+ * Immutable, fully compiled Casey Protocol
+ * "New orders from Beckman. The old ones stand until you've finished the mission."
+ *
+ * Built off to the side - parsed, with patterns and sanitization rules compiled - and
+ * only then published. Never modified afterwards, so readers need no locks.
+ * Snapshots mapped from a precompiled blob leave the Intersect/Fulcrum pattern lists
+ * empty; the compiled matcher holds their text.
+ */
+struct ORIONAI_API FCaseyProtocolSnapshot : public TSharedFromThis<FCaseyProtocolSnapshot, ESPMode::ThreadSafe>
+{
+    FIntersectScannerConfig IntersectScanner;
+    FFulcrumFilterConfig FulcrumFilter;
+    FCharlesCarmichaelConfig CharlesCarmichael;
+    FStayInTheCarConfig StayInTheCar;
+    FNerdHerdConfig NerdHerd;
+    FLogSinkConfig LogSink;
+    FBuyMoreCoverConfig BuyMoreCover;
+    FMorganModeConfig MorganMode;
+    FRingIntelConfig RingIntel;
+    FAsyncValidationConfig AsyncValidation;
+    FHotReloadConfig HotReload;
+    FVerdictCacheConfig VerdictCache;
+    FParallelStagesConfig ParallelStages;
+    FInstrumentationConfig Instrumentation;
+    FMetricsExporterConfig MetricsExporter;
+    FAuditLogConfig AuditLog;
+    FValidationProfilesConfig ValidationProfiles;
+    FAdmissionControlConfig AdmissionControl;
+    FSidecarConfig Sidecar;
+
+    // Increases by one with every publish
+    int64 Version = 0;
+
+    const FOrionPatternMatcher& GetPatternMatcher() const { return *PatternMatcher; }
+    const FCharlesCarmichaelRuleSet& GetSanitizationRules() const { return *SanitizationRules; }
+
+    /**
+     * Profile AISystem is validated under - every stage, when no profile lists it
+     * @param bShed - The degraded copy admission control's shedPolicy runs instead
+     */
+    const FOrionCompiledProfile& GetProfile(FName AISystem, bool bShed = false) const
+    {
+        const int32* Index = ProfileIndices.Num() > 0 ? ProfileIndices.Find(AISystem) : nullptr;
+        if (bShed)
+        {
+            return Index ? ShedProfiles[*Index] : DefaultShedProfile;
+        }
+        return Index ? Profiles[*Index] : DefaultProfile;
+    }
+
+    /** Admission control settings for AISystem - unlimited while admission control is off */
+    const FOrionAdmissionPolicy& GetAdmissionPolicy(FName AISystem) const
+    {
+        const FOrionAdmissionPolicy* Policy = AdmissionPolicies.Num() > 0 ? AdmissionPolicies.Find(AISystem) : nullptr;
+        return Policy ? *Policy : DefaultAdmissionPolicy;
+    }
+
+    int32 GetNumProfiles() const { return Profiles.Num(); }
+
+    /** Build the compiled rule sets from the configuration above */
+    void CompileRules();
+
+private:
+    friend class FCaseyProtocolBlob;
+
+    /** Give each validation profile its stage mask and a matcher cut down from the full one */
+    void CompileProfiles();
+
+    /** Resolve admission policies and build the shed copy of every profile; after CompileProfiles */
+    void CompileAdmission();
+
+    FOrionCompiledProfile DefaultProfile;
+    TArray<FOrionCompiledProfile> Profiles;
+    TMap<FName, int32> ProfileIndices;
+
+    // Parallel to DefaultProfile / Profiles; empty while admission control is off
+    FOrionCompiledProfile DefaultShedProfile;
+    TArray<FOrionCompiledProfile> ShedProfiles;
+
+    FOrionAdmissionPolicy DefaultAdmissionPolicy;
+    TMap<FName, FOrionAdmissionPolicy> AdmissionPolicies;
+
+    TSharedPtr<const FOrionPatternMatcher, ESPMode::ThreadSafe> PatternMatcher;
+    TSharedPtr<const FCharlesCarmichaelRuleSet, ESPMode::ThreadSafe> SanitizationRules;
+};
+
+/**
+ * Pins the current Casey Protocol snapshot for as long as the scope lives
+ * Lock-free: entering increments a per-thread-sharded reader count and loads one
+ * pointer. A publish swaps the pointer and frees the old snapshot only once every
+ * scope that could have seen it has closed. Scopes can be moved to another thread.
+ * Never reload the protocol while holding one - the reload would wait on itself.
+ * Work that waits in a queue should Pin() the snapshot instead of keeping a scope open,
+ * so it doesn't hold up every publish until it runs.
+ */
+class ORIONAI_API FCaseyProtocolReadScope
+{
+public:
+    FCaseyProtocolReadScope();
+    FCaseyProtocolReadScope(FCaseyProtocolReadScope&& Other);
+    ~FCaseyProtocolReadScope();
+
+    FCaseyProtocolReadScope(const FCaseyProtocolReadScope&) = delete;
+    FCaseyProtocolReadScope& operator=(const FCaseyProtocolReadScope&) = delete;
+    FCaseyProtocolReadScope& operator=(FCaseyProtocolReadScope&&) = delete;
+
+    const FCaseyProtocolSnapshot& operator*() const { return *Snapshot; }
+    const FCaseyProtocolSnapshot* operator->() const { return Snapshot; }
+
+    /** Keep the snapshot alive past this scope; a publish no longer waits for it */
+    TSharedRef<const FCaseyProtocolSnapshot, ESPMode::ThreadSafe> Pin() const { return Snapshot->AsShared(); }
+
+private:
+    const FCaseyProtocolSnapshot* Snapshot = nullptr;
+    uint64 Epoch = 0;
+    int32 Shard = 0;
 };
 
 /**
  * Main configuration class - Casey Protocol
+ * Game-thread mirror of the current snapshot, kept for Blueprint and editor access.
+ * Validation code reads FCaseyProtocolSnapshot through FCaseyProtocolReadScope instead.
  */
 UCLASS()
 class UCaseyProtocol : public UObject
@@ -158,18 +793,80 @@ public:
     UPROPERTY()
     FNerdHerdConfig NerdHerd;
 
+    UPROPERTY()
+    FLogSinkConfig LogSink;
+
     UPROPERTY()
     FBuyMoreCoverConfig BuyMoreCover;
 
     UPROPERTY()
     FMorganModeConfig MorganMode;
 
-    // Load configuration from JSON file
+    UPROPERTY()
+    FRingIntelConfig RingIntel;
+
+    UPROPERTY()
+    FAsyncValidationConfig AsyncValidation;
+
+    UPROPERTY()
+    FHotReloadConfig HotReload;
+
+    UPROPERTY()
+    FVerdictCacheConfig VerdictCache;
+
+    UPROPERTY()
+    FParallelStagesConfig ParallelStages;
+
+    UPROPERTY()
+    FInstrumentationConfig Instrumentation;
+
+    UPROPERTY()
+    FMetricsExporterConfig MetricsExporter;
+
+    UPROPERTY()
+    FAuditLogConfig AuditLog;
+
+    UPROPERTY()
+    FValidationProfilesConfig ValidationProfiles;
+
+    UPROPERTY()
+    FAdmissionControlConfig AdmissionControl;
+
+    UPROPERTY()
+    FSidecarConfig Sidecar;
+
+    // Load configuration and publish it - from the precompiled blob next to the JSON file when
+    // it is up to date, otherwise from the JSON itself (falls back to defaults on error)
     static UCaseyProtocol* LoadFromFile(const FString& ConfigPath);
 
-    // Get singleton instance
+    /**
+     * Parse and compile a Casey Protocol JSON file into a precompiled blob
+     * Used by the OrionCompileProtocol commandlet.
+     * @param BlobPath - Output file; FCaseyProtocolBlob::GetBlobPath(ConfigPath) is where LoadFromFile looks
+     * @return false if the JSON could not be read or parsed, or the blob could not be written
+     */
+    static bool CompileToBlob(const FString& ConfigPath, const FString& BlobPath);
+
+    /**
+     * Load and compile a new snapshot on the calling thread, then publish it
+     * In-flight validations finish on the snapshot they started with.
+     * @return false if the file could not be read or parsed - the current snapshot stays
+     */
+    static bool ReloadFromFile(const FString& ConfigPath);
+
+    /** ReloadFromFile on a background thread; overlapping requests are coalesced */
+    static void ReloadFromFileAsync(const FString& ConfigPath);
+
+    /** Poll the file's timestamp and hot-reload it whenever it changes */
+    static void StartWatching(const FString& ConfigPath, float PollIntervalSeconds);
+    static void StopWatching();
+
+    // Get singleton instance (game thread)
     static UCaseyProtocol* Get();
 
 private:
+    static void Publish(TUniquePtr<FCaseyProtocolSnapshot> Snapshot);
+    static void UpdateMirror();
+
     static UCaseyProtocol* Instance;
 };
@@ -0,0 +1,74 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+#include "OrionPatternMatcher.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FCaseyProtocolSnapshot;
+
+/**
+ * Precompiled Casey Protocol
+ * "I downloaded the whole thing. It's all in my head now."
+ *
+ * Offline-compiled form of CaseyProtocol.json: the pattern matcher tables laid out
+ * exactly as FOrionPatternMatcher uses them, plus the module configs in binary form.
+ * Loading maps the file and points the matcher straight at it - nothing is parsed.
+ *
+ * Each blob records the SHA-1 of the JSON it was compiled from. If the JSON has
+ * changed since, the blob is stale and the JSON is parsed instead.
+ *
+ * Sanitization regexes can't be serialized, so only their rule names and replacements
+ * are stored; the (few) regexes are compiled at load.
+ */
+class ORIONAI_API FCaseyProtocolBlob
+{
+public:
+    static constexpr uint32 Magic = 0x42504343;     // "CCPB"
+    static constexpr uint32 FormatVersion = 2;
+
+    FCaseyProtocolBlob() = default;
+    ~FCaseyProtocolBlob();
+
+    FCaseyProtocolBlob(const FCaseyProtocolBlob&) = delete;
+    FCaseyProtocolBlob& operator=(const FCaseyProtocolBlob&) = delete;
+
+    /** Blob that belongs to a Casey Protocol JSON file (Config/CaseyProtocol.json -> Config/CaseyProtocol.bin) */
+    static FString GetBlobPath(const FString& ConfigPath);
+
+    /** Hash of the JSON bytes, as recorded in the blob */
+    static FSHAHash HashSource(TConstArrayView<uint8> JsonBytes);
+
+    /**
+     * Write a compiled snapshot to disk
+     * @param SourceHash - HashSource() of the JSON the snapshot was parsed from
+     * @return false if the blob could not be written
+     */
+    static bool Write(const FCaseyProtocolSnapshot& Snapshot, const FSHAHash& SourceHash, const FString& BlobPath);
+
+    /**
+     * Write a snapshot with Tables in place of its own matcher's, so tests can produce a
+     * well-formed blob whose tables Load must refuse. Tables must outlive the call.
+     */
+    static bool Write(const FCaseyProtocolSnapshot& Snapshot, const FOrionPatternMatcher::FTables& Tables,
+        const FSHAHash& SourceHash, const FString& BlobPath);
+
+    /**
+     * Map a blob and build a ready-to-publish snapshot on top of it
+     * @param ExpectedSourceHash - HashSource() of the JSON currently on disk
+     * @return nullptr if the blob is missing, stale, corrupt, or from another format
+     *         version or platform
+     */
+    static TUniquePtr<FCaseyProtocolSnapshot> Load(const FString& BlobPath, const FSHAHash& ExpectedSourceHash);
+
+private:
+    // The region is released before the handle it was mapped from
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+
+    // Used instead of a mapping on platforms that can't map files
+    TArray<uint8> LoadedBytes;
+
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+};
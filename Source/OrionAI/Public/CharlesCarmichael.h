@@ -0,0 +1,46 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "OrionCancellation.h"
+#include "OrionCoreSanitizer.h"
+
+struct FCharlesCarmichaelConfig;
+
+/**
+ * Charles Carmichael - compiled PII sanitization rules
+ * "My name is Charles Carmichael." (It isn't.)
+ *
+ * Every rule in FCharlesCarmichaelConfig::SanitizationRules is resolved to one of the
+ * built-in matchers of OrionCore::FPiiSanitizer when the Casey Protocol loads. Sanitizing
+ * then makes a single left-to-right pass that finds and replaces in the same sweep, the
+ * same pass the Python package runs.
+ */
+class ORIONAI_API FCharlesCarmichaelRuleSet
+{
+public:
+    /** Compile the configured rules; unknown rule names are skipped with a warning */
+    static TSharedRef<const FCharlesCarmichaelRuleSet, ESPMode::ThreadSafe> Build(const FCharlesCarmichaelConfig& Config);
+
+    /**
+     * Replace every PII match with its rule's replacement text
+     * @param Text - Input to sanitize
+     * @param OutSanitized - Receives the sanitized text (only written when something matched)
+     * @param Token - Checked between matches; once cancelled, gives up and returns false
+     * @return true if at least one rule matched
+     */
+    bool Sanitize(const FString& Text, FString& OutSanitized, const FOrionCancellationToken& Token = FOrionCancellationToken()) const;
+
+    int32 GetNumRules() const { return Core.GetNumRules(); }
+
+    /** The engine-independent sanitizer underneath */
+    const OrionCore::FPiiSanitizer& GetCore() const { return Core; }
+
+    /**
+     * Whether no rule can match across Text[Index]
+     * Matches never contain whitespace, except the single spaces between a credit card
+     * number's digit groups.
+     */
+    static bool IsBreak(FStringView Text, int32 Index);
+
+private:
+    OrionCore::FPiiSanitizer Core;
+};
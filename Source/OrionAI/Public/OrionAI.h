@@ -1,7 +1,26 @@
 #pragma once
 #include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "Async/Future.h"
+#include "OrionMetrics.h"
+#include "OrionPatternMatcher.h"
+#include "OrionCancellation.h"
+#include "OrionInstrumentation.h"
 #include "OrionAI.generated.h"
 
+class FQueuedThreadPool;
+class FStayInTheCarStore;
+namespace OrionAI { struct FDecisionScratch; struct FAdmissionSlots; struct FAsyncValidation; class FAsyncValidationWork; class FRingIntelStageWork; }
+enum class EOrionAdmission : uint8;
+class FCharlesCarmichaelRuleSet;
+struct FCaseyProtocolSnapshot;
+struct FOrionCompiledProfile;
+struct FOrionSystemState;
+class FOrionReportArena;
+struct FOrionValidationReportView;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogOrionAI, Log, All);
+
 /**
  * OrionAI - Chuck-Style AI Oversight
  * "Guys, I know kung fu... and AI validation."
@@ -16,8 +35,15 @@
  * - Python package
  */
 
+class FOrionAIModule : public IModuleInterface
+{
+public:
+    virtual void StartupModule() override;
+    virtual void ShutdownModule() override;
+};
+
 UENUM(BlueprintType)
-enum class EValidationResult : uint8
+enum class EOrionValidationResult : uint8
 {
     Approved,           // AI decision passed all checks
     Quarantined,        // Flagged for review (Stay In The Car)
@@ -25,13 +51,116 @@ enum class EValidationResult : uint8
     Sanitized           // PII removed (Charles Carmichael)
 };
 
+/** Why QuickValidate rejected a decision */
+UENUM(BlueprintType)
+enum class EOrionQuickReason : uint8
+{
+    None,               // Safe to use
+    NotInitialized,
+    SafeMode,           // Buy More Cover is active
+    Hallucination,
+    Bias,
+    Toxicity,
+    PromptInjection,
+    DataExfiltration
+};
+
+/** What kind of rule a report triggered; the five pattern categories mirror EOrionPatternCategory */
+UENUM(BlueprintType)
+enum class EOrionRuleCategory : uint8
+{
+    None,
+    Hallucination,      // Intersect
+    Bias,               // Intersect
+    Toxicity,           // Intersect
+    PromptInjection,    // Fulcrum
+    DataExfiltration,   // Fulcrum
+    RingIntel,          // Model toxicity at or over the threshold
+    PIISanitized,       // Charles Carmichael
+    NotInitialized,
+    SafeMode,           // Buy More Cover
+    DeadlineExceeded,   // Async deadline - cheap checks only
+    StreamNotStarted,
+
+    Count UMETA(Hidden)
+};
+
+/** Output format of UOrionAI::ExportAuditReport */
+UENUM(BlueprintType)
+enum class EOrionAuditFormat : uint8
+{
+    Text,               // Totals, then by AI system, by rule and by hour
+    Csv,                // One row per hour and AI system
+    Json                // The same rows as an array of objects
+};
+
+/**
+ * A triggered rule, as a category plus one integer
+ * Reports carry these instead of text; UOrionAI::DescribeRule builds the message only
+ * when a report is logged, exported or shown.
+ */
+USTRUCT(BlueprintType)
+struct ORIONAI_API FOrionRuleId
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    EOrionRuleCategory Category = EOrionRuleCategory::None;
+
+    // Pattern rules: index of the pattern in its category, in config order.
+    // Ring Intel: toxicity in hundredths. Safe mode: 1 when global, 2 when admission
+    // control failed closed. Otherwise 0.
+    UPROPERTY()
+    int32 Detail = 0;
+
+    FOrionRuleId() = default;
+
+    FOrionRuleId(EOrionRuleCategory InCategory, int32 InDetail = 0)
+        : Category(InCategory)
+        , Detail(InDetail)
+    {
+    }
+
+    static FOrionRuleId ForPattern(EOrionPatternCategory PatternCategory, int32 PatternIndex)
+    {
+        return FOrionRuleId((EOrionRuleCategory)((uint8)PatternCategory + (uint8)EOrionRuleCategory::Hallucination), PatternIndex);
+    }
+
+    bool IsPattern() const
+    {
+        return Category >= EOrionRuleCategory::Hallucination && Category <= EOrionRuleCategory::DataExfiltration;
+    }
+
+    EOrionPatternCategory GetPatternCategory() const
+    {
+        check(IsPattern());
+        return (EOrionPatternCategory)((uint8)Category - (uint8)EOrionRuleCategory::Hallucination);
+    }
+
+    /** Category and detail in one integer, for hashing and interning */
+    uint32 Pack() const
+    {
+        return ((uint32)Category << 24) | ((uint32)Detail & 0x00FFFFFF);
+    }
+
+    bool operator==(const FOrionRuleId& Other) const
+    {
+        return Category == Other.Category && Detail == Other.Detail;
+    }
+
+    friend uint32 GetTypeHash(const FOrionRuleId& Rule)
+    {
+        return Rule.Pack();
+    }
+};
+
 USTRUCT(BlueprintType)
-struct FValidationReport
+struct FOrionValidationReport
 {
     GENERATED_BODY()
 
     UPROPERTY()
-    EValidationResult Result = EValidationResult::Approved;
+    EOrionValidationResult Result = EOrionValidationResult::Approved;
 
     UPROPERTY()
     FString AISystem;
@@ -43,7 +172,11 @@ struct FValidationReport
     FString SanitizedDecision;
 
     UPROPERTY()
-    TArray<FString> TriggeredRules;
+    TArray<FOrionRuleId> TriggeredRules;
+
+    // Casey Protocol version whose pattern lists the pattern rule IDs index into
+    UPROPERTY()
+    int64 ProtocolVersion = 0;
 
     UPROPERTY()
     float SuspicionScore = 0.0f;
@@ -56,8 +189,26 @@ struct FValidationReport
 
     UPROPERTY()
     FString Context;
+
+    // Set when an async deadline passed before the expensive stages finished.
+    // Only Intersect and Fulcrum ran; SanitizedDecision has NOT been through Charles Carmichael.
+    UPROPERTY()
+    bool bCheapChecksOnly = false;
+
+    // Set when admission control shed the decision under load: only its shedPolicy's
+    // reduced checks ran. A fail-closed rejection ran none (Safe mode rule, detail 2).
+    UPROPERTY()
+    bool bShed = false;
+
+    /** True when SanitizedDecision is Charles Carmichael's rewrite rather than a copy of the decision */
+    bool WasSanitized() const
+    {
+        return TriggeredRules.Contains(FOrionRuleId(EOrionRuleCategory::PIISanitized));
+    }
 };
 
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnOrionValidationComplete, const FOrionValidationReport&, Report);
+
 UCLASS()
 class ORIONAI_API UOrionAI : public UObject
 {
@@ -70,9 +221,24 @@ public:
      * Initialize OrionAI with Casey Protocol configuration
      * Call once at application start
      * @param ConfigPath - Path to CaseyProtocol.json (default: Config/CaseyProtocol.json)
+     * @return true if the configuration was found and OrionAI is ready
      */
     UFUNCTION(BlueprintCallable, Category = "OrionAI")
-    static void InitializeOrion(const FString& ConfigPath = TEXT("Config/CaseyProtocol.json"));
+    static bool InitializeOrion(const FString& ConfigPath = TEXT("Config/CaseyProtocol.json"));
+
+    /**
+     * Stop OrionAI worker threads; called automatically on module shutdown
+     * Pending async validations finish before this returns.
+     */
+    static void ShutdownOrion();
+
+    /**
+     * Re-read the Casey Protocol passed to InitializeOrion, off the calling thread
+     * Validations already running finish on the old config; new ones use the new one.
+     * Log sink, quarantine storage and worker settings only apply at InitializeOrion.
+     */
+    UFUNCTION(BlueprintCallable, Category = "OrionAI")
+    static void ReloadCaseyProtocol();
 
     /**
      * Monitor an AI decision for safety, bias, and compliance
@@ -82,34 +248,121 @@ public:
      * @return Validation report with result and details
      */
     UFUNCTION(BlueprintCallable, Category = "OrionAI")
-    static FValidationReport MonitorAIDecision(const FString& AISystem, const FString& Decision, const FString& Context = TEXT(""));
+    static FOrionValidationReport MonitorAIDecision(const FString& AISystem, const FString& Decision, const FString& Context = TEXT(""));
+
+    /**
+     * MonitorAIDecision without copying the decision (C++ only, see OrionReportView.h)
+     * Same checks, metrics, quarantine and alerts; only the report is lighter.
+     * @param Arena - Holds the triggered rules and, if the decision was sanitized, the sanitized text
+     * @return View into AISystem, Decision and Context - all three must outlive it, as must Arena
+     */
+    static FOrionValidationReportView MonitorAIDecision(FOrionReportArena& Arena, const FString& AISystem, const FString& Decision, const FString& Context = FString());
+
+    /**
+     * Validate many decisions from one AI system in a single call (C++ only)
+     * Scans run in parallel on the task graph in contiguous chunks that reuse their
+     * scratch buffers. Outcomes are then committed in input order, so metrics,
+     * consecutive failures and Buy More Cover behave exactly as if MonitorAIDecision
+     * had been called once per entry: once safe mode trips, later entries are rejected.
+     * Admission control takes one token and queue slot per decision, in input order: the
+     * entries that fit are evaluated in full, and only the rest are shed.
+     * @param AISystem - Name of the AI system that produced the decisions
+     * @param Decisions - AI-generated outputs to validate
+     * @param Contexts - Empty, or one context per decision
+     * @return One report per decision, in input order
+     */
+    static TArray<FOrionValidationReport> MonitorAIDecisionBatch(
+        const FString& AISystem,
+        TArrayView<const FString> Decisions,
+        TArrayView<const FString> Contexts = TArrayView<const FString>());
+
+    /**
+     * MonitorAIDecisionBatch returning views (see OrionReportView.h)
+     * One arena serves the whole batch, including the returned array.
+     * @return One view per decision, in input order; valid while Arena and the inputs are
+     */
+    static TArrayView<FOrionValidationReportView> MonitorAIDecisionBatch(
+        FOrionReportArena& Arena,
+        const FString& AISystem,
+        TArrayView<const FString> Decisions,
+        TArrayView<const FString> Contexts = TArrayView<const FString>());
+
+    /**
+     * Validate without blocking the calling thread
+     * Intersect and Fulcrum run immediately on the caller; Ring Intel and Charles Carmichael
+     * run on OrionAI's worker pool. Rejections by the cheap checks complete the future at once.
+     * The worker queue is ordered by the AI system's admission control priority.
+     * @param DeadlineSeconds - If > 0, the future completes after this long with a
+     *                          cheap-checks-only verdict (bCheapChecksOnly) when the
+     *                          expensive stages are still running. Timed on OrionAI's own
+     *                          thread, so it holds while the game thread is stalled.
+     * @return Future that receives the report; metrics are committed when it completes
+     */
+    static TFuture<FOrionValidationReport> MonitorAIDecisionAsync(
+        const FString& AISystem,
+        const FString& Decision,
+        const FString& Context = TEXT(""),
+        float DeadlineSeconds = 0.0f);
+
+    /**
+     * Blueprint version of MonitorAIDecisionAsync
+     * @param OnComplete - Executed on the game thread with the report
+     */
+    UFUNCTION(BlueprintCallable, Category = "OrionAI", meta = (DisplayName = "Monitor AI Decision (Async)"))
+    static void MonitorAIDecisionAsyncBP(const FString& AISystem, const FString& Decision, const FString& Context,
+        float DeadlineSeconds, const FOnOrionValidationComplete& OnComplete);
 
     /**
      * Quick validation without full report (for performance-critical paths)
+     * Not tied to an AI system: only global safe mode and the default profile apply
      * @return true if decision is safe to use
      */
     UFUNCTION(BlueprintCallable, Category = "OrionAI")
     static bool QuickValidate(const FString& Decision);
 
+    /**
+     * Quick validation of a decision from AISystem, under its safe mode and validation profile
+     * @return true if decision is safe to use
+     */
+    UFUNCTION(BlueprintCallable, Category = "OrionAI", meta = (DisplayName = "Quick Validate (AI System)"))
+    static bool QuickValidateForSystem(const FString& AISystem, const FString& Decision);
+
+    /**
+     * Zero-allocation fast path behind QuickValidate
+     * Runs the same compiled Intersect/Fulcrum matcher as MonitorAIDecision and stops at
+     * the first hit. Nothing is logged, counted, quarantined or sanitized - PII does not
+     * fail a decision on the full path either, so the verdict is the same.
+     * AISystem is looked up, never registered: a system OrionAI hasn't seen yet is only
+     * blocked by global safe mode, and one no profile lists gets the default profile.
+     * Admission control doesn't apply - nothing is queued.
+     * @param AISystem - System the decision came from, or empty for the global check
+     * @param OutReason - Why the decision failed, or None
+     * @return true if decision is safe to use
+     */
+    static bool QuickValidate(FStringView AISystem, FStringView Decision, EOrionQuickReason& OutReason);
+
+    /** QuickValidate fast path not tied to an AI system: only global safe mode and the default profile apply */
+    static bool QuickValidate(FStringView Decision, EOrionQuickReason& OutReason);
+
     // ========== Subsystem APIs ==========
 
     /**
      * Intersect Scanner - Core validation engine
      * Checks for hallucinations, bias, toxicity, and PII
      */
-    static bool RunIntersectScan(const FString& Decision, FValidationReport& OutReport);
+    static bool RunIntersectScan(const FString& Decision, FOrionValidationReport& OutReport);
 
     /**
      * Fulcrum Filter - Adversarial input detection
      * Detects prompt injection, jailbreak attempts, data exfiltration
      */
-    static bool RunFulcrumFilter(const FString& Input, FValidationReport& OutReport);
+    static bool RunFulcrumFilter(const FString& Input, FOrionValidationReport& OutReport);
 
     /**
      * Ring Intel - ML-based pattern learning
      * Uses trained models for advanced threat detection
      */
-    static bool RunRingIntel(const FString& Decision, FValidationReport& OutReport);
+    static bool RunRingIntel(const FString& Decision, FOrionValidationReport& OutReport);
 
     /**
      * Charles Carmichael - PII sanitization
@@ -121,23 +374,54 @@ public:
      * Stay In The Car - Quarantine suspicious outputs
      * Prevents risky AI outputs from reaching production
      */
-    static void QuarantineOutput(const FValidationReport& Report);
+    static void QuarantineOutput(const FOrionValidationReport& Report);
+
+    /** QuarantineOutput for a caller already reading the Casey Protocol - names its rules from Protocol */
+    static void QuarantineOutput(const FCaseyProtocolSnapshot& Protocol, const FOrionValidationReport& Report);
+
+    /** Bounded store holding every quarantined report still in memory */
+    static const FStayInTheCarStore& GetQuarantineStore();
+
+    // ========== Rule Names ==========
+
+    /**
+     * Human-readable text of a triggered rule, e.g. "Intersect: Bias detected - 'always'"
+     * @param ProtocolVersion - The report's ProtocolVersion; pattern rules from an older
+     *                          Casey Protocol are named by index, since their text is gone
+     */
+    static FString DescribeRule(const FOrionRuleId& Rule, int64 ProtocolVersion);
+
+    /** DescribeRule for a caller already reading the Casey Protocol - pattern rules are named from Protocol */
+    static FString DescribeRule(const FCaseyProtocolSnapshot& Protocol, const FOrionRuleId& Rule, int64 ProtocolVersion);
+
+    /** Stable snake_case key of a rule category, e.g. "prompt_injection" - for metrics and exports */
+    static const TCHAR* GetRuleCategoryKey(EOrionRuleCategory Category);
+
+    /** Text of every rule the report triggered, in order */
+    UFUNCTION(BlueprintPure, Category = "OrionAI")
+    static TArray<FString> GetTriggeredRuleNames(const FOrionValidationReport& Report);
 
     /**
      * Nerd Herd Alert - Create tickets for AI failures
-     * Integrates with Jira, GitHub, Slack, email
+     * Integrates with Jira, GitHub and Slack. Never blocks: the alert is queued for
+     * FNerdHerdDispatcher, which coalesces, batches and retries the posts.
      */
-    static void TriggerNerdHerdAlert(const FString& Issue, const FValidationReport& Report);
+    static void TriggerNerdHerdAlert(const FString& Issue, const FOrionValidationReport& Report);
+
+    /** TriggerNerdHerdAlert for a caller already reading the Casey Protocol */
+    static void TriggerNerdHerdAlert(const FCaseyProtocolSnapshot& Protocol, const FString& Issue, const FOrionValidationReport& Report);
 
     /**
      * Buy More Cover - Safe mode fallback
-     * Disables risky AI systems after critical failures
+     * Disables every AI system, whatever the isolation policy
      */
     static void EnterBuyMoreMode(const FString& Reason);
 
     /**
      * Morgan Mode - Verbose debug logging
-     * Enable for development/troubleshooting
+     * Enable for development/troubleshooting. Written only while morganMode.enabled is set;
+     * verbose (per-decision) messages also need logAllDecisions. Hot paths should use
+     * FOrionMorganMode::LogDecision so the message isn't even formatted when dropped.
      */
     static void LogToMorganMode(const FString& Message, bool bVerbose = false);
 
@@ -149,6 +433,42 @@ public:
     UFUNCTION(BlueprintCallable, Category = "OrionAI|Metrics")
     static void GetValidationMetrics(int32& OutTotalChecks, int32& OutApproved, int32& OutRejected, int32& OutQuarantined);
 
+    /**
+     * Get validation statistics as 64-bit totals (C++ only), including verdict cache hits and misses
+     * Safe to call from any thread while validations are running.
+     */
+    static void GetValidationMetrics(FOrionValidationMetrics& OutMetrics);
+
+    /**
+     * Get one AI system's validation statistics (C++ only)
+     * @return false if the system has never been validated
+     */
+    static bool GetValidationMetrics(const FString& AISystem, FOrionValidationMetrics& OutMetrics);
+
+    /**
+     * Get one AI system's end-to-end decision latency percentiles (C++ only)
+     * Empty while instrumentation.latencyHistograms is off.
+     * @return false if the system has never been validated
+     */
+    static bool GetLatencyMetrics(const FString& AISystem, FOrionLatencySummary& OutSummary);
+
+    /**
+     * Get one stage's latency percentiles across every AI system (C++ only)
+     */
+    static void GetStageLatencyMetrics(EOrionStage Stage, FOrionLatencySummary& OutSummary);
+
+    /**
+     * How often committed decisions have triggered a kind of rule, across every AI system (C++ only)
+     * Counted per category rather than per pattern, so exported metrics stay bounded.
+     */
+    static int64 GetRuleHitCount(EOrionRuleCategory Category);
+
+    /**
+     * Validations running or queued for the worker pool right now, across every AI system (C++ only)
+     * Only counted while admission control is enabled.
+     */
+    static int32 GetAdmissionQueueDepth();
+
     /**
      * Export validation report for compliance/auditing
      */
@@ -156,17 +476,41 @@ public:
     static void ExportComplianceReport(const FString& OutputPath);
 
     /**
-     * Check if Buy More Cover (safe mode) is active
+     * Export per-hour, per-AI-system verdict and rule breakdowns from the audit log
+     * Streams over the on-disk segments in bounded memory, whatever their size; needs
+     * auditLog.enabled. Decisions still buffered are written out first.
+     * @param OutputPath - Relative to the project directory, like ExportComplianceReport
+     * @return false if the audit log is off or the report couldn't be written
+     */
+    UFUNCTION(BlueprintCallable, Category = "OrionAI|Metrics")
+    static bool ExportAuditReport(const FString& OutputPath, EOrionAuditFormat Format, FDateTime From, FDateTime To);
+
+    /**
+     * Check if Buy More Cover (safe mode) is active for every AI system
      */
     UFUNCTION(BlueprintCallable, Category = "OrionAI")
     static bool IsInSafeMode();
 
+    /**
+     * Check if one AI system's decisions are being rejected - by its own safe mode or the global one
+     */
+    UFUNCTION(BlueprintCallable, Category = "OrionAI")
+    static bool IsSystemInSafeMode(const FString& AISystem);
+
     /**
      * Manually exit safe mode (requires authorization)
+     * Clears global safe mode and every AI system's own.
      */
     UFUNCTION(BlueprintCallable, Category = "OrionAI")
     static void ExitBuyMoreMode();
 
+    /**
+     * Manually re-enable one AI system (requires authorization)
+     * Global safe mode, if active, still applies.
+     */
+    UFUNCTION(BlueprintCallable, Category = "OrionAI")
+    static void ExitBuyMoreModeForSystem(const FString& AISystem);
+
     /**
      * Get dashboard URL for Ellie's Gallery (metrics visualization)
      */
@@ -174,20 +518,158 @@ public:
     static FString GetDashboardURL();
 
 private:
-    // Validation state
-    static bool bInitialized;
-    static bool bSafeModeActive;
-    static int32 ConsecutiveFailures;
-    
-    // Metrics
-    static int32 TotalValidations;
-    static int32 ApprovedCount;
-    static int32 RejectedCount;
-    static int32 QuarantinedCount;
+    friend class FOrionStreamingValidator;
+    friend class FOrionMetricsExporter;
+    friend class OrionAI::FAsyncValidationWork;
+    friend class OrionAI::FRingIntelStageWork;
+
+    /**
+     * Run every check the AI system's profile keeps, or reuse the verdict cache's answer, without touching validation state
+     * @param Profile - Protocol.GetProfile() for AISystem
+     * @param bOutCriticalBias - Set when the rejection must trip Buy More Cover
+     * @param bAllowParallelStages - Let long decisions run their stages side by side (Casey Protocol parallelStages);
+     *                               callers already fanned out across decisions leave this off
+     */
+    static void EvaluateDecision(const FCaseyProtocolSnapshot& Protocol, const FOrionCompiledProfile& Profile, const FString& AISystem, const FString& Decision,
+        OrionAI::FDecisionScratch& Scratch, FOrionValidationReport& OutReport, bool& bOutCriticalBias, bool bAllowParallelStages = false);
+
+    /**
+     * Evaluate a batch in parallel chunks, then commit it in input order
+     * @param bAttachText - Copy the text into every report; otherwise only into those CommitDecision logs or stores
+     */
+    static void EvaluateBatch(FOrionSystemState& System, const FString& AISystem, TArrayView<const FString> Decisions,
+        TArrayView<const FString> Contexts, TArrayView<FOrionValidationReport> OutReports, bool bAttachText);
+
+    /**
+     * Same checks and verdict as EvaluateCheapChecks + EvaluateExpensiveChecks, with the pattern scan,
+     * Ring Intel and Charles Carmichael running concurrently. A rejecting stage cancels the later ones.
+     * Ring Intel waits on inference, so it is queued on ExpensiveStagePool rather than holding a
+     * task graph worker; the pattern scan and sanitizer run on the calling thread and the task graph
+     * meanwhile, and Ring Intel runs inline if no pool thread has picked it up by the time they finish.
+     */
+    static void EvaluateStagesInParallel(const FCaseyProtocolSnapshot& Protocol, const FOrionCompiledProfile& Profile, const FString& AISystem, const FString& Decision,
+        OrionAI::FDecisionScratch& Scratch, FOrionValidationReport& OutReport, bool& bOutCriticalBias);
+
+    /**
+     * Fill in the verdict fields every evaluation starts from
+     * Evaluation never reads or writes the text fields (except SanitizedDecision, once
+     * sanitized); AttachReportText fills them in once the verdict is known.
+     */
+    static void BeginReport(const FCaseyProtocolSnapshot& Protocol, FOrionValidationReport& OutReport);
+
+    /** Copy the system, decision and context into an evaluated report */
+    static void AttachReportText(const FString& AISystem, const FString& Decision, const FString& Context, FOrionValidationReport& Report);
+
+    /** Whether CommitDecision will log or store the report's text - rejections and quarantines */
+    static bool NeedsReportText(const FOrionValidationReport& Report);
+
+    /** Intersect + Fulcrum with the profile's matcher; returns false when the decision is already rejected */
+    static bool EvaluateCheapChecks(const FCaseyProtocolSnapshot& Protocol, const FOrionCompiledProfile& Profile, const FString& AISystem, const FString& Decision,
+        OrionAI::FDecisionScratch& Scratch, FOrionValidationReport& OutReport, bool& bOutCriticalBias);
+
+    /** Worker side of MonitorAIDecisionAsync: the expensive stages, then complete the call unless the deadline did */
+    static void RunAsyncValidation(OrionAI::FAsyncValidation& State);
+
+    /** The pool dropped the call unrun: complete it with its cheap-checks verdict and give back what it held */
+    static void AbandonAsyncValidation(OrionAI::FAsyncValidation& State);
+
+    /** Ring Intel, Charles Carmichael and the quarantine threshold, as far as the profile keeps them */
+    static void EvaluateExpensiveChecks(const FCaseyProtocolSnapshot& Protocol, const FOrionCompiledProfile& Profile, const FString& Decision,
+        OrionAI::FDecisionScratch& Scratch, FOrionValidationReport& Report);
+
+    /**
+     * EvaluateCheapChecks for one combination of EOrionProfileStage bits, with the stages
+     * it leaves out compiled away rather than branched over
+     */
+    template <uint32 Stages>
+    static bool EvaluateCheapStages(const FCaseyProtocolSnapshot& Protocol, const FOrionCompiledProfile& Profile, const FString& AISystem, const FString& Decision,
+        OrionAI::FDecisionScratch& Scratch, FOrionValidationReport& OutReport, bool& bOutCriticalBias);
+
+    /** EvaluateExpensiveChecks for one combination of EOrionProfileStage bits */
+    template <uint32 Stages>
+    static void EvaluateExpensiveStages(const FCaseyProtocolSnapshot& Protocol, const FString& Decision, OrionAI::FDecisionScratch& Scratch, FOrionValidationReport& Report);
+
+    /** Turn one scan's matches into Intersect/Fulcrum verdicts; returns false when rejected */
+    static bool ApplyScanMatches(const FCaseyProtocolSnapshot& Protocol, const FOrionPatternMatcher::FScanResult& Matches,
+        FOrionValidationReport& Report, bool& bOutCriticalBias);
+
+    /** Stay In The Car: quarantine reports whose suspicion score crossed the snapshot's threshold */
+    static void ApplyQuarantineThreshold(const FCaseyProtocolSnapshot& Protocol, FOrionValidationReport& Report);
+
+    /** Charles Carmichael changed the decision: record the sanitized text */
+    static void ApplySanitization(const FString& Sanitized, FOrionValidationReport& Report);
+
+    static EOrionQuickReason ToQuickReason(EOrionPatternCategory Category);
+
+    /**
+     * Ring Intel against a specific snapshot
+     * Only adds rules and suspicion to Report, sets its confidence, and sets the result when
+     * it rejects - so a verdict computed on a fresh report can be merged into another one.
+     * @param Token - Lets a parallel evaluation abandon inference once an earlier stage rejected
+     */
+    static bool EvaluateRingIntel(const FCaseyProtocolSnapshot& Protocol, const FString& Decision, FOrionValidationReport& Report,
+        const FOrionCancellationToken& Token = FOrionCancellationToken());
+
+    /**
+     * Admission control for NumDecisions decisions from System, before they are evaluated
+     * Full coverage, the profile's shed copy, or a fail-closed rejection. The decisions'
+     * queue slots are held in OutSlots until the caller releases or destroys it.
+     */
+    static EOrionAdmission Admit(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, int32 NumDecisions,
+        OrionAI::FAdmissionSlots& OutSlots);
+
+    /**
+     * Admit for a batch, in order
+     * @param OutNumFull - How many leading decisions get full coverage; the admission returned
+     *                     applies to the rest, and is Full only if every decision fit
+     */
+    static EOrionAdmission Admit(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, int32 NumDecisions,
+        OrionAI::FAdmissionSlots& OutSlots, int32& OutNumFull);
+
+    /** Flag a report evaluated under a shed profile */
+    static void MarkShed(const FCaseyProtocolSnapshot& Protocol, FOrionValidationReport& Report);
+
+    /**
+     * Apply an evaluated report to metrics, safe mode, quarantine and alerts; rejections and quarantines need their text attached
+     * @param Protocol - The snapshot the report was evaluated against, so the thresholds and alert settings agree with the verdict
+     */
+    static void CommitDecision(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, FOrionValidationReport& Report, bool bCriticalBias);
+
+    /** Per-AISystem state, created the first time the system is validated (up to FOrionSystemStateTable::MaxSystems) */
+    static FOrionSystemState& GetSystemState(const FString& AISystem);
+
+    /** True when decisions from System must get the safe mode report */
+    static bool IsBlocked(const FOrionSystemState& System);
+
+    /** Visit every AI system validated so far, in the order they were first seen */
+    static void ForEachSystemState(TFunctionRef<void(const FOrionSystemState&)> Visitor);
+
+    /** Buy More Cover for the system that failed - or for everyone, depending on the isolation policy */
+    static void TripBuyMoreCover(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, const FString& Reason);
+
+    static FOrionValidationReport MakeNotInitializedReport();
+    static FOrionValidationReport MakeSafeModeReport();
+    static FOrionValidationReport MakeShedReport(const FCaseyProtocolSnapshot& Protocol);
+
+    /** Shared handling for rejected decisions (safe mode escalation + alerts) */
+    static void HandleValidationFailure(const FCaseyProtocolSnapshot& Protocol, FOrionSystemState& System, FOrionValidationReport& Report);
+
+    // Validation state (safe to read and update from any thread)
+    static std::atomic<bool> bInitialized;
+    static std::atomic<bool> bSafeModeActive;
+    static std::atomic<int32> ConsecutiveFailures;   // Across all systems, for shared isolation
+    static std::atomic<int32> NumSystemsInSafeMode;
     
-    // Quarantine storage
-    static TArray<FValidationReport> QuarantinedReports;
+    // Metrics - per-thread stripes, summed on read
+    static FOrionStripedCounters Counters;
+    static TOrionStripedCounters<(int32)EOrionRuleCategory::Count> RuleHits;
     
+    // Worker pool for the expensive async stages
+    static FQueuedThreadPool* ExpensiveStagePool;
+
+    // Casey Protocol file passed to InitializeOrion, for reloads
+    static FString ConfigFilePath;
+
     // Dashboard server
     static FString DashboardURL;
 };
\ No newline at end of file
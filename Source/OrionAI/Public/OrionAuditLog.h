@@ -0,0 +1,129 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "OrionAI.h"
+#include <atomic>
+
+struct FAuditLogConfig;
+
+/** Time range of an audit export; records are matched on their validation time (UTC) */
+struct ORIONAI_API FOrionAuditQuery
+{
+    FDateTime From = FDateTime::MinValue();
+    FDateTime To = FDateTime::MaxValue();
+};
+
+/** What an audit export read to produce its report */
+struct ORIONAI_API FOrionAuditExportStats
+{
+    int64 Records = 0;              // Records in range, from either source
+    int32 SegmentsScanned = 0;      // Read record by record
+    int32 SegmentsFromRollups = 0;  // Answered from their pre-aggregated rollup
+    int32 Rows = 0;                 // Hour x AI system rows written
+};
+
+/**
+ * Append-only, columnar audit log of every committed decision
+ * "Every mission goes in the file, Chuck. Every single one."
+ *
+ * Record() copies a handful of fields into one of several thread-sharded buffers.
+ * A full buffer (or one older than the flush interval) is turned into a block: a
+ * header, the AI system names the segment hasn't seen yet, then one packed column each
+ * for time, AI system, verdict, rule mask, first pattern rule, protocol version and
+ * scores. The block is handed to FOrionLogWriter and appended to the current segment file.
+ * Segments rotate at SegmentMaxMB. On rotation an hourly rollup (verdicts, rule hits
+ * and suspicion per hour and AI system) is written next to the segment.
+ *
+ * Export() streams over the segments. Closed segments wholly inside the range are read
+ * from their rollups. Others are memory-mapped and scanned block by block, reading only
+ * the columns a report needs. Memory grows with hours x AI systems, never with records.
+ */
+class ORIONAI_API FOrionAuditLog
+{
+public:
+    static FOrionAuditLog& Get();
+
+    ~FOrionAuditLog();
+
+    /** Open a new segment in the configured directory and start the flush ticker; game thread */
+    void Start(const FAuditLogConfig& Config);
+
+    /** Write every buffered record, close the segment with its rollup and stop */
+    void Stop();
+
+    bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+    /** Buffer one committed decision; safe from any thread */
+    void Record(FName AISystem, const FOrionValidationReport& Report);
+
+    /** Turn every partly filled buffer into a block and queue it for writing */
+    void Flush();
+
+    /** Absolute directory the segments are written to */
+    const FString& GetDirectory() const { return Directory; }
+
+    int64 GetRecordedCount() const { return RecordedCount.load(std::memory_order_relaxed); }
+
+    /** Records lost because the log writer was over budget when their block was queued */
+    int64 GetDroppedCount() const { return DroppedCount.load(std::memory_order_relaxed); }
+
+    /**
+     * Write a per-hour, per-AI-system report of every segment in a directory
+     * Needs no running audit log, so it also works offline (see OrionExportAudit).
+     * @return false if the output file couldn't be written
+     */
+    static bool Export(const FString& InDirectory, const FOrionAuditQuery& Query, EOrionAuditFormat Format, const FString& OutputPath, FOrionAuditExportStats* OutStats = nullptr);
+
+private:
+    struct FRecord
+    {
+        int64 TimeMs = 0;
+        FName AISystem;
+        uint32 PatternRule = 0;     // FOrionRuleId::Pack() of the first pattern rule, 0 if none
+        uint32 ProtocolVersion = 0;
+        float SuspicionScore = 0.0f;
+        float ConfidenceScore = 0.0f;
+        uint16 RuleMask = 0;        // Bit per EOrionRuleCategory
+        uint8 Result = 0;
+    };
+
+    struct FShard;
+    struct FRollup;
+
+    /** Unix time in milliseconds, without a clock syscall per record */
+    int64 GetNowMs() const;
+
+    /** Take a shard's records, to be written outside its lock */
+    void FlushShard(FShard& Shard, bool bOnlyIfStale);
+
+    /** Encode records as one block and queue it on the current segment */
+    void WriteBlock(TArray<FRecord>&& Records);
+
+    void OpenSegment();
+
+    /** Queue the segment's rollup and close both files */
+    void CloseSegment();
+
+    std::atomic<bool> bRunning{ false };
+    std::atomic<int64> RecordedCount{ 0 };
+    std::atomic<int64> DroppedCount{ 0 };
+
+    FString Directory;
+    int32 BlockRecords = 4096;
+    double FlushIntervalSeconds = 5.0;
+    int64 SegmentMaxBytes = 64ll * 1024 * 1024;
+
+    int64 StartUnixMs = 0;
+    double StartSeconds = 0.0;
+
+    TArray<TUniquePtr<FShard>> Shards;
+    FTSTicker::FDelegateHandle FlushHandle;
+
+    // Current segment - guarded by SegmentLock, which also keeps blocks in queue order
+    FCriticalSection SegmentLock;
+    FString SegmentPath;
+    int64 SegmentBytes = 0;
+    int32 SegmentSequence = 0;
+    TMap<FName, uint16> SystemIds;
+    TUniquePtr<FRollup> Rollup;
+};
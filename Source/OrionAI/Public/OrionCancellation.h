@@ -0,0 +1,44 @@
+#pragma once
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Cancellation shared by the stages of one parallel evaluation
+ * "Abort the mission. Everybody out."
+ *
+ * Stages are ranked in the order the sequential pipeline runs them. A rejection
+ * cancels every later stage; earlier stages keep going, because in sequence their
+ * verdict would have come first.
+ */
+class FOrionStageCancellation
+{
+public:
+    /** Record that Stage rejected the decision */
+    void Reject(int32 Stage)
+    {
+        int32 Current = FirstRejected.load(std::memory_order_relaxed);
+        while (Stage < Current && !FirstRejected.compare_exchange_weak(Current, Stage, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    bool IsCancelled(int32 Stage) const
+    {
+        return FirstRejected.load(std::memory_order_relaxed) < Stage;
+    }
+
+private:
+    std::atomic<int32> FirstRejected{ MAX_int32 };
+};
+
+/** One stage's view of an FOrionStageCancellation; a default token is never cancelled */
+struct FOrionCancellationToken
+{
+    const FOrionStageCancellation* Cancellation = nullptr;
+    int32 Stage = 0;
+
+    bool IsCancelled() const
+    {
+        return Cancellation && Cancellation->IsCancelled(Stage);
+    }
+};
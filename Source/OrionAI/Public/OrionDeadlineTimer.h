@@ -0,0 +1,59 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+
+/**
+ * Deadlines for MonitorAIDecisionAsync, kept on a thread of their own
+ * "You have ten minutes, Bartowski. Whether or not anyone is watching the clock."
+ *
+ * Add() schedules a callback for when its delay has passed. A single timer thread sleeps
+ * until the soonest deadline, so deadlines are honoured while the game thread is stalled
+ * and in hosts that never tick FTSTicker. Callbacks run on the timer thread and should
+ * be short - they only complete a future.
+ */
+class ORIONAI_API FOrionDeadlineTimer : public FRunnable
+{
+public:
+    static FOrionDeadlineTimer& Get();
+
+    virtual ~FOrionDeadlineTimer();
+
+    void Start();
+
+    /** Stop the thread; callbacks still waiting for their deadline are dropped unrun */
+    void Stop();
+
+    /**
+     * Run Callback on the timer thread once DelaySeconds have passed
+     * @return false if the timer isn't running - Callback is dropped unrun
+     */
+    bool Add(double DelaySeconds, TUniqueFunction<void()>&& Callback);
+
+    bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+    // FRunnable
+    virtual uint32 Run() override;
+
+private:
+    struct FTimer
+    {
+        double FireTime = 0.0;
+        TUniqueFunction<void()> Callback;
+    };
+
+    // Min-heap on FireTime; guarded by Lock together with bRunning
+    FCriticalSection Lock;
+    TArray<FTimer> Timers;
+
+    std::atomic<bool> bRunning{ false };
+    std::atomic<bool> bStopRequested{ false };
+
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+};
@@ -0,0 +1,180 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+#include <atomic>
+
+// Define as 0 to compile every stage scope, stat and histogram sample out of OrionAI
+#ifndef ORION_INSTRUMENTATION
+#define ORION_INSTRUMENTATION 1
+#endif
+
+/** Stages of one validation, as timed by the instrumentation */
+enum class EOrionStage : uint8
+{
+    PatternScan,        // Intersect + Fulcrum - one shared pass over the text
+    RingIntel,
+    CharlesCarmichael,
+    Quarantine,         // Stay In The Car
+    Alerting,           // Nerd Herd
+    Decision,           // One decision end to end - sync, async, each of a batch, or a stream's Finish
+
+    Count
+};
+
+/** Percentiles of a latency histogram, in microseconds */
+struct ORIONAI_API FOrionLatencySummary
+{
+    int64 Count = 0;
+    double MinUs = 0.0;
+    double MeanUs = 0.0;
+    double P50Us = 0.0;
+    double P90Us = 0.0;
+    double P99Us = 0.0;
+    double P999Us = 0.0;
+    double MaxUs = 0.0;
+};
+
+/**
+ * Lock-free latency histogram with HDR-style log-linear buckets
+ * "Every second counts, Chuck. Literally."
+ *
+ * Each power of two is split into 16 linear buckets, so any reported percentile is
+ * within ~3% of the true value, from nanoseconds up to 18 minutes, in a fixed ~5KB.
+ * Recording is one relaxed atomic add per bucket plus min/max/sum bookkeeping.
+ */
+class ORIONAI_API FOrionLatencyHistogram
+{
+public:
+    FOrionLatencyHistogram();
+
+    void Record(uint64 Nanoseconds);
+
+    void Snapshot(FOrionLatencySummary& OutSummary) const;
+
+    /**
+     * Cumulative sample counts at or below each of a sorted list of bounds, for exporting
+     * as a Prometheus-style histogram. Samples are placed by their bucket's midpoint, so
+     * counts right at a bound share the histogram's ~3% error.
+     */
+    void SnapshotCumulative(TConstArrayView<double> UpperBoundsSeconds, TArrayView<int64> OutCounts, int64& OutTotal, double& OutSumSeconds) const;
+
+    void Reset();
+
+private:
+    static constexpr int32 SubBucketBits = 4;
+    static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+    static constexpr int32 MaxShift = 36;
+    static constexpr int32 NumBuckets = (MaxShift + 2) * SubBucketCount;
+
+    static int32 GetBucketIndex(uint64 Nanoseconds);
+
+    /** Midpoint of a bucket's range, in nanoseconds */
+    static double GetBucketValue(int32 Index);
+
+    std::atomic<int64> Buckets[NumBuckets];
+    std::atomic<int64> Count{ 0 };
+    std::atomic<uint64> TotalNanoseconds{ 0 };
+    std::atomic<uint64> MinNanoseconds{ MAX_uint64 };
+    std::atomic<uint64> MaxNanoseconds{ 0 };
+};
+
+/**
+ * Global switches and per-stage histograms behind ORION_STAGE_SCOPE
+ * Stage histograms cover every AI system; per-system decision latency lives on
+ * FOrionSystemState.
+ */
+class ORIONAI_API FOrionInstrumentation
+{
+public:
+    /** Mirrors the Casey Protocol instrumentation.latencyHistograms setting */
+    static void SetLatencyHistogramsEnabled(bool bEnabled)
+    {
+        bLatencyHistograms.store(bEnabled, std::memory_order_relaxed);
+    }
+
+    static bool AreLatencyHistogramsEnabled()
+    {
+        return bLatencyHistograms.load(std::memory_order_relaxed);
+    }
+
+    static FOrionLatencyHistogram& GetStageHistogram(EOrionStage Stage);
+
+    /** Start time for RecordSince, or 0 when histograms are off */
+    static uint64 StartTiming()
+    {
+        return AreLatencyHistogramsEnabled() ? FPlatformTime::Cycles64() : 0;
+    }
+
+    /** Record the time since StartTiming() into the stage histogram and, if given, one more */
+    static void RecordSince(EOrionStage Stage, uint64 StartCycles, FOrionLatencyHistogram* ExtraHistogram = nullptr);
+
+    static const TCHAR* GetStageName(EOrionStage Stage);
+
+private:
+    static std::atomic<bool> bLatencyHistograms;
+};
+
+/** Times a scope into a stage histogram (and optionally one more); free when histograms are off */
+class ORIONAI_API FOrionStageTimer
+{
+public:
+    explicit FOrionStageTimer(EOrionStage InStage, FOrionLatencyHistogram* InExtraHistogram = nullptr)
+        : Stage(InStage)
+        , ExtraHistogram(InExtraHistogram)
+        , StartCycles(FOrionInstrumentation::StartTiming())
+    {
+    }
+
+    ~FOrionStageTimer()
+    {
+        if (StartCycles != 0)
+        {
+            FOrionInstrumentation::RecordSince(Stage, StartCycles, ExtraHistogram);
+        }
+    }
+
+    FOrionStageTimer(const FOrionStageTimer&) = delete;
+    FOrionStageTimer& operator=(const FOrionStageTimer&) = delete;
+
+private:
+    EOrionStage Stage;
+    FOrionLatencyHistogram* ExtraHistogram;
+    uint64 StartCycles;
+};
+
+#if ORION_INSTRUMENTATION
+
+UE_TRACE_CHANNEL_EXTERN(OrionAIChannel, ORIONAI_API);
+
+DECLARE_STATS_GROUP(TEXT("OrionAI"), STATGROUP_OrionAI, STATCAT_Advanced);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pattern Scan"), STAT_OrionAI_PatternScan, STATGROUP_OrionAI, ORIONAI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ring Intel"), STAT_OrionAI_RingIntel, STATGROUP_OrionAI, ORIONAI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Charles Carmichael"), STAT_OrionAI_CharlesCarmichael, STATGROUP_OrionAI, ORIONAI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Quarantine"), STAT_OrionAI_Quarantine, STATGROUP_OrionAI, ORIONAI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Alerting"), STAT_OrionAI_Alerting, STATGROUP_OrionAI, ORIONAI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decision"), STAT_OrionAI_Decision, STATGROUP_OrionAI, ORIONAI_API);
+
+/**
+ * Instrument the rest of the scope as one stage: an Insights CPU event on the OrionAI
+ * trace channel, a cycle counter in "stat OrionAI", and a latency histogram sample.
+ * Each costs a flag check when its consumer isn't listening.
+ */
+#define ORION_STAGE_SCOPE(Stage) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("OrionAI::" #Stage, OrionAIChannel); \
+    SCOPE_CYCLE_COUNTER(STAT_OrionAI_##Stage); \
+    FOrionStageTimer ANONYMOUS_VARIABLE(OrionStageTimer)(EOrionStage::Stage)
+
+/** As ORION_STAGE_SCOPE, also recording into a second histogram, e.g. an AI system's */
+#define ORION_STAGE_SCOPE_WITH(Stage, Histogram) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("OrionAI::" #Stage, OrionAIChannel); \
+    SCOPE_CYCLE_COUNTER(STAT_OrionAI_##Stage); \
+    FOrionStageTimer ANONYMOUS_VARIABLE(OrionStageTimer)(EOrionStage::Stage, &(Histogram))
+
+#else
+
+#define ORION_STAGE_SCOPE(Stage)
+#define ORION_STAGE_SCOPE_WITH(Stage, Histogram)
+
+#endif
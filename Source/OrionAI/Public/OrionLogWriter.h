@@ -0,0 +1,106 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+class IFileHandle;
+struct FLogSinkConfig;
+
+/**
+ * Background log writer for the quarantine, safe mode, Morgan Mode and Nerd Herd files
+ * "Lester, write that down. No - later. In a batch."
+ *
+ * Producers push lines onto a lock-free MPSC queue and return immediately. A single
+ * writer thread drains the queue on a fixed interval, appends each file's lines in
+ * one write through a handle that stays open, and optionally fsyncs after the batch.
+ * Queued memory is bounded; lines over the budget are dropped and counted.
+ * Calls that race Stop() either finish queuing before it drains, or see the writer
+ * stopped and append synchronously.
+ */
+class ORIONAI_API FOrionLogWriter : public FRunnable
+{
+public:
+    static FOrionLogWriter& Get();
+
+    virtual ~FOrionLogWriter();
+
+    /** Start the writer thread; until then Write() appends synchronously */
+    void Start(const FLogSinkConfig& Config);
+
+    /** Drain everything still queued, close all files and stop the thread */
+    void Stop();
+
+    /**
+     * Queue text to be appended to a file (UTF-8)
+     * @param FilePath - Absolute path; the directory is created on first write
+     * @return false if the line was dropped because the queue is over budget
+     */
+    bool Write(const FString& FilePath, FString&& Text);
+
+    /** Queue raw bytes to be appended to a file */
+    bool WriteBytes(const FString& FilePath, TArray<uint8>&& Bytes);
+
+    /** Block until everything queued before this call is on disk */
+    void Flush();
+
+    /** Close a file's handle once everything queued for it before this call is written */
+    void Close(const FString& FilePath);
+
+    int64 GetDroppedCount() const { return DroppedCount.load(std::memory_order_relaxed); }
+    bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+    // FRunnable
+    virtual uint32 Run() override;
+
+private:
+    struct FEntry
+    {
+        FString FilePath;
+        FString Text;
+        TArray<uint8> Bytes;
+        FEvent* FlushEvent = nullptr;   // Set for flush markers only
+        bool bClose = false;            // Close marker for FilePath
+    };
+
+    /** Counts a producer call in for as long as it may touch Queue or WakeEvent */
+    struct FProducerScope
+    {
+        explicit FProducerScope(FOrionLogWriter& InWriter);
+        ~FProducerScope();
+
+        /** Whether the writer was still running once this call was counted in */
+        bool IsRunning() const { return bRunning; }
+
+    private:
+        FOrionLogWriter& Writer;
+        bool bRunning;
+    };
+
+    bool Enqueue(FEntry* Entry, int64 Size);
+    void DrainQueue();
+    IFileHandle* GetHandle(const FString& FilePath);
+    void CloseHandles();
+
+    TQueue<FEntry*, EQueueMode::Mpsc> Queue;
+    std::atomic<int64> QueuedBytes{ 0 };
+    std::atomic<int64> DroppedCount{ 0 };
+    std::atomic<bool> bRunning{ false };
+    std::atomic<bool> bStopRequested{ false };
+
+    // Producer calls between FProducerScope's check of bRunning and their return
+    std::atomic<int32> NumProducers{ 0 };
+
+    int64 MaxQueuedBytes = 4 * 1024 * 1024;
+    uint32 FlushIntervalMs = 250;
+    bool bFsyncOnFlush = false;
+
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+
+    // Writer thread only
+    TMap<FString, TUniquePtr<IFileHandle>> Handles;
+    TMap<FString, TArray<uint8>> PendingWrites;
+};
@@ -0,0 +1,122 @@
+#pragma once
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Outcome counters tracked by UOrionAI
+ */
+enum class EOrionCounter : uint8
+{
+    Approved,
+    Rejected,
+    Quarantined,
+    CacheHits,          // Verdict cache - only counted while the cache is enabled
+    CacheMisses,
+    ShedQueueDepth,     // Admission control - shed because too many validations were in flight
+    ShedRateLimit,      // Admission control - shed because the AI system was over its rate limit
+
+    Count
+};
+
+/**
+ * Point-in-time copy of the validation totals
+ * TotalValidations is derived from the outcome counters, so it always equals their sum.
+ */
+struct ORIONAI_API FOrionValidationMetrics
+{
+    int64 TotalValidations = 0;
+    int64 Approved = 0;
+    int64 Rejected = 0;
+    int64 Quarantined = 0;
+    int64 CacheHits = 0;
+    int64 CacheMisses = 0;
+    int64 ShedQueueDepth = 0;
+    int64 ShedRateLimit = 0;
+};
+
+/** Hands each thread the stripe it increments in every striped counter set */
+struct ORIONAI_API FOrionCounterStripes
+{
+    static constexpr int32 NumStripes = 32;
+
+    // Threads are handed stripes round-robin the first time they count anything
+    static int32 GetLocalStripeIndex();
+};
+
+/**
+ * Striped, lock-free counters
+ * "Jeff and Lester, counting in parallel."
+ *
+ * Each thread increments its own cache-line-sized stripe with a relaxed atomic add,
+ * so concurrent validations never contend on a shared line. Reads sum every stripe.
+ */
+template <int32 NumCounters>
+class TOrionStripedCounters
+{
+public:
+    TOrionStripedCounters()
+    {
+        Reset();
+    }
+
+    void Add(int32 Counter, int64 Amount = 1)
+    {
+        Stripes[FOrionCounterStripes::GetLocalStripeIndex()].Values[Counter].fetch_add(Amount, std::memory_order_relaxed);
+    }
+
+    int64 Get(int32 Counter) const
+    {
+        int64 Total = 0;
+        for (const FStripe& Stripe : Stripes)
+        {
+            Total += Stripe.Values[Counter].load(std::memory_order_relaxed);
+        }
+        return Total;
+    }
+
+    void Reset()
+    {
+        for (FStripe& Stripe : Stripes)
+        {
+            for (std::atomic<int64>& Value : Stripe.Values)
+            {
+                Value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FStripe
+    {
+        std::atomic<int64> Values[NumCounters];
+    };
+
+    FStripe Stripes[FOrionCounterStripes::NumStripes];
+};
+
+/** Outcome and verdict cache counters, as kept globally and per AI system */
+class FOrionStripedCounters : public TOrionStripedCounters<(int32)EOrionCounter::Count>
+{
+public:
+    void Increment(EOrionCounter Counter, int64 Amount = 1)
+    {
+        Add((int32)Counter, Amount);
+    }
+
+    int64 Get(EOrionCounter Counter) const
+    {
+        return TOrionStripedCounters::Get((int32)Counter);
+    }
+
+    void Snapshot(FOrionValidationMetrics& OutMetrics) const
+    {
+        OutMetrics.Approved = Get(EOrionCounter::Approved);
+        OutMetrics.Rejected = Get(EOrionCounter::Rejected);
+        OutMetrics.Quarantined = Get(EOrionCounter::Quarantined);
+        OutMetrics.TotalValidations = OutMetrics.Approved + OutMetrics.Rejected + OutMetrics.Quarantined;
+        OutMetrics.CacheHits = Get(EOrionCounter::CacheHits);
+        OutMetrics.CacheMisses = Get(EOrionCounter::CacheMisses);
+        OutMetrics.ShedQueueDepth = Get(EOrionCounter::ShedQueueDepth);
+        OutMetrics.ShedRateLimit = Get(EOrionCounter::ShedRateLimit);
+    }
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HttpRouteHandle.h"
+
+class IHttpRouter;
+struct FMetricsExporterConfig;
+
+/**
+ * OpenMetrics endpoint for fleet monitoring
+ * "Big Mike doesn't want a report. He wants the numbers, now."
+ *
+ * Serves Prometheus scrapes from the engine's embedded HTTP server. Each scrape takes
+ * snapshots of the lock-free counters and latency histograms and formats them into
+ * OpenMetrics text, on the HTTP server's thread. Validations only ever bump atomics,
+ * so scraping adds nothing to the validation path and nothing is written to disk.
+ */
+class ORIONAI_API FOrionMetricsExporter
+{
+public:
+    static FOrionMetricsExporter& Get();
+
+    /** Bind the metrics route and start listening; call from the game thread */
+    void Start(const FMetricsExporterConfig& Config);
+
+    void Stop();
+
+    bool IsRunning() const { return Router.IsValid(); }
+
+    /**
+     * Current metrics in the OpenMetrics text format, terminated by "# EOF"
+     * Usable without the endpoint, e.g. to push to a gateway.
+     */
+    static FString BuildOpenMetrics();
+
+private:
+    TSharedPtr<IHttpRouter> Router;
+    FHttpRouteHandle RouteHandle;
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include "CoreMinimal.h"
+#include <atomic>
+
+struct FMorganModeConfig;
+
+/**
+ * Morgan Mode gating for the per-decision log lines
+ * "I tell you everything, Chuck. Everything. Unless you're not listening."
+ *
+ * Mirrors the current Casey Protocol's morganMode section into atomics, so the hot path
+ * decides whether to log with a relaxed load instead of formatting the line first.
+ * Messages are passed as formatters - callables returning an FString - and only run
+ * when the line is actually written.
+ */
+class ORIONAI_API FOrionMorganMode
+{
+public:
+    /** Mirror a newly published protocol's morganMode settings */
+    static void Configure(const FMorganModeConfig& Config);
+
+    /** Morgan Mode is on at all */
+    static bool IsEnabled()
+    {
+        return bEnabled.load(std::memory_order_relaxed);
+    }
+
+    /** Morgan Mode is on and logs every decision, not just failures */
+    static bool ShouldLogDecisions()
+    {
+        return bLogAllDecisions.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Whether this approval is one of the 1 in approvalLogSampleRate that get logged
+     * Sampled per thread, so concurrent validations never share a counter.
+     */
+    static bool ShouldLogApproval()
+    {
+        return ShouldLogDecisions() && SampleApproval();
+    }
+
+    /** Write a decision line to the Morgan Mode file, formatting it only if decisions are logged */
+    template <typename FormatterType>
+    static void LogDecision(FormatterType&& Formatter)
+    {
+        if (ShouldLogDecisions())
+        {
+            Write(Formatter());
+        }
+    }
+
+    /** Append a timestamped line to the Morgan Mode file, whatever the gates say */
+    static void Write(const FString& Message);
+
+private:
+    static bool SampleApproval();
+
+    static std::atomic<bool> bEnabled;
+    static std::atomic<bool> bLogAllDecisions;
+    static std::atomic<uint32> ApprovalLogSampleRate;
+};
@@ -0,0 +1,168 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "Interfaces/IHttpRequest.h"
+#include "OrionAI.h"
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+struct FNerdHerdConfig;
+
+/**
+ * Nerd Herd alert dispatch - Slack, GitHub and Jira, off the validating thread
+ * "Nerd Herd, this is a Code Red. One ticket, not four thousand."
+ *
+ * Raise() pushes the alert onto a bounded lock-free queue and returns; when the queue
+ * is full the alert is dropped and counted. A single dispatch thread then:
+ *  - coalesces repeats: the first alert for an (AI system, rule) pair goes out, and
+ *    further ones inside the coalesce window are folded into one "N more" summary
+ *  - batches: lines wait up to BatchDelayMs for others, then each enabled integration
+ *    gets one post for the whole batch
+ *  - retries 429s, 5xx and connection failures with exponential backoff (honouring
+ *    Retry-After), keeping at most MaxPendingPosts posts and dropping the oldest
+ *
+ * Posts are sent without blocking the dispatch thread, so a dead endpoint only delays
+ * its own integration.
+ */
+class ORIONAI_API FNerdHerdDispatcher : public FRunnable
+{
+public:
+    static FNerdHerdDispatcher& Get();
+
+    virtual ~FNerdHerdDispatcher();
+
+    /** Resolve the integrations and start the dispatch thread; call from the game thread */
+    void Start(const FNerdHerdConfig& Config);
+
+    /** Post what is already batched (one attempt, briefly awaited) and stop the thread */
+    void Stop();
+
+    /**
+     * Queue an alert for the enabled integrations
+     * Repeats are coalesced by AI system and the report's first triggered rule, which is
+     * only named, on the dispatch thread, when its alert is actually posted.
+     * @return false if the alert was dropped: the dispatcher isn't running or is over budget
+     */
+    bool Raise(const FString& Issue, const FOrionValidationReport& Report);
+
+    bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+    /** Alerts dropped because the queue was full */
+    int64 GetDroppedAlertCount() const { return DroppedAlerts.load(std::memory_order_relaxed); }
+
+    /** Alerts folded into a summary instead of being posted on their own */
+    int64 GetCoalescedAlertCount() const { return CoalescedAlerts.load(std::memory_order_relaxed); }
+
+    /** Posts given up on - out of retries, rejected by the endpoint, or evicted */
+    int64 GetFailedPostCount() const { return FailedPosts.load(std::memory_order_relaxed); }
+
+    // FRunnable
+    virtual uint32 Run() override;
+
+private:
+    struct FAlert
+    {
+        FString AISystem;
+        FOrionRuleId Rule;
+        int64 ProtocolVersion = 0;
+        FString Issue;
+        float SuspicionScore = 0.0f;
+        FDateTime Timestamp;
+    };
+
+    /** Repeats of one (AI system, rule) pair inside its window */
+    struct FCoalesced
+    {
+        FString Label;
+        double WindowEnd = 0.0;
+        int32 Suppressed = 0;
+        float MaxScore = 0.0f;
+    };
+
+    /** One webhook or REST endpoint */
+    struct FTarget
+    {
+        FString Name;
+        FString Url;
+        TArray<TPair<FString, FString>> Headers;
+        TFunction<FString(const TArray<FString>& Lines)> MakePayload;
+    };
+
+    enum class EPostState : uint8
+    {
+        Waiting,
+        InFlight,
+        Done
+    };
+
+    struct FPost
+    {
+        int32 Target = 0;
+        FString Payload;
+        int32 Attempts = 0;
+        double NextAttemptTime = 0.0;
+        EPostState State = EPostState::Waiting;
+
+        // Written by the HTTP thread before bCompleted is released
+        std::atomic<bool> bCompleted{ false };
+        int32 ResponseCode = 0;
+        double RetryAfterSeconds = 0.0;
+        FHttpRequestPtr Request;
+    };
+
+    using FPostRef = TSharedRef<FPost, ESPMode::ThreadSafe>;
+
+    void AddTargets(const FNerdHerdConfig& Config);
+
+    /** Move queued alerts into the current batch, or into their coalesced summary */
+    void DrainQueue(double Now);
+
+    /** Write out the summary of every window that has closed */
+    void CloseWindows(double Now, bool bCloseAll);
+
+    /** Append a line to the current batch, posting it once full */
+    void AddLine(FString&& Line, double Now);
+
+    /** Turn the current batch into one post per target */
+    void FlushBatch();
+
+    void AddPost(int32 Target, FString&& Payload);
+
+    /** Collect finished posts and send the ones whose next attempt is due */
+    void PumpPosts(double Now);
+
+    void Send(const FPostRef& Post);
+
+    /** Seconds until something needs the dispatch thread again */
+    double GetWaitSeconds(double Now) const;
+
+    TQueue<FAlert*, EQueueMode::Mpsc> Queue;
+    std::atomic<int32> QueuedAlerts{ 0 };
+    std::atomic<int64> DroppedAlerts{ 0 };
+    std::atomic<int64> CoalescedAlerts{ 0 };
+    std::atomic<int64> FailedPosts{ 0 };
+    std::atomic<bool> bRunning{ false };
+    std::atomic<bool> bStopRequested{ false };
+
+    int32 MaxQueuedAlerts = 4096;
+    double CoalesceWindowSeconds = 60.0;
+    double BatchDelaySeconds = 2.0;
+    int32 MaxAlertsPerBatch = 50;
+    int32 MaxRetries = 5;
+    double RetryBackoffSeconds = 1.0;
+    double MaxRetryBackoffSeconds = 60.0;
+    float RequestTimeoutSeconds = 10.0f;
+    int32 MaxPendingPosts = 64;
+
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+
+    // Dispatch thread only (and Start/Stop while it isn't running)
+    TArray<FTarget> Targets;
+    TMap<TPair<FString, uint32>, FCoalesced> Windows;
+    TArray<FString> Batch;
+    double BatchOpenedAt = 0.0;
+    TArray<FPostRef> Posts;
+};
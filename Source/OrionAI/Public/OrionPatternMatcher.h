@@ -0,0 +1,226 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "OrionCoreMatcher.h"
+
+struct FIntersectScannerConfig;
+struct FFulcrumFilterConfig;
+enum class EOrionCaseFolding : uint8;
+class FCaseyProtocolBlob;
+
+/**
+ * Pattern categories checked by the Intersect Scanner and Fulcrum Filter.
+ * Declaration order is the order the stages evaluate them in.
+ */
+using EOrionPatternCategory = OrionCore::EPatternCategory;
+
+/**
+ * Compiled multi-pattern matcher (Aho-Corasick)
+ * "I flashed on every pattern at once."
+ *
+ * Built once from the Casey Protocol pattern lists, then shared read-only by every
+ * validation. A single pass over the text finds matches for all categories, so cost
+ * no longer grows with the number of patterns. Case is folded per character while
+ * scanning, so the text is never copied or lowered up front.
+ *
+ * The automaton, its prefilter and the fuzzy seeds live in OrionCore::FPatternMatcher,
+ * which the Python extension uses as well; this class wraps it for engine strings, the
+ * Casey Protocol configuration and mapped blobs. The tables are either compiled in
+ * process or mapped unchanged from a precompiled Casey Protocol blob.
+ */
+class ORIONAI_API FOrionPatternMatcher
+{
+public:
+    // Longest pattern (after normalization) that can match fuzzily, and the most edits allowed
+    static constexpr int32 MaxFuzzyLength = OrionCore::FPatternMatcher::MaxFuzzyLength;
+    static constexpr int32 MaxFuzzyEditDistance = OrionCore::FPatternMatcher::MaxFuzzyEditDistance;
+
+    /** How Compile() matches text against the patterns */
+    struct FOptions
+    {
+        EOrionCaseFolding CaseFolding{};
+
+        // Match text skeletons instead of the text itself
+        bool bNormalize = false;
+
+        // Also match within this many edits, 0 to MaxFuzzyEditDistance
+        int32 MaxEditDistance = 0;
+
+        // Patterns shorter than this only match exactly
+        int32 MinFuzzyLength = 12;
+    };
+
+    /** Matches found by one scan - the first pattern (in config order) hit per category */
+    using FScanResult = OrionCore::FScanResult;
+
+    /** Seeds a ranged scan couldn't check in full yet, for VerifyPending once the text has grown */
+    using FPendingSeeds = OrionCore::FPendingSeeds;
+
+    /**
+     * Flat tables behind a compiled matcher
+     * Plain arrays with no pointers between them, so they can be written to disk as-is
+     * and used straight out of a mapped Casey Protocol blob. Mirrors OrionCore::FMatcherTables
+     * over engine array views.
+     */
+    struct FTables
+    {
+        int32 NumClasses = 1;
+        int32 NumStates = 0;
+        bool bUnicodeFolding = false;
+
+        // FOptions the tables were compiled with
+        bool bNormalized = false;
+        int32 MaxEditDistance = 0;
+        int32 MinFuzzyLength = 0;
+
+        // Normalized matchers only: the class of dropped characters, which every state loops
+        // on, and of separators, which states reached by one loop on. INDEX_NONE if unused.
+        int32 SkipClass = INDEX_NONE;
+        int32 SpaceClass = INDEX_NONE;
+
+        // Alphabet compression: every character that appears in a pattern gets a class,
+        // everything else shares class 0. FoldedAsciiClasses maps A-Z to the lower-case class.
+        TConstArrayView<uint16> AsciiClasses;           // 128 entries
+        TConstArrayView<uint16> FoldedAsciiClasses;     // 128 entries
+        TConstArrayView<TCHAR> WideChars;               // Sorted, for binary search
+        TConstArrayView<int32> WideCharClasses;
+
+        // Dense DFA: Transitions[State * NumClasses + Class]
+        TConstArrayView<int32> Transitions;
+
+        // Patterns ending at each state (own outputs only) and the nearest
+        // failure-chain state that has outputs of its own
+        TConstArrayView<int32> OutputOffsets;           // NumStates + 1 entries
+        TConstArrayView<int32> OutputPatterns;
+        TConstArrayView<int32> DictionaryLinks;
+
+        // Per pattern id: category, index within the category, and where its
+        // null-terminated original text starts in PatternText
+        TConstArrayView<uint8> PatternCategories;
+        TConstArrayView<int32> PatternCategoryIndices;
+        TConstArrayView<int32> PatternTextOffsets;
+        TConstArrayView<TCHAR> PatternText;
+
+        // Pattern ids of each category, in config order
+        TConstArrayView<int32> CategoryOffsets;         // Count + 1 entries
+        TConstArrayView<int32> CategoryPatterns;
+
+        // Fuzzy matching: output ids from NumPatterns up are seeds. Per seed, the pattern it
+        // was cut from and where in that pattern's classes it ends; per pattern, its
+        // (normalized) text as character classes, empty for exact-only patterns.
+        TConstArrayView<int32> SeedPatterns;
+        TConstArrayView<int32> SeedEnds;
+        TConstArrayView<int32> FuzzyOffsets;            // NumPatterns + 1 entries, or none
+        TConstArrayView<uint16> FuzzyClasses;
+
+        /** Check that the table sizes agree and every index a scan follows is in bounds (see OrionCore::FMatcherTables) */
+        bool IsConsistent() const;
+    };
+
+    FOrionPatternMatcher() = default;
+    FOrionPatternMatcher(const FOrionPatternMatcher&) = delete;
+    FOrionPatternMatcher& operator=(const FOrionPatternMatcher&) = delete;
+
+    /** Build and compile a matcher from the scanner/filter configuration, including its matching options */
+    static TSharedRef<const FOrionPatternMatcher, ESPMode::ThreadSafe> Build(
+        const FIntersectScannerConfig& IntersectConfig,
+        const FFulcrumFilterConfig& FulcrumConfig);
+
+    /**
+     * Compile a matcher for some of another matcher's categories, with the same options
+     * Patterns keep their index within their category, so rule IDs found by either
+     * matcher agree and Source can still describe them.
+     * @param CategoryMask - Bit (1 << Category) per EOrionPatternCategory to keep
+     */
+    static TSharedRef<const FOrionPatternMatcher, ESPMode::ThreadSafe> BuildSubset(
+        const FOrionPatternMatcher& Source,
+        uint32 CategoryMask);
+
+    /**
+     * Wrap tables that live in someone else's memory, without copying them
+     * @param Backing - Keeps that memory alive for as long as the matcher is in use
+     * @return nullptr if the tables are inconsistent
+     */
+    static TSharedPtr<const FOrionPatternMatcher, ESPMode::ThreadSafe> FromTables(
+        const FTables& InTables,
+        TSharedRef<const FCaseyProtocolBlob, ESPMode::ThreadSafe> Backing);
+
+    /** Register a pattern; its index is its position within the category */
+    void AddPattern(EOrionPatternCategory Category, const FString& Pattern);
+
+    /** Build the automaton. Must be called after the last AddPattern. */
+    void Compile(const FOptions& Options);
+
+    /**
+     * Scan text in a single pass, folding case as it goes
+     * @param Text - Text in any case
+     * @param OutResult - Receives the first pattern hit per category
+     */
+    void Scan(FStringView Text, FScanResult& OutResult) const;
+
+    /**
+     * Continue a scan over the next piece of a text that arrives in chunks
+     * Exact matches that straddle chunk boundaries are found as if the text were whole.
+     * Fuzzy matches are not: their check only sees this chunk, so one that straddles a
+     * boundary is missed. Scan the whole text so far with ScanRange and VerifyPending
+     * when the matcher has fuzzy patterns.
+     * @param Text - Next chunk, in any case
+     * @param State - Value returned for the previous chunk, or 0 for the first
+     * @param InOutResult - Accumulates matches across chunks; Reset() it before the first
+     * @return State to pass in with the next chunk
+     */
+    int32 ScanChunk(FStringView Text, int32 State, FScanResult& InOutResult) const;
+
+    /**
+     * ScanChunk over Text[Start, End), with the rest of Text as context
+     * Fuzzy matches are checked against the text around their seed, including what lies
+     * outside the range; exact matching only ever reads the range.
+     * @param OutPending - If set, receives seeds whose check ran into the end of Text
+     */
+    int32 ScanRange(FStringView Text, int32 Start, int32 End, int32 State, FScanResult& InOutResult, FPendingSeeds* OutPending = nullptr) const;
+
+    /**
+     * Check pending seeds again now that Text has grown past where they were found
+     * Seeds that settle are removed; those still cut short by the end of Text stay. Together
+     * with ScanRange over each new chunk this finds what Scan() over the whole text would.
+     */
+    void VerifyPending(FStringView Text, FPendingSeeds& InOutPending, FScanResult& InOutResult) const;
+
+    /**
+     * Find the first pattern occurrence in text
+     * Same automaton as Scan(), but stops at the first hit.
+     * @param Text - Text in any case
+     * @param OutCategory - Category of the pattern that ended first in the text
+     * @return true if any pattern matched
+     */
+    bool ScanFirst(FStringView Text, EOrionPatternCategory& OutCategory) const;
+
+    /** Original (un-lowered) pattern text, as written in the Casey Protocol */
+    const TCHAR* GetPattern(EOrionPatternCategory Category, int32 Index) const;
+
+    const FTables& GetTables() const { return Tables; }
+
+    int32 GetNumPatterns() const { return Core.GetNumPatterns(); }
+
+    /** Patterns in one category of a compiled matcher */
+    int32 GetNumPatterns(EOrionPatternCategory Category) const { return Core.GetNumPatterns(Category); }
+
+    int32 GetNumStates() const { return Core.GetNumStates(); }
+
+    /** Patterns that can also match within MaxEditDistance edits */
+    int32 GetNumFuzzyPatterns() const { return Core.GetNumFuzzyPatterns(); }
+
+    /** The engine-independent matcher underneath, e.g. to batch-scan core text views */
+    const OrionCore::FPatternMatcher& GetCore() const { return Core; }
+
+private:
+    /** Point Tables at the core matcher's tables, once it is compiled */
+    void MirrorCoreTables();
+
+    OrionCore::FPatternMatcher Core;
+
+    // Engine views of Core's tables, which live in Core or in Backing
+    FTables Tables;
+
+    // Mapped Casey Protocol blob the tables point into, if any
+    TSharedPtr<const FCaseyProtocolBlob, ESPMode::ThreadSafe> Backing;
+};
@@ -0,0 +1,36 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "OrionCorePrefilter.h"
+
+/** Instruction sets the prefilters can run on */
+using EOrionSimdLevel = OrionCore::ESimdLevel;
+
+/**
+ * Vectorized prefilters for the clean path
+ * "Most days, nothing happens at the Buy More."
+ *
+ * The kernels live in OrionCore::Prefilter, shared with the Python extension; this is the
+ * engine-facing front end, which also reports levels the CPU can't run.
+ */
+namespace OrionPrefilter
+{
+    /** Fastest level this CPU supports */
+    ORIONAI_API EOrionSimdLevel GetSupportedLevel();
+
+    /** Level every prefilter currently runs at */
+    ORIONAI_API EOrionSimdLevel GetActiveLevel();
+
+    /**
+     * Override the level; levels the CPU doesn't support fall back to GetSupportedLevel()
+     * @param Level - Scalar turns prefiltering off entirely
+     */
+    ORIONAI_API void SetActiveLevel(EOrionSimdLevel Level);
+
+    ORIONAI_API const TCHAR* LexToString(EOrionSimdLevel Level);
+
+    /**
+     * Find the next character any Charles Carmichael rule needs - '@' or an ASCII digit
+     * @return Index of the first such character at or after Start, or Text.Len()
+     */
+    ORIONAI_API int32 FindPiiCandidate(FStringView Text, int32 Start);
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/MemStack.h"
+#include "OrionAI.h"
+#include <type_traits>
+
+/**
+ * Bump allocator behind FOrionValidationReportView
+ * "It's a small bag, Chuck. Pack light."
+ *
+ * Pages come from the engine's FMemStack page pool and go back to it on Reset(), so an
+ * arena reset between requests (or batches) recycles pages instead of hitting the heap.
+ * Not thread-safe; use one per thread or batch.
+ */
+class ORIONAI_API FOrionReportArena
+{
+public:
+    FOrionReportArena()
+    {
+        Mark.Emplace(Stack);
+    }
+
+    FOrionReportArena(const FOrionReportArena&) = delete;
+    FOrionReportArena& operator=(const FOrionReportArena&) = delete;
+
+    /** Release everything allocated so far; every view built from this arena dangles afterwards */
+    void Reset()
+    {
+        Mark.Reset();
+        Mark.Emplace(Stack);
+    }
+
+    /** Uninitialized storage for Num trivially destructible Ts */
+    template <typename T>
+    T* AllocArray(int32 Num)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena memory is released without running destructors");
+        return Num > 0 ? (T*)Stack.PushBytes(Num * sizeof(T), alignof(T)) : nullptr;
+    }
+
+    /** Copy of Text that lives as long as the arena */
+    FStringView CopyString(FStringView Text)
+    {
+        TCHAR* Copy = AllocArray<TCHAR>(Text.Len());
+        if (Copy)
+        {
+            FMemory::Memcpy(Copy, Text.GetData(), Text.Len() * sizeof(TCHAR));
+        }
+        return FStringView(Copy, Text.Len());
+    }
+
+    /** Bytes handed out since construction or the last Reset() */
+    int64 GetBytesUsed() const
+    {
+        return Stack.GetByteCount();
+    }
+
+private:
+    FMemStackBase Stack;
+    TOptional<FMemMark> Mark;
+};
+
+/**
+ * FOrionValidationReport for C++ callers that don't need a USTRUCT
+ * Text fields view the caller's AISystem, Decision and Context strings, which must
+ * outlive the view. SanitizedDecision views the decision too, unless Charles Carmichael
+ * changed it - only then is the sanitized text copied, into the arena. TriggeredRules
+ * live in the arena. A plain approval therefore costs no heap allocation at all.
+ */
+struct ORIONAI_API FOrionValidationReportView
+{
+    EOrionValidationResult Result = EOrionValidationResult::Approved;
+
+    FStringView AISystem;
+    FStringView OriginalDecision;
+    FStringView SanitizedDecision;
+    FStringView Context;
+
+    TConstArrayView<FOrionRuleId> TriggeredRules;
+
+    // Casey Protocol version whose pattern lists the pattern rule IDs index into
+    int64 ProtocolVersion = 0;
+
+    float SuspicionScore = 0.0f;
+    float ConfidenceScore = 1.0f;  // Ring Intel confidence
+
+    FDateTime Timestamp;
+
+    bool bCheapChecksOnly = false;
+    bool bShed = false;
+
+    /** True when SanitizedDecision is Charles Carmichael's rewrite rather than the decision itself */
+    bool WasSanitized() const
+    {
+        return SanitizedDecision.GetData() != OriginalDecision.GetData();
+    }
+
+    /** Deep copy for Blueprint callers and anything that outlives the arena */
+    FOrionValidationReport ToReport() const;
+
+    /** View of an evaluated report; its text fields are ignored in favour of the given strings */
+    static FOrionValidationReportView Make(FOrionReportArena& Arena, FStringView AISystem, FStringView Decision, FStringView Context,
+        const FOrionValidationReport& Report);
+};
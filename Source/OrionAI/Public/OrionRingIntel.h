@@ -0,0 +1,152 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "OrionCancellation.h"
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+struct FRingIntelConfig;
+namespace UE::NNE { class IModelCPU; class IModelInstanceCPU; }
+
+/**
+ * WordPiece tokenizer for BERT-style (uncased) Ring Intel models
+ * Lower-cases the text, splits on whitespace and punctuation, then matches each word
+ * greedily against the vocabulary, longest piece first.
+ */
+class ORIONAI_API FRingIntelTokenizer
+{
+public:
+    /** Read a vocab.txt - one token per line, the line number is its id */
+    bool Load(const FString& VocabPath);
+
+    /**
+     * Encode text as [CLS] pieces... [SEP]
+     * @param MaxTokens - Total length including [CLS] and [SEP]; extra pieces are dropped
+     */
+    void Encode(FStringView Text, int32 MaxTokens, TArray<int64>& OutTokenIds) const;
+
+    int64 GetPadId() const { return PadId; }
+
+private:
+    /** Append the pieces of one lower-cased word, or [UNK] if it can't be covered */
+    void EncodeWord(FStringView Word, TArray<int64>& OutTokenIds) const;
+
+    TMap<FString, int64> Vocab;
+    int64 UnknownId = 0;
+    int64 ClassifyId = 0;
+    int64 SeparatorId = 0;
+    int64 PadId = 0;
+};
+
+/**
+ * Ring Intel - in-process ML inference
+ * "It's the Ring. They have tech we've never seen."
+ *
+ * One model instance, loaded once through NNE and shared by every validation thread.
+ * Callers tokenize on their own thread and queue the ids; a single inference thread
+ * groups whatever is queued into one padded batch (up to MaxBatchSize texts, waiting
+ * at most MaxBatchDelayMs after the first arrives) and runs it in one call, so
+ * concurrent validations share the cost of each forward pass.
+ *
+ * The model and batching settings are read once, at Start(). A reload can still turn
+ * Ring Intel on and off and move its confidence threshold.
+ */
+class ORIONAI_API FRingIntelBackend : public FRunnable
+{
+public:
+    static FRingIntelBackend& Get();
+
+    virtual ~FRingIntelBackend();
+
+    /**
+     * Load the tokenizer and model and start the inference thread
+     * @return false if either could not be loaded - Ring Intel then passes everything
+     */
+    bool Start(const FRingIntelConfig& Config);
+
+    /** Fail everything still queued and unload the model */
+    void Stop();
+
+    /**
+     * Score a text, sharing an inference call with other queued requests
+     * Blocks until the batch holding it has run.
+     * @param OutToxicity - Probability the text is toxic, 0-1
+     * @param Token - Stop waiting (and drop the request if it hasn't run yet) once cancelled
+     * @return false if the backend isn't running, the request was cancelled, or inference failed
+     */
+    bool Classify(FStringView Text, float& OutToxicity, const FOrionCancellationToken& Token = FOrionCancellationToken());
+
+    bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+    // FRunnable
+    virtual uint32 Run() override;
+
+private:
+    struct FRequest
+    {
+        FRequest();
+        ~FRequest();
+
+        TArray<int64> TokenIds;
+        double QueuedTime = 0.0;
+        float Toxicity = 0.0f;
+        bool bSucceeded = false;
+
+        // Set by a cancelled caller; the inference thread skips requests it hasn't started
+        std::atomic<bool> bAbandoned{ false };
+        FEvent* DoneEvent = nullptr;
+    };
+
+    using FRequestRef = TSharedRef<FRequest, ESPMode::ThreadSafe>;
+
+    /** Take up to MaxBatchSize requests, waiting out the batch delay once the first is in */
+    void CollectBatch(TArray<FRequestRef>& OutBatch);
+
+    /** Pad the batch, run the model once, and complete every request in it */
+    void RunBatch(TArray<FRequestRef>& Batch);
+
+    /** Turn one row of model output into a toxicity probability */
+    float ToToxicity(const float* RowLogits) const;
+
+    /** Complete every request still queued as failed */
+    void FailQueued();
+
+    TQueue<TSharedPtr<FRequest, ESPMode::ThreadSafe>, EQueueMode::Mpsc> Queue;
+    std::atomic<bool> bRunning{ false };
+    std::atomic<bool> bStopRequested{ false };
+
+    FRingIntelTokenizer Tokenizer;
+    int32 MaxSequenceLength = 256;
+    int32 MaxBatchSize = 16;
+    double MaxBatchDelaySeconds = 0.002;
+    bool bSoftmax = false;
+
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+
+    // What each model input expects, in the model's input order
+    enum class EInput : uint8
+    {
+        TokenIds,
+        AttentionMask,
+        TokenTypeIds
+    };
+
+    struct FInputBinding
+    {
+        EInput Kind = EInput::TokenIds;
+        bool bInt64 = true;
+        TArray<uint8> Buffer;
+    };
+
+    // Labels per row of the single output tensor
+    int32 NumLabels = 0;
+
+    // Inference thread only (and Start/Stop while it isn't running)
+    TSharedPtr<UE::NNE::IModelCPU> ModelCPU;
+    TSharedPtr<UE::NNE::IModelInstanceCPU> Model;
+    TArray<FInputBinding> Inputs;
+    TArray<float> Logits;
+};
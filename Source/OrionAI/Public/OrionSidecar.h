@@ -0,0 +1,130 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "OrionCancellation.h"
+#include <atomic>
+
+class FRunnableThread;
+struct FSidecarConfig;
+namespace OrionSidecar { struct FHeader; }
+
+/**
+ * Ring Intel through the host's OrionSidecar daemon - the client side
+ * "We have a guy on the inside, Chuck. One guy. For everybody."
+ *
+ * With sidecar mode on, a process never loads the model. Ring Intel requests go through
+ * a region of shared memory that the daemon creates: a fixed set of request slots, a
+ * lock-free ring of free slots and one of submitted ones. A caller takes a free slot,
+ * writes the decision text straight into it and queues its index. The daemon reads the
+ * text in place and writes the toxicity back into the same slot. Nothing but the text
+ * is copied, and no lock or kernel object is involved: waiting threads spin briefly,
+ * then poll in short sleeps.
+ *
+ * The region is mapped on first use, so the daemon can start after its clients. A
+ * client that can't reach it (no daemon, a stale heartbeat, no free slot, or no answer
+ * within RequestTimeoutMs) passes the decision without Ring Intel, as with no model.
+ */
+class ORIONAI_API FOrionSidecarClient
+{
+public:
+    static FOrionSidecarClient& Get();
+
+    ~FOrionSidecarClient();
+
+    /** Use the daemon serving Config.RegionName for Ring Intel from now on */
+    void Start(const FSidecarConfig& Config);
+
+    /** Stop sending requests; Classify() fails from now on */
+    void Stop();
+
+    bool IsStarted() const { return bStarted.load(std::memory_order_acquire); }
+
+    /** True while a daemon is serving - maps (or remaps, after a daemon restart) at most once a second */
+    bool IsServing();
+
+    /**
+     * Score a text on the daemon's model, batched with every other client's requests
+     * Same contract as FRingIntelBackend::Classify; text past the daemon's maxTextChars is cut off.
+     */
+    bool Classify(FStringView Text, float& OutToxicity, const FOrionCancellationToken& Token = FOrionCancellationToken());
+
+    /** Requests that got no answer: no free slot, timed out, cancelled or the daemon went away */
+    int64 GetFailedCount() const { return FailedCount.load(std::memory_order_relaxed); }
+
+private:
+    struct FMapping
+    {
+        FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+        OrionSidecar::FHeader* Header = nullptr;
+        uint32 Epoch = 0;
+    };
+
+    /** The current mapping while its daemon is alive, mapping afresh when it is due */
+    FMapping* GetLiveMapping();
+
+    FMapping* TryMap();
+
+    std::atomic<bool> bStarted{ false };
+    std::atomic<FMapping*> Current{ nullptr };
+    std::atomic<uint64> NextMapCycles{ 0 };
+    std::atomic<int64> FailedCount{ 0 };
+
+    FString RegionName;
+    uint64 TimeoutCycles = 0;
+
+    // Every mapping made, unmapped on destruction only; a daemon restart retires one while callers may still hold it
+    FCriticalSection MapLock;
+    TArray<TUniquePtr<FMapping>> Mappings;
+};
+
+/**
+ * The host's OrionSidecar daemon - the server side, run by the OrionSidecar commandlet
+ * "The Intersect is in one head. Everybody else calls Chuck."
+ *
+ * Creates the shared region and serves its requests from FRingIntelBackend, which must
+ * be running already. ServerThreads threads take requests from every client process and
+ * call Classify concurrently, so the backend's micro-batching groups requests across
+ * processes into one forward pass. The model's memory is paid once per host.
+ */
+class ORIONAI_API FOrionSidecarServer
+{
+public:
+    ~FOrionSidecarServer();
+
+    /**
+     * Create (or take over) the region and start serving
+     * @param DefaultThreads - Server threads when Config.ServerThreads is 0
+     * @return false if the region could not be created
+     */
+    bool Start(const FSidecarConfig& Config, int32 DefaultThreads);
+
+    /** Tell clients the daemon is gone and stop the server threads */
+    void Stop();
+
+    /** Show clients the daemon is alive; call at least every few hundred milliseconds */
+    void Heartbeat();
+
+    int64 GetServedCount() const { return ServedCount.load(std::memory_order_relaxed); }
+
+private:
+    class FServerThread : public FRunnable
+    {
+    public:
+        explicit FServerThread(FOrionSidecarServer& InServer) : Server(InServer) {}
+
+        // FRunnable
+        virtual uint32 Run() override;
+
+    private:
+        FOrionSidecarServer& Server;
+    };
+
+    FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+    OrionSidecar::FHeader* Header = nullptr;
+
+    std::atomic<bool> bStopRequested{ false };
+    std::atomic<int64> ServedCount{ 0 };
+
+    TArray<TUniquePtr<FServerThread>> Runnables;
+    TArray<FRunnableThread*> Threads;
+};
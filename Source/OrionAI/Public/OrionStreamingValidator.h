@@ -0,0 +1,104 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "OrionAI.h"
+#include "CaseyProtocol.h"
+
+/**
+ * Incremental validation for output that arrives token by token
+ * "Chuck, you don't have to wait for the whole flash."
+ *
+ * Feed() advances the Intersect/Fulcrum automaton from where the previous chunk left
+ * it, so each character is scanned once and patterns spanning chunks are still caught.
+ * The first chunk that completes any pattern rejects the stream, and Feed() returns
+ * false so the caller can cut generation there.
+ *
+ * PII is sanitized incrementally: Feed() hands back sanitized text up to the last
+ * whitespace no Charles Carmichael rule can match across (only credit card numbers
+ * contain spaces, and only between digits), holding back the rest until it is complete.
+ *
+ * Finish() runs Ring Intel and the quarantine threshold and commits the verdict exactly
+ * like MonitorAIDecision, so metrics, quarantine and Buy More Cover see one decision.
+ *
+ * No Casey Protocol read scope is held between calls, so an open stream never blocks a
+ * reload. If a reload lands mid-stream, the next call rescans the text received so far
+ * under the new snapshot.
+ *
+ * Not thread-safe; use one validator per stream.
+ */
+class ORIONAI_API FOrionStreamingValidator
+{
+public:
+    FOrionStreamingValidator() = default;
+
+    /** Finishes (and commits) a stream the owner never finished */
+    ~FOrionStreamingValidator();
+
+    FOrionStreamingValidator(const FOrionStreamingValidator&) = delete;
+    FOrionStreamingValidator& operator=(const FOrionStreamingValidator&) = delete;
+
+    /**
+     * Start a new stream, finishing any open one first
+     * @param AISystem - Name of the AI system producing the stream
+     * @param Context - Optional context, copied into the report
+     */
+    void Begin(const FString& AISystem, const FString& Context = FString());
+
+    /**
+     * Validate the next chunk of output
+     * @param Chunk - Newly generated text
+     * @param OutSanitized - Sanitized text that is now safe to display is appended here
+     *                       (nothing is appended once the stream has been rejected)
+     * @return false once the stream is rejected, or if OrionAI is unavailable - stop streaming
+     */
+    bool Feed(FStringView Chunk, FString& OutSanitized);
+
+    /**
+     * End the stream and commit its verdict
+     * @param OutSanitized - Receives the sanitized text still held back, if the stream passed
+     * @return Report for the text received (up to the cut, if the stream was rejected)
+     */
+    FOrionValidationReport Finish(FString& OutSanitized);
+    FOrionValidationReport Finish();
+
+    bool IsActive() const { return bActive; }
+    bool IsRejected() const { return RejectReason != EOrionQuickReason::None; }
+
+    /** Why the stream was rejected, or None - the highest-priority category that matched */
+    EOrionQuickReason GetRejectReason() const { return RejectReason; }
+
+private:
+    /** Advance the matcher over the last ChunkLen characters of Text, rescanning it all after a reload */
+    void Scan(const FCaseyProtocolSnapshot& Protocol, int32 ChunkLen);
+
+    /** Sanitize Text[SanitizedUpTo, End) and append it to the released output */
+    void ReleaseSanitized(const FCaseyProtocolSnapshot& Protocol, int32 End, FString& OutSanitized);
+
+    /** End of the longest prefix that can be sanitized without the rest of the stream */
+    int32 FindReleasableEnd() const;
+
+    void Reset();
+
+    FString AISystem;
+    FString Context;
+    FString Text;
+
+    // Looked up once per stream; states live for the whole process
+    FOrionSystemState* System = nullptr;
+
+    // Version of the snapshot MatcherState, Matches and PendingSeeds belong to
+    int64 ProtocolVersion = 0;
+    int32 MatcherState = 0;
+    FOrionPatternMatcher::FScanResult Matches;
+
+    // Fuzzy seeds near the end of Text whose check needs the chunks still to come
+    FOrionPatternMatcher::FPendingSeeds PendingSeeds;
+
+    // Text before SanitizedUpTo has been sanitized into SanitizedText and released
+    int32 SanitizedUpTo = 0;
+    FString SanitizedText;
+    FString Scratch;
+    bool bSanitizedAny = false;
+
+    EOrionQuickReason RejectReason = EOrionQuickReason::None;
+    bool bActive = false;
+};
@@ -0,0 +1,103 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "OrionMetrics.h"
+#include "OrionInstrumentation.h"
+#include <atomic>
+
+/**
+ * Validation state of one AI system
+ * Safe mode and the failure streak live on separate cache lines from the counters,
+ * so a system's approvals never dirty the line its safe-mode check reads.
+ */
+struct ORIONAI_API FOrionSystemState
+{
+    FOrionSystemState(FStringView InKey, uint32 InKeyHash)
+        : Name(InKey.Len(), InKey.GetData())
+        , Key(InKey)
+        , KeyHash(InKeyHash)
+    {
+    }
+
+    // Interned once, when the system is first seen - profile and admission policy lookups use it
+    const FName Name;
+
+    // The AISystem string as first seen; lookups compare against it, ignoring case as FName does
+    const FString Key;
+    const uint32 KeyHash;
+
+    // Buy More Cover for this system alone
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<bool> bSafeModeActive{ false };
+
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int32> ConsecutiveFailures{ 0 };
+
+    // Admission control's token bucket as one timestamp (in cycles): the bucket is full
+    // again at this time, so taking tokens is a single compare-exchange
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> NextAdmissionCycles{ 0 };
+
+    FOrionStripedCounters Counters;
+
+    // Decision latency, recorded while instrumentation.latencyHistograms is on
+    FOrionLatencyHistogram Latency;
+};
+
+/**
+ * Per-AISystem state, keyed by the caller's AISystem string
+ * "One bad asset doesn't burn the whole Buy More."
+ *
+ * An open-addressing table of pointers. Lookups are lock-free: hash the string, load
+ * the table, probe a few slots, compare the keys - no name pool involved. Slots only ever
+ * go from empty to filled, and states are never freed while the table lives, so a reader
+ * can never see a half-built entry or lose one. Only the first sighting of a system takes
+ * the write lock, which interns its FName and may grow the table - older tables stay
+ * alive until destruction for readers still probing them.
+ *
+ * AISystem strings come from callers, so the table stops at MaxSystems. Systems first
+ * seen after that share one overflow state (OverflowName): one failure streak, one safe
+ * mode and one set of metrics, under the default profile and admission policy.
+ */
+class ORIONAI_API FOrionSystemStateTable
+{
+public:
+    static constexpr int32 MaxSystems = 1024;
+    static constexpr const TCHAR* OverflowName = TEXT("(other AI systems)");
+
+    FOrionSystemStateTable();
+
+    FOrionSystemStateTable(const FOrionSystemStateTable&) = delete;
+    FOrionSystemStateTable& operator=(const FOrionSystemStateTable&) = delete;
+
+    /** State for AISystem, created on first use - or the overflow state once the table is full */
+    FOrionSystemState& FindOrAdd(FStringView AISystem);
+
+    /** @return nullptr if AISystem has no state of its own */
+    FOrionSystemState* Find(FStringView AISystem) const;
+
+    /** Visit every known system, in the order they were first seen */
+    void ForEach(TFunctionRef<void(FOrionSystemState&)> Visitor) const;
+
+private:
+    struct FSlots
+    {
+        explicit FSlots(int32 InCapacity);
+
+        const int32 Capacity;   // Power of two
+        TUniquePtr<std::atomic<FOrionSystemState*>[]> Slots;
+    };
+
+    /** Case-insensitive, to match FName's notion of the same system */
+    static uint32 HashKey(FStringView AISystem);
+
+    static FOrionSystemState* Probe(const FSlots& Table, FStringView AISystem, uint32 KeyHash);
+
+    // Write lock held
+    static void Insert(FSlots& Table, FOrionSystemState* State);
+
+    std::atomic<FSlots*> Current{ nullptr };
+
+    // Set once MaxSystems systems have their own state; owned by States
+    std::atomic<FOrionSystemState*> Overflow{ nullptr };
+
+    mutable FCriticalSection WriteLock;
+    TArray<TUniquePtr<FSlots>> Tables;
+    TArray<TUniquePtr<FOrionSystemState>> States;
+};
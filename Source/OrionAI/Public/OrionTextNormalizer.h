@@ -0,0 +1,24 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Text skeletons for obfuscation-resistant pattern matching
+ * "Same guy, Chuck. He just grew a mustache."
+ *
+ * FString front end for OrionCore::Normalizer, which documents the mapping. Kept so engine
+ * code can normalize text the same way FOrionPatternMatcher does.
+ */
+namespace OrionTextNormalizer
+{
+    /** What Normalize() returns for characters that are dropped altogether */
+    constexpr TCHAR Dropped = 0;
+
+    /** What Normalize() returns for whitespace and separating punctuation */
+    constexpr TCHAR Separator = TEXT(' ');
+
+    /** The skeleton character Char stands for, Separator, or Dropped */
+    ORIONAI_API TCHAR Normalize(TCHAR Char);
+
+    /** Skeleton of a whole string: separator runs collapse to one and both ends are trimmed */
+    ORIONAI_API FString NormalizeText(FStringView Text);
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "OrionAI.h"
+
+/**
+ * Verdict cache for repeated AI outputs
+ * "I've flashed on this one before."
+ *
+ * Remembers the evaluated report (before metrics, quarantine and alerts are applied)
+ * for each (Casey Protocol version, AI system, decision). Templated NPC lines and
+ * matchmaking messages then skip every scan after the first.
+ *
+ * Sharded by key, one lock per shard, CLOCK eviction within a shard. Each shard
+ * remembers the protocol version its entries were evaluated under and drops them all
+ * as soon as a newer version shows up, so a reload never serves an old verdict.
+ */
+class ORIONAI_API FOrionVerdictCache
+{
+public:
+    /** Set the memory cap and drop every entry */
+    void Configure(int32 MaxMemoryMB);
+
+    /** 64-bit key for one decision */
+    static uint64 MakeKey(int64 ProtocolVersion, FStringView AISystem, FStringView Decision);
+
+    /**
+     * Look up a verdict
+     * The cached system and decision are compared in full, so a hash collision is a
+     * miss, never a wrong verdict.
+     * @param OutReport - The cached verdict; the text fields are left for the caller to attach
+     * @return true on a hit
+     */
+    bool Find(uint64 Key, int64 ProtocolVersion, const FString& AISystem, const FString& Decision,
+        FOrionValidationReport& OutReport, bool& bOutCriticalBias);
+
+    /** Remember a verdict; ignored if it was evaluated under an outdated protocol version */
+    void Add(uint64 Key, int64 ProtocolVersion, const FString& AISystem, const FString& Decision,
+        const FOrionValidationReport& Report, bool bCriticalBias);
+
+    void Reset();
+
+    int32 Num() const;
+    int64 GetMemoryUsed() const;
+
+private:
+    struct FEntry
+    {
+        uint64 Key = 0;
+        FOrionValidationReport Report;
+        int64 Bytes = 0;
+        bool bCriticalBias = false;
+        bool bReferenced = false;       // CLOCK second-chance bit
+    };
+
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+    {
+        mutable FCriticalSection Lock;
+        TArray<FEntry> Entries;
+        TMap<uint64, int32> Index;
+        int64 ProtocolVersion = 0;
+        int64 Bytes = 0;
+        int32 Hand = 0;
+    };
+
+    static constexpr int32 NumShards = 16;
+    static_assert(NumShards == 16, "GetShard picks shards from the top 4 bits of the key");
+
+    FShard& GetShard(uint64 Key)
+    {
+        return Shards[Key >> 60];
+    }
+
+    /** Drop the shard's entries if they predate ProtocolVersion; false if ProtocolVersion is the outdated one */
+    static bool SyncVersion(FShard& Shard, int64 ProtocolVersion);
+
+    static void ResetShard(FShard& Shard);
+    static void RemoveAt(FShard& Shard, int32 EntryIndex);
+
+    FShard Shards[NumShards];
+    int64 ShardBudgetBytes = 0;
+};
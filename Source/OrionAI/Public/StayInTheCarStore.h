@@ -0,0 +1,110 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "OrionAI.h"
+
+struct FStayInTheCarConfig;
+struct FCaseyProtocolSnapshot;
+
+/** Filter for FStayInTheCarStore::Query - default-constructed matches everything */
+struct ORIONAI_API FStayInTheCarQuery
+{
+    FName AISystem = NAME_None;
+    FDateTime From = FDateTime::MinValue();
+    FDateTime To = FDateTime::MaxValue();
+    float MinSuspicionScore = -MAX_flt;
+    float MaxSuspicionScore = MAX_flt;
+};
+
+/** Read-only view of one stored report; only valid inside the query visitor */
+struct ORIONAI_API FStayInTheCarRecordView
+{
+    FName AISystem;
+    FDateTime Timestamp;
+    EOrionValidationResult Result = EOrionValidationResult::Quarantined;
+    float SuspicionScore = 0.0f;
+    float ConfidenceScore = 1.0f;
+    TConstArrayView<uint16> RuleIds;
+    FStringView OriginalDecision;
+    FStringView SanitizedDecision;
+};
+
+/**
+ * Stay In The Car - bounded quarantine storage
+ * "Chuck, stay in the car." Storage that never grows past its spot in the lot.
+ *
+ * Fixed-capacity ring of compact records. Decision text lives in a fixed-size ring arena
+ * and triggered rules are interned to small IDs. When either ring is full, the oldest
+ * records are appended to a compact binary spill file (through FOrionLogWriter) and
+ * evicted, so memory use never depends on uptime.
+ */
+class ORIONAI_API FStayInTheCarStore
+{
+public:
+    FStayInTheCarStore();
+
+    /** Size the rings and set the spill file; drops anything currently stored */
+    void Configure(const FStayInTheCarConfig& Config);
+
+    /**
+     * Store a quarantined report, spilling the oldest entries if needed
+     * @param Protocol - Names rules seen for the first time; the snapshot the caller is reading
+     */
+    void Add(const FCaseyProtocolSnapshot& Protocol, const FOrionValidationReport& Report);
+
+    /**
+     * Visit stored reports matching the filter, oldest first, without copying them
+     * The store is locked while visiting - do not quarantine from inside the visitor.
+     * @param Visitor - Return false to stop early
+     * @return Number of records visited
+     */
+    int32 Query(const FStayInTheCarQuery& Filter, TFunctionRef<bool(const FStayInTheCarRecordView&)> Visitor) const;
+
+    /** Text of an interned rule ID */
+    FString GetRuleName(uint16 RuleId) const;
+
+    int32 Num() const;
+    int64 GetSpilledCount() const;
+
+private:
+    static constexpr int32 MaxRulesPerRecord = 4;
+
+    struct FRecord
+    {
+        int64 TimestampTicks = 0;
+        FName AISystem;
+        float SuspicionScore = 0.0f;
+        float ConfidenceScore = 1.0f;
+        EOrionValidationResult Result = EOrionValidationResult::Quarantined;
+        uint8 NumRules = 0;
+        uint16 RuleIds[MaxRulesPerRecord] = {};
+        uint64 TextStart = 0;       // Monotonic arena position
+        int32 OriginalLen = 0;
+        int32 SanitizedLen = 0;      // 0 when identical to the original
+    };
+
+    uint16 InternRule(const FCaseyProtocolSnapshot& Protocol, const FOrionRuleId& Rule, int64 ProtocolVersion);
+    bool AllocateText(int32 Len, uint64& OutStart);
+    const TCHAR* GetText(uint64 Start) const { return &Arena[Start % (uint64)Arena.Num()]; }
+    void EvictOldest();
+    void SpillRecord(const FRecord& Record);
+
+    mutable FCriticalSection Lock;
+
+    // Record ring
+    TArray<FRecord> Records;
+    int32 OldestRecord = 0;
+    int32 NumRecords = 0;
+
+    // Text arena ring, addressed by monotonic positions [ArenaTail, ArenaHead)
+    TArray<TCHAR> Arena;
+    uint64 ArenaHead = 0;
+    uint64 ArenaTail = 0;
+
+    // Names of the triggered rules seen so far, keyed by rule ID (and protocol version, for patterns)
+    TArray<FString> RuleNames;
+    TMap<uint64, uint16> RuleIndex;
+    TArray<bool> RuleSpilled;
+
+    FString SpillFilePath;
+    int64 SpilledCount = 0;
+};
@@ -0,0 +1,24 @@
+// OrionAIBenchmarks.Build.cs
+// Developer-only benchmark module - never packaged into shipping builds
+
+using UnrealBuildTool;
+
+public class OrionAIBenchmarks : ModuleRules
+{
+    public OrionAIBenchmarks(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+        
+        PrivateDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core",
+                "CoreUObject",
+                "Engine",
+                "Json",
+                "Projects",     // Locating the plugin's own Config directory
+                "OrionAI"
+            }
+        );
+    }
+}
@@ -0,0 +1,6 @@
+// OrionAI - Benchmark module
+// Hosts the OrionAI.Perf and OrionAI.Functional automation tests; no runtime code
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, OrionAIBenchmarks)
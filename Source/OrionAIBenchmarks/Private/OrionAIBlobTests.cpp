@@ -0,0 +1,238 @@
+// OrionAI - Casey Protocol blob tests
+// Tampered blobs must be refused, and the JSON parsed in their place
+
+#include "OrionBenchmarkHarness.h"
+#include "OrionAI.h"
+#include "OrionPatternMatcher.h"
+#include "CaseyProtocol.h"
+#include "CaseyProtocolBlob.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace OrionBlobTests
+{
+	/** Ways a blob's tables can be broken while its header, sizes and CRC stay valid */
+	enum class ETamper
+	{
+		TransitionOutOfRange,
+		DictionaryLinkLoop,
+		WideCharsUnsorted,
+
+		Count
+	};
+
+	static const TCHAR* GetTamperName(ETamper How)
+	{
+		switch (How)
+		{
+		case ETamper::TransitionOutOfRange: return TEXT("transition past the last state");
+		case ETamper::DictionaryLinkLoop:   return TEXT("dictionary links that loop");
+		case ETamper::WideCharsUnsorted:    return TEXT("wide characters out of order");
+		default:                            return TEXT("?");
+		}
+	}
+
+	/** Copy of a matcher's tables with one of them broken; owns the arrays it changed */
+	struct FTamperedTables
+	{
+		FOrionPatternMatcher::FTables Tables;
+		TArray<int32> Transitions;
+		TArray<int32> DictionaryLinks;
+		TArray<TCHAR> WideChars;
+	};
+
+	/** @return false if Source is too small to break that way */
+	static bool Tamper(const FOrionPatternMatcher::FTables& Source, ETamper How, FTamperedTables& Out)
+	{
+		Out.Tables = Source;
+		switch (How)
+		{
+		case ETamper::TransitionOutOfRange:
+			if (Source.Transitions.Num() == 0)
+			{
+				return false;
+			}
+			Out.Transitions.Append(Source.Transitions.GetData(), Source.Transitions.Num());
+			Out.Transitions[0] = Source.NumStates;
+			Out.Tables.Transitions = Out.Transitions;
+			return true;
+
+		case ETamper::DictionaryLinkLoop:
+			if (Source.NumStates < 3)
+			{
+				return false;
+			}
+			Out.DictionaryLinks.Append(Source.DictionaryLinks.GetData(), Source.DictionaryLinks.Num());
+			Out.DictionaryLinks[1] = 2;
+			Out.DictionaryLinks[2] = 1;
+			Out.Tables.DictionaryLinks = Out.DictionaryLinks;
+			return true;
+
+		case ETamper::WideCharsUnsorted:
+			if (Source.WideChars.Num() < 2)
+			{
+				return false;
+			}
+			Out.WideChars.Append(Source.WideChars.GetData(), Source.WideChars.Num());
+			Out.WideChars.Swap(0, 1);
+			Out.Tables.WideChars = Out.WideChars;
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+	/** Small matcher with wide characters, so every tamper has something to break */
+	static void BuildMatcher(FOrionPatternMatcher& Matcher)
+	{
+		Matcher.AddPattern(EOrionPatternCategory::PromptInjection, TEXT("ignore all previous instructions"));
+		Matcher.AddPattern(EOrionPatternCategory::Toxicity, TEXT("caf\u00E9 r\u00FCde"));
+		Matcher.Compile(FOrionPatternMatcher::FOptions());
+	}
+
+	/** Blob-mapped snapshots leave the pattern lists empty; parsed ones keep them */
+	static bool IsParsedFromJson()
+	{
+		FCaseyProtocolReadScope Protocol;
+		return Protocol->FulcrumFilter.PromptInjectionPatterns.Num() > 0 || Protocol->IntersectScanner.ToxicityPatterns.Num() > 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrionBlobInconsistentTablesTest,
+	"OrionAI.Functional.Blob.InconsistentTables",
+	EAutomationTestFlags::ApplicationContextMask |
+	EAutomationTestFlags::ProductFilter
+)
+
+bool FOrionBlobInconsistentTablesTest::RunTest(const FString& Parameters)
+{
+	using namespace OrionBlobTests;
+
+	FOrionPatternMatcher Matcher;
+	BuildMatcher(Matcher);
+	const FOrionPatternMatcher::FTables& Tables = Matcher.GetTables();
+
+	const TSharedRef<const FCaseyProtocolBlob, ESPMode::ThreadSafe> Backing = MakeShared<FCaseyProtocolBlob, ESPMode::ThreadSafe>();
+	if (!TestTrue(TEXT("Untampered tables are accepted"), Tables.IsConsistent() && FOrionPatternMatcher::FromTables(Tables, Backing).IsValid()))
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < (int32)ETamper::Count; Index++)
+	{
+		const ETamper How = (ETamper)Index;
+		FTamperedTables Tampered;
+		if (!TestTrue(FString::Printf(TEXT("Test matcher can be given %s"), GetTamperName(How)), Tamper(Tables, How, Tampered)))
+		{
+			continue;
+		}
+		TestFalse(FString::Printf(TEXT("Tables with %s are inconsistent"), GetTamperName(How)), Tampered.Tables.IsConsistent());
+		TestFalse(FString::Printf(TEXT("Tables with %s are not wrapped"), GetTamperName(How)), FOrionPatternMatcher::FromTables(Tampered.Tables, Backing).IsValid());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrionBlobFallsBackToJsonTest,
+	"OrionAI.Functional.Blob.FallsBackToJson",
+	EAutomationTestFlags::ApplicationContextMask |
+	EAutomationTestFlags::ProductFilter
+)
+
+bool FOrionBlobFallsBackToJsonTest::RunTest(const FString& Parameters)
+{
+	using namespace OrionBlobTests;
+
+	if (!UOrionAI::InitializeOrion(OrionBench::GetPluginConfigPath()))
+	{
+		AddError(TEXT("Could not initialize OrionAI from the plugin's Casey Protocol"));
+		return false;
+	}
+
+	// Every refused blob logs why
+	AddExpectedError(TEXT("Casey Protocol: Blob"), EAutomationExpectedErrorFlags::Contains, 0);
+
+	OrionBench::FScopedConfigRestore RestoreConfig;
+	const FString ConfigPath = OrionBench::WriteTestConfig(TEXT("BlobFallback"), [](FJsonObject&) {});
+	TArray<uint8> JsonBytes;
+	if (!TestFalse(TEXT("Test config written"), ConfigPath.IsEmpty()) || !FFileHelper::LoadFileToArray(JsonBytes, *ConfigPath))
+	{
+		return false;
+	}
+	const FString BlobPath = FCaseyProtocolBlob::GetBlobPath(ConfigPath);
+	const FSHAHash SourceHash = FCaseyProtocolBlob::HashSource(JsonBytes);
+
+	// The tampered tables ride in an otherwise well-formed blob; the untampered ones must map
+	FOrionPatternMatcher Matcher;
+	BuildMatcher(Matcher);
+	FCaseyProtocolSnapshot Configs;
+	if (!TestTrue(TEXT("Blob with the test matcher written"), FCaseyProtocolBlob::Write(Configs, Matcher.GetTables(), SourceHash, BlobPath))
+		|| !TestTrue(TEXT("Blob with the test matcher maps"), FCaseyProtocolBlob::Load(BlobPath, SourceHash).IsValid()))
+	{
+		return false;
+	}
+
+	TArray<uint8> IntactBytes;
+	if (!TestTrue(TEXT("Intact blob read back"), FFileHelper::LoadFileToArray(IntactBytes, *BlobPath) && IntactBytes.Num() >= (int32)(2 * sizeof(uint32))))
+	{
+		return false;
+	}
+
+	auto ExpectJsonFallback = [this, &ConfigPath, &BlobPath, &SourceHash](const FString& What)
+	{
+		TestFalse(FString::Printf(TEXT("Blob with %s is refused"), *What), FCaseyProtocolBlob::Load(BlobPath, SourceHash).IsValid());
+		TestTrue(FString::Printf(TEXT("Reload with %s succeeds"), *What), UCaseyProtocol::ReloadFromFile(ConfigPath));
+		TestTrue(FString::Printf(TEXT("Reload with %s parses the JSON"), *What), IsParsedFromJson());
+	};
+
+	for (int32 Index = 0; Index < (int32)ETamper::Count; Index++)
+	{
+		const ETamper How = (ETamper)Index;
+		FTamperedTables Tampered;
+		if (Tamper(Matcher.GetTables(), How, Tampered) && FCaseyProtocolBlob::Write(Configs, Tampered.Tables, SourceHash, BlobPath))
+		{
+			ExpectJsonFallback(GetTamperName(How));
+		}
+		else
+		{
+			AddError(FString::Printf(TEXT("Could not write a blob with %s"), GetTamperName(How)));
+		}
+	}
+
+	// Format version is the second field of the header, right after the magic
+	TArray<uint8> OtherVersion = IntactBytes;
+	uint32 Header[2];
+	FMemory::Memcpy(Header, OtherVersion.GetData(), sizeof(Header));
+	if (TestTrue(TEXT("Blob starts with the magic"), Header[0] == FCaseyProtocolBlob::Magic))
+	{
+		Header[1] = FCaseyProtocolBlob::FormatVersion + 1;
+		FMemory::Memcpy(OtherVersion.GetData(), Header, sizeof(Header));
+		if (TestTrue(TEXT("Blob with another format version written"), FFileHelper::SaveArrayToFile(OtherVersion, *BlobPath)))
+		{
+			ExpectJsonFallback(TEXT("another format version"));
+		}
+	}
+
+	// Compiled from JSON that has changed since
+	const uint8 OtherJson[] = { '{', '}' };
+	if (TestTrue(TEXT("Stale blob written"), FCaseyProtocolBlob::Write(Configs, Matcher.GetTables(), FCaseyProtocolBlob::HashSource(OtherJson), BlobPath)))
+	{
+		ExpectJsonFallback(TEXT("a stale source hash"));
+	}
+
+	// A blob compiled from the copy itself is mapped again once it is intact
+	if (TestTrue(TEXT("Blob compiled from the test config"), UCaseyProtocol::CompileToBlob(ConfigPath, BlobPath)))
+	{
+		TestTrue(TEXT("Reload with a good blob succeeds"), UCaseyProtocol::ReloadFromFile(ConfigPath));
+		TestFalse(TEXT("Reload with a good blob maps it"), IsParsedFromJson());
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,360 @@
+// OrionAI - Automation perf tests
+// Sweeps input length, pattern count and PII density across the validation pipeline
+
+#include "OrionBenchmarkHarness.h"
+#include "OrionAI.h"
+#include "OrionReportView.h"
+#include "OrionPatternMatcher.h"
+#include "OrionPrefilter.h"
+#include "CharlesCarmichael.h"
+#include "OrionRingIntel.h"
+#include "CaseyProtocol.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace OrionBench
+{
+	static const int32 InputLengths[] = { 100, 1000, 5000, 20000 };
+	static const int32 PiiDensities[] = { 0, 2, 16 };
+	static const int32 PatternCounts[] = { 16, 128, 1024, 8192 };
+	static const int32 PrefilterInputLengths[] = { 100, 250, 500, 1000, 2500, 5000 };
+	static const int32 RingIntelInputLengths[] = { 100, 500, 1000 };
+	static const int32 RingIntelConcurrency[] = { 1, 4, 16 };
+
+	/** Initialize OrionAI from the plugin's own Casey Protocol if the project hasn't already */
+	static bool EnsureOrionInitialized(FAutomationTestBase& Test)
+	{
+		if (UOrionAI::IsInSafeMode())
+		{
+			Test.AddError(TEXT("OrionAI is in safe mode - the pipeline numbers would only measure the Buy More Cover short-circuit"));
+			return false;
+		}
+
+		const FString ConfigPath = GetPluginConfigPath();
+		if (!UOrionAI::InitializeOrion(ConfigPath))
+		{
+			Test.AddError(FString::Printf(TEXT("Could not initialize OrionAI from %s"), *ConfigPath));
+			return false;
+		}
+		return true;
+	}
+
+	static void ReportResult(FAutomationTestBase& Test, const FBenchmarkResult& Result)
+	{
+		Test.AddInfo(FString::Printf(TEXT("%-60s p50 %10.0f ns  p99 %10.0f ns  %10.0f/s  %6.1f allocs  %8.0f B"),
+			*Result.GetId(), Result.P50Ns, Result.P99Ns, Result.ThroughputPerSec, Result.AllocsPerCall, Result.BytesPerCall));
+	}
+
+	static void WriteResults(FAutomationTestBase& Test, const FBenchmarkRunner& Runner)
+	{
+		const FString OutputPath = Runner.WriteJson();
+		if (OutputPath.IsEmpty())
+		{
+			Test.AddError(TEXT("Failed to write benchmark results"));
+		}
+		else
+		{
+			Test.AddInfo(FString::Printf(TEXT("Benchmark results written to %s"), *OutputPath));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrionPerfPipelineTest,
+	"OrionAI.Perf.Pipeline",
+	EAutomationTestFlags::ApplicationContextMask |
+	EAutomationTestFlags::PerfFilter
+)
+
+bool FOrionPerfPipelineTest::RunTest(const FString& Parameters)
+{
+	using namespace OrionBench;
+
+	if (!EnsureOrionInitialized(*this))
+	{
+		return false;
+	}
+
+	FBenchmarkRunner Runner(TEXT("Pipeline"));
+
+	const FString AISystem = TEXT("Benchmark");
+	const FString ProfiledAISystem = TEXT("NPCDialogue");  // The shipped Casey Protocol's example profile
+	FOrionReportArena Arena;
+
+	for (int32 InputLength : InputLengths)
+	{
+		for (int32 PiiPerKB : PiiDensities)
+		{
+			const FString Text = MakeCorpusText(InputLength, PiiPerKB);
+			TArray<FBenchmarkParam> Params = { { TEXT("inputLength"), InputLength }, { TEXT("piiPerKB"), PiiPerKB } };
+
+			ReportResult(*this, Runner.Run(TEXT("MonitorAIDecision"), Params, [&Text]()
+			{
+				FOrionValidationReport Report = UOrionAI::MonitorAIDecision(TEXT("Benchmark"), Text);
+			}));
+
+			// Same pipeline, reporting through a view - the difference is the report's own copies
+			ReportResult(*this, Runner.Run(TEXT("MonitorAIDecision.View"), Params, [&Arena, &AISystem, &Text]()
+			{
+				Arena.Reset();
+				FOrionValidationReportView Report = UOrionAI::MonitorAIDecision(Arena, AISystem, Text);
+			}));
+
+			// Narrower profile: three pattern categories and no Charles Carmichael
+			ReportResult(*this, Runner.Run(TEXT("MonitorAIDecision.Profile"), Params, [&ProfiledAISystem, &Text]()
+			{
+				FOrionValidationReport Report = UOrionAI::MonitorAIDecision(ProfiledAISystem, Text);
+			}));
+
+			ReportResult(*this, Runner.Run(TEXT("QuickValidate"), Params, [&Text]()
+			{
+				EOrionQuickReason Reason;
+				UOrionAI::QuickValidate(FStringView(Text), Reason);
+			}));
+
+			ReportResult(*this, Runner.Run(TEXT("QuickValidate.Profile"), Params, [&ProfiledAISystem, &Text]()
+			{
+				EOrionQuickReason Reason;
+				UOrionAI::QuickValidate(FStringView(ProfiledAISystem), FStringView(Text), Reason);
+			}));
+
+			ReportResult(*this, Runner.Run(TEXT("RunIntersectScan"), Params, [&Text]()
+			{
+				FOrionValidationReport Report;
+				UOrionAI::RunIntersectScan(Text, Report);
+			}));
+
+			ReportResult(*this, Runner.Run(TEXT("RunFulcrumFilter"), Params, [&Text]()
+			{
+				FOrionValidationReport Report;
+				UOrionAI::RunFulcrumFilter(Text, Report);
+			}));
+
+			ReportResult(*this, Runner.Run(TEXT("SanitizeWithCharlesCarmichael"), Params, [&Text]()
+			{
+				FString Sanitized = UOrionAI::SanitizeWithCharlesCarmichael(Text);
+			}));
+		}
+	}
+
+	TestFalse(TEXT("Clean benchmark corpus never trips safe mode"), UOrionAI::IsInSafeMode());
+
+	WriteResults(*this, Runner);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrionPerfPatternMatcherTest,
+	"OrionAI.Perf.PatternMatcher",
+	EAutomationTestFlags::ApplicationContextMask |
+	EAutomationTestFlags::PerfFilter
+)
+
+bool FOrionPerfPatternMatcherTest::RunTest(const FString& Parameters)
+{
+	using namespace OrionBench;
+
+	FBenchmarkRunner Runner(TEXT("PatternMatcher"));
+
+	// Exact matching, text skeletons, and skeletons within two edits
+	struct FMode
+	{
+		const TCHAR* Name;
+		bool bNormalize;
+		int32 MaxEditDistance;
+	};
+	static const FMode Modes[] =
+	{
+		{ TEXT("PatternMatcher.Scan"), false, 0 },
+		{ TEXT("PatternMatcher.Scan.Normalized"), true, 0 },
+		{ TEXT("PatternMatcher.Scan.Fuzzy"), true, 2 },
+	};
+
+	for (const FMode& Mode : Modes)
+	{
+		for (int32 PatternCount : PatternCounts)
+		{
+			// Spread the synthetic patterns over every category, as a large Casey Protocol would
+			FOrionPatternMatcher Matcher;
+			const TArray<FString> Patterns = MakeSyntheticPatterns(PatternCount);
+			for (int32 Index = 0; Index < Patterns.Num(); Index++)
+			{
+				Matcher.AddPattern((EOrionPatternCategory)(Index % (int32)EOrionPatternCategory::Count), Patterns[Index]);
+			}
+
+			FOrionPatternMatcher::FOptions Options;
+			Options.CaseFolding = EOrionCaseFolding::Ascii;
+			Options.bNormalize = Mode.bNormalize;
+			Options.MaxEditDistance = Mode.MaxEditDistance;
+
+			const double CompileStart = FPlatformTime::Seconds();
+			Matcher.Compile(Options);
+			AddInfo(FString::Printf(TEXT("%s/patternCount=%d compiled in %.2f ms (%d states, %d fuzzy patterns)"),
+				Mode.Name, PatternCount, (FPlatformTime::Seconds() - CompileStart) * 1000.0, Matcher.GetNumStates(), Matcher.GetNumFuzzyPatterns()));
+
+			for (int32 InputLength : InputLengths)
+			{
+				const FString Text = MakeCorpusText(InputLength, 0);
+				TArray<FBenchmarkParam> Params = { { TEXT("inputLength"), InputLength }, { TEXT("patternCount"), PatternCount } };
+
+				ReportResult(*this, Runner.Run(Mode.Name, Params, [&Matcher, &Text]()
+				{
+					FOrionPatternMatcher::FScanResult Matches;
+					Matcher.Scan(Text, Matches);
+				}));
+			}
+		}
+	}
+
+	WriteResults(*this, Runner);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrionPerfPrefilterTest,
+	"OrionAI.Perf.Prefilter",
+	EAutomationTestFlags::ApplicationContextMask |
+	EAutomationTestFlags::PerfFilter
+)
+
+bool FOrionPerfPrefilterTest::RunTest(const FString& Parameters)
+{
+	using namespace OrionBench;
+
+	if (!EnsureOrionInitialized(*this))
+	{
+		return false;
+	}
+
+	const EOrionSimdLevel Supported = OrionPrefilter::GetSupportedLevel();
+	const EOrionSimdLevel Previous = OrionPrefilter::GetActiveLevel();
+	if (Supported == EOrionSimdLevel::Scalar)
+	{
+		AddWarning(TEXT("No SIMD prefilter on this CPU - only the scalar path is measured"));
+	}
+
+	FBenchmarkRunner Runner(TEXT("Prefilter"));
+	FCaseyProtocolReadScope Protocol;
+	const FOrionPatternMatcher& Matcher = Protocol->GetPatternMatcher();
+	const FCharlesCarmichaelRuleSet& Rules = Protocol->GetSanitizationRules();
+
+	for (int32 InputLength : PrefilterInputLengths)
+	{
+		for (int32 PiiPerKB : PiiDensities)
+		{
+			const FString Text = MakeCorpusText(InputLength, PiiPerKB);
+			double ScalarScanNs = 0.0;
+			double ScalarSanitizeNs = 0.0;
+
+			for (EOrionSimdLevel Level : { EOrionSimdLevel::Scalar, Supported })
+			{
+				OrionPrefilter::SetActiveLevel(Level);
+				TArray<FBenchmarkParam> Params = { { TEXT("inputLength"), InputLength }, { TEXT("piiPerKB"), PiiPerKB }, { TEXT("simd"), (int32)Level } };
+
+				// Run() results live in a growing array, so keep the numbers rather than references
+				const FBenchmarkResult& Scan = Runner.Run(TEXT("PatternMatcher.Scan"), Params, [&Matcher, &Text]()
+				{
+					FOrionPatternMatcher::FScanResult Matches;
+					Matcher.Scan(Text, Matches);
+				});
+				ReportResult(*this, Scan);
+				const double ScanNs = Scan.P50Ns;
+
+				const FBenchmarkResult& Sanitize = Runner.Run(TEXT("CharlesCarmichael.Sanitize"), Params, [&Rules, &Text]()
+				{
+					FString Sanitized;
+					Rules.Sanitize(Text, Sanitized);
+				});
+				ReportResult(*this, Sanitize);
+				const double SanitizeNs = Sanitize.P50Ns;
+
+				if (Level == EOrionSimdLevel::Scalar)
+				{
+					ScalarScanNs = ScanNs;
+					ScalarSanitizeNs = SanitizeNs;
+				}
+				else
+				{
+					AddInfo(FString::Printf(TEXT("%s vs Scalar at inputLength=%d piiPerKB=%d: Scan %.1fx, Sanitize %.1fx"),
+						OrionPrefilter::LexToString(Level), InputLength, PiiPerKB,
+						ScalarScanNs / FMath::Max(ScanNs, 1.0), ScalarSanitizeNs / FMath::Max(SanitizeNs, 1.0)));
+				}
+
+				if (Level == Supported)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	OrionPrefilter::SetActiveLevel(Previous);
+
+	WriteResults(*this, Runner);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOrionPerfRingIntelTest,
+	"OrionAI.Perf.RingIntel",
+	EAutomationTestFlags::ApplicationContextMask |
+	EAutomationTestFlags::PerfFilter
+)
+
+bool FOrionPerfRingIntelTest::RunTest(const FString& Parameters)
+{
+	using namespace OrionBench;
+
+	if (!EnsureOrionInitialized(*this))
+	{
+		return false;
+	}
+
+	FRingIntelBackend& Backend = FRingIntelBackend::Get();
+	if (!Backend.IsRunning())
+	{
+		AddWarning(TEXT("No Ring Intel model loaded - enable ringIntel and provide the model to measure inference"));
+		return true;
+	}
+
+	FBenchmarkRunner Runner(TEXT("RingIntel"));
+
+	for (int32 InputLength : RingIntelInputLengths)
+	{
+		const FString Text = MakeCorpusText(InputLength, 0);
+		double SingleNs = 0.0;
+
+		// Each call classifies Concurrency texts at once, so the batcher can group them
+		for (int32 Concurrency : RingIntelConcurrency)
+		{
+			TArray<FBenchmarkParam> Params = { { TEXT("inputLength"), InputLength }, { TEXT("concurrency"), Concurrency } };
+			const FBenchmarkResult& Result = Runner.Run(TEXT("RingIntel.Classify"), Params, [&Backend, &Text, Concurrency]()
+			{
+				ParallelFor(Concurrency, [&Backend, &Text](int32)
+				{
+					float Toxicity = 0.0f;
+					Backend.Classify(Text, Toxicity);
+				}, EParallelForFlags::Unbalanced);
+			});
+			ReportResult(*this, Result);
+
+			const double PerTextNs = Result.P50Ns / Concurrency;
+			if (Concurrency == 1)
+			{
+				SingleNs = PerTextNs;
+			}
+			else
+			{
+				AddInfo(FString::Printf(TEXT("Ring Intel at inputLength=%d: %d concurrent texts cost %.1fx less each than one at a time"),
+					InputLength, Concurrency, SingleNs / FMath::Max(PerTextNs, 1.0)));
+			}
+		}
+	}
+
+	WriteResults(*this, Runner);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
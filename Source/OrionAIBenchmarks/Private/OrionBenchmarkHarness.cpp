@@ -0,0 +1,371 @@
+// OrionAI - Benchmark harness
+// Per-call timing, allocation counting and JSON output for the perf tests
+
+#include "OrionBenchmarkHarness.h"
+#include "CaseyProtocol.h"
+#include "CaseyProtocolBlob.h"
+#include "HAL/FileManager.h"
+#include "HAL/MallocBase.h"
+#include "HAL/PlatformProperties.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Interfaces/IPluginManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace OrionBench
+{
+	// Only the thread inside an FAllocationScope counts
+	static thread_local int32 CountingDepth = 0;
+	static thread_local int64 ThreadAllocations = 0;
+	static thread_local int64 ThreadBytes = 0;
+
+	/** Forwards everything to the real allocator, counting what the current thread asks for */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInner)
+			: Inner(InInner)
+		{
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Note(Count);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Note(Count);
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				Note(Count);
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				Note(Count);
+			}
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			Inner->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+		virtual void OnMallocInitialized() override { Inner->OnMallocInitialized(); }
+		virtual void OnPreFork() override { Inner->OnPreFork(); }
+		virtual void OnPostFork() override { Inner->OnPostFork(); }
+
+	private:
+		static void Note(SIZE_T Count)
+		{
+			if (CountingDepth > 0)
+			{
+				ThreadAllocations++;
+				ThreadBytes += (int64)Count;
+			}
+		}
+
+		FMalloc* Inner;
+	};
+
+	static void InstallCountingMalloc()
+	{
+		// Blocks allocated before the swap are still freed by the inner allocator,
+		// since the proxy forwards every call. It is intentionally never removed.
+		static bool bInstalled = false;
+		check(IsInGameThread());
+		if (!bInstalled)
+		{
+			bInstalled = true;
+			GMalloc = new FCountingMalloc(GMalloc);
+		}
+	}
+
+	FAllocationScope::FAllocationScope()
+	{
+		InstallCountingMalloc();
+		StartAllocations = ThreadAllocations;
+		StartBytes = ThreadBytes;
+		CountingDepth++;
+	}
+
+	FAllocationScope::~FAllocationScope()
+	{
+		CountingDepth--;
+	}
+
+	int64 FAllocationScope::GetAllocations() const
+	{
+		return ThreadAllocations - StartAllocations;
+	}
+
+	int64 FAllocationScope::GetBytes() const
+	{
+		return ThreadBytes - StartBytes;
+	}
+
+	FString FBenchmarkResult::GetId() const
+	{
+		FString Id = Name;
+		for (const FBenchmarkParam& Param : Params)
+		{
+			Id += FString::Printf(TEXT("/%s=%d"), *Param.Name, Param.Value);
+		}
+		return Id;
+	}
+
+	FBenchmarkRunner::FBenchmarkRunner(const FString& InSuiteName)
+		: SuiteName(InSuiteName)
+	{
+		// Shorter runs for smoke-testing the suite itself; numbers are noisier
+		if (FParse::Param(FCommandLine::Get(), TEXT("OrionBenchQuick")))
+		{
+			MinSeconds = 0.02;
+			MinIterations = 8;
+		}
+
+		// Sample storage must not grow inside the counted region
+		Samples.Reserve(MaxIterations);
+	}
+
+	const FBenchmarkResult& FBenchmarkRunner::Run(const FString& Name, TArray<FBenchmarkParam> Params, TFunctionRef<void()> Body)
+	{
+		for (int32 Warmup = 0; Warmup < WarmupIterations; Warmup++)
+		{
+			Body();
+		}
+
+		Samples.Reset();
+
+		int64 Allocations = 0;
+		int64 Bytes = 0;
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		const uint64 MinCycles = (uint64)(MinSeconds / FPlatformTime::GetSecondsPerCycle64());
+		uint64 TotalCycles = 0;
+
+		{
+			FAllocationScope AllocationScope;
+
+			while (Samples.Num() < MaxIterations && (Samples.Num() < MinIterations || TotalCycles < MinCycles))
+			{
+				const uint64 CallStart = FPlatformTime::Cycles64();
+				Body();
+				const uint64 CallEnd = FPlatformTime::Cycles64();
+
+				Samples.Add(FPlatformTime::ToSeconds64(CallEnd - CallStart) * 1e9);
+				TotalCycles = CallEnd - StartCycles;
+			}
+
+			Allocations = AllocationScope.GetAllocations();
+			Bytes = AllocationScope.GetBytes();
+		}
+
+		const int32 Iterations = Samples.Num();
+		double SumNs = 0.0;
+		for (double Sample : Samples)
+		{
+			SumNs += Sample;
+		}
+		Samples.Sort();
+
+		// Nearest-rank percentiles
+		auto Percentile = [this, Iterations](double Fraction)
+		{
+			const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * Iterations) - 1, 0, Iterations - 1);
+			return Samples[Rank];
+		};
+
+		FBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+		Result.Name = Name;
+		Result.Params = MoveTemp(Params);
+		Result.Iterations = Iterations;
+		Result.P50Ns = Percentile(0.50);
+		Result.P99Ns = Percentile(0.99);
+		Result.MeanNs = SumNs / Iterations;
+		Result.ThroughputPerSec = SumNs > 0.0 ? Iterations / (SumNs * 1e-9) : 0.0;
+		Result.AllocsPerCall = (double)Allocations / Iterations;
+		Result.BytesPerCall = (double)Bytes / Iterations;
+		return Result;
+	}
+
+	FString FBenchmarkRunner::WriteJson() const
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("schemaVersion"), 1);
+		Root->SetStringField(TEXT("suite"), SuiteName);
+		Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+		Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+		Root->SetStringField(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+		Root->SetStringField(TEXT("buildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+
+		TArray<TSharedPtr<FJsonValue>> ResultValues;
+		for (const FBenchmarkResult& Result : Results)
+		{
+			TSharedRef<FJsonObject> ParamsObj = MakeShared<FJsonObject>();
+			for (const FBenchmarkParam& Param : Result.Params)
+			{
+				ParamsObj->SetNumberField(Param.Name, Param.Value);
+			}
+
+			TSharedRef<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+			ResultObj->SetStringField(TEXT("id"), Result.GetId());
+			ResultObj->SetStringField(TEXT("name"), Result.Name);
+			ResultObj->SetObjectField(TEXT("params"), ParamsObj);
+			ResultObj->SetNumberField(TEXT("iterations"), Result.Iterations);
+			ResultObj->SetNumberField(TEXT("p50Ns"), Result.P50Ns);
+			ResultObj->SetNumberField(TEXT("p99Ns"), Result.P99Ns);
+			ResultObj->SetNumberField(TEXT("meanNs"), Result.MeanNs);
+			ResultObj->SetNumberField(TEXT("throughputPerSec"), Result.ThroughputPerSec);
+			ResultObj->SetNumberField(TEXT("allocsPerCall"), Result.AllocsPerCall);
+			ResultObj->SetNumberField(TEXT("bytesPerCall"), Result.BytesPerCall);
+			ResultValues.Add(MakeShared<FJsonValueObject>(ResultObj));
+		}
+		Root->SetArrayField(TEXT("results"), ResultValues);
+
+		FString Json;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		if (!FJsonSerializer::Serialize(Root, Writer))
+		{
+			return FString();
+		}
+
+		FString OutputDir;
+		if (!FParse::Value(FCommandLine::Get(), TEXT("OrionBenchDir="), OutputDir))
+		{
+			OutputDir = FPaths::ProjectSavedDir() / TEXT("Benchmarks");
+		}
+
+		const FString OutputPath = OutputDir / FString::Printf(TEXT("OrionAI-%s.json"), *SuiteName);
+		return FFileHelper::SaveStringToFile(Json, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM) ? OutputPath : FString();
+	}
+
+	FString MakeCorpusText(int32 Length, int32 PiiPerKB, uint32 Seed)
+	{
+		// Nothing here may form an Intersect/Fulcrum pattern - the sweeps measure the
+		// clean path, and a rejection would count failures towards safe mode
+		static const TCHAR* const Words[] =
+		{
+			TEXT("agent"), TEXT("asset"), TEXT("burbank"), TEXT("castle"), TEXT("handler"),
+			TEXT("mission"), TEXT("briefing"), TEXT("status"), TEXT("nominal"), TEXT("perimeter"),
+			TEXT("secure"), TEXT("extraction"), TEXT("orange"), TEXT("subway"), TEXT("inventory"),
+			TEXT("delivery"), TEXT("schedule"), TEXT("morning"), TEXT("coffee"), TEXT("store"),
+			TEXT("customer"), TEXT("report"), TEXT("team"), TEXT("satellite"), TEXT("frequency"),
+			TEXT("weekend"), TEXT("restock"), TEXT("warehouse"), TEXT("install"), TEXT("cable"),
+		};
+
+		static const TCHAR* const PiiItems[] =
+		{
+			TEXT("chuck.bartowski@buymore.com"),
+			TEXT("123-45-6789"),
+			TEXT("4111 1111 1111 1111"),
+			TEXT("555-867-5309"),
+			TEXT("192.168.0.42"),
+		};
+
+		FRandomStream Random(Seed);
+		FString Text;
+		Text.Reserve(Length + 64);
+
+		const int32 PiiSpacing = PiiPerKB > 0 ? FMath::Max(1, 1024 / PiiPerKB) : MAX_int32;
+		int32 NextPii = PiiSpacing / 2;
+		int32 PiiIndex = 0;
+
+		while (Text.Len() < Length)
+		{
+			if (Text.Len() >= NextPii)
+			{
+				Text += PiiItems[PiiIndex++ % UE_ARRAY_COUNT(PiiItems)];
+				NextPii += PiiSpacing;
+			}
+			else
+			{
+				Text += Words[Random.RandHelper(UE_ARRAY_COUNT(Words))];
+			}
+			Text += (Random.RandHelper(12) == 0) ? TEXT(". ") : TEXT(" ");
+		}
+
+		Text.LeftInline(Length);
+		return Text;
+	}
+
+	TArray<FString> MakeSyntheticPatterns(int32 Count, uint32 Seed)
+	{
+		// "zx" never appears in the corpus vocabulary
+		FRandomStream Random(Seed);
+		TArray<FString> Patterns;
+		Patterns.Reserve(Count);
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			Patterns.Add(FString::Printf(TEXT("zx%d protocol %d"), Index, Random.RandHelper(1000)));
+		}
+		return Patterns;
+	}
+
+	FString GetPluginConfigPath()
+	{
+		TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("OrionAI"));
+		FString ConfigPath = Plugin.IsValid()
+			? Plugin->GetBaseDir() / TEXT("Config/CaseyProtocol.json")
+			: FPaths::ProjectDir() / TEXT("Config/CaseyProtocol.json");
+		FPaths::MakePathRelativeTo(ConfigPath, *FPaths::ProjectDir());
+		return ConfigPath;
+	}
+
+	FString WriteTestConfig(const FString& Name, TFunctionRef<void(FJsonObject&)> Edit)
+	{
+		FString Json;
+		TSharedPtr<FJsonObject> Config;
+		if (!FFileHelper::LoadFileToString(Json, *(FPaths::ProjectDir() / GetPluginConfigPath()))
+			|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Config) || !Config.IsValid())
+		{
+			return FString();
+		}
+
+		Edit(*Config);
+
+		FString Edited;
+		FJsonSerializer::Serialize(Config.ToSharedRef(), TJsonWriterFactory<>::Create(&Edited));
+
+		const FString ConfigPath = FPaths::ProjectSavedDir() / TEXT("OrionAITests") / (Name + TEXT(".json"));
+		IFileManager::Get().Delete(*FCaseyProtocolBlob::GetBlobPath(ConfigPath), false, true, true);
+		if (!FFileHelper::SaveStringToFile(Edited, *ConfigPath))
+		{
+			return FString();
+		}
+		return FPaths::ConvertRelativePathToFull(ConfigPath);
+	}
+
+	FScopedConfigRestore::~FScopedConfigRestore()
+	{
+		UCaseyProtocol::ReloadFromFile(FPaths::ProjectDir() / GetPluginConfigPath());
+	}
+}
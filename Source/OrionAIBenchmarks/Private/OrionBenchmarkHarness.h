@@ -0,0 +1,120 @@
+#pragma once
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * OrionAI benchmark harness
+ * "Jeff, Lester - time everything. With a stopwatch this time."
+ *
+ * Times a callable call-by-call until it has run for a minimum duration, then reports
+ * latency percentiles, throughput and heap traffic per call. Results are collected in
+ * a machine-readable JSON file that Tools/beckman.py compares against a baseline.
+ */
+namespace OrionBench
+{
+    /** One swept parameter, e.g. inputLength=1000 */
+    struct FBenchmarkParam
+    {
+        FString Name;
+        int32 Value = 0;
+    };
+
+    struct FBenchmarkResult
+    {
+        FString Name;
+        TArray<FBenchmarkParam> Params;
+
+        int32 Iterations = 0;
+        double P50Ns = 0.0;
+        double P99Ns = 0.0;
+        double MeanNs = 0.0;
+        double ThroughputPerSec = 0.0;
+        double AllocsPerCall = 0.0;
+        double BytesPerCall = 0.0;
+
+        /** Stable key used to match results against a baseline, e.g. "MonitorAIDecision/inputLength=1000" */
+        FString GetId() const;
+    };
+
+    /**
+     * Counts heap allocations made by the calling thread
+     * Installs a forwarding FMalloc in front of GMalloc the first time it is used. The
+     * proxy stays installed for the rest of the process; threads that are not counting
+     * only pay one thread-local check per allocation.
+     */
+    struct FAllocationScope
+    {
+        FAllocationScope();
+        ~FAllocationScope();
+
+        int64 GetAllocations() const;
+        int64 GetBytes() const;
+
+    private:
+        int64 StartAllocations = 0;
+        int64 StartBytes = 0;
+    };
+
+    class FBenchmarkRunner
+    {
+    public:
+        /** @param SuiteName - Short name used for the output file, e.g. "Pipeline" */
+        explicit FBenchmarkRunner(const FString& SuiteName);
+
+        /** Time Body until it has run for the minimum duration; returns the recorded result */
+        const FBenchmarkResult& Run(const FString& Name, TArray<FBenchmarkParam> Params, TFunctionRef<void()> Body);
+
+        const TArray<FBenchmarkResult>& GetResults() const { return Results; }
+
+        /**
+         * Write every result as JSON
+         * Goes to -OrionBenchDir=<dir> when given, else Saved/Benchmarks.
+         * @return Path written, or empty on failure
+         */
+        FString WriteJson() const;
+
+    private:
+        FString SuiteName;
+        double MinSeconds = 0.25;
+        int32 MinIterations = 32;
+        int32 MaxIterations = 200000;
+        int32 WarmupIterations = 8;
+
+        TArray<FBenchmarkResult> Results;
+        TArray<double> Samples;
+    };
+
+    /**
+     * Deterministic, otherwise clean text for the pipeline sweeps
+     * @param Length - Characters to generate
+     * @param PiiPerKB - PII items (emails, SSNs, cards, phones, IPs) per 1024 characters
+     */
+    FString MakeCorpusText(int32 Length, int32 PiiPerKB, uint32 Seed = 0x0C4A12);
+
+    /** Multi-word phrases that never occur in MakeCorpusText output */
+    TArray<FString> MakeSyntheticPatterns(int32 Count, uint32 Seed = 0x0C4A12);
+
+    /** The plugin's own Casey Protocol, relative to the project directory as InitializeOrion expects */
+    FString GetPluginConfigPath();
+
+    /**
+     * Write a copy of the plugin's Casey Protocol to Saved/OrionAITests/<Name>.json, with Edit applied
+     * Any blob left next to an earlier copy is deleted, so the copy is parsed until one is compiled.
+     * @return Full path of the copy, or empty if it could not be written
+     */
+    FString WriteTestConfig(const FString& Name, TFunctionRef<void(FJsonObject&)> Edit);
+
+    /**
+     * Puts the plugin's own Casey Protocol back when it goes out of scope, after a test has
+     * reloaded a copy. Never let it go out of scope inside a read scope.
+     */
+    struct FScopedConfigRestore
+    {
+        FScopedConfigRestore() = default;
+        ~FScopedConfigRestore();
+
+        FScopedConfigRestore(const FScopedConfigRestore&) = delete;
+        FScopedConfigRestore& operator=(const FScopedConfigRestore&) = delete;
+    };
+}
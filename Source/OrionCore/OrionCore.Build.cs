@@ -0,0 +1,22 @@
+// OrionCore.Build.cs
+// Engine-independent matching core, shared with the Python package's native extension
+
+using UnrealBuildTool;
+
+public class OrionCore : ModuleRules
+{
+    public OrionCore(ReadOnlyTargetRules Target) : base(Target)
+    {
+        // Plain C++17 with no engine headers outside the module boilerplate, so the same
+        // sources build outside Unreal (see Python/setup.py)
+        PCHUsage = ModuleRules.PCHUsageMode.NoPCHs;
+        CppStandard = CppStandardVersion.Cpp17;
+        
+        PrivateDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core"  // IMPLEMENT_MODULE only
+            }
+        );
+    }
+}
@@ -0,0 +1,920 @@
+// OrionCore - Compiled multi-pattern matcher
+// Aho-Corasick automaton over the Intersect/Fulcrum pattern lists
+
+#include "OrionCoreMatcher.h"
+#include "OrionCoreNormalizer.h"
+#include <cassert>
+#include <map>
+
+namespace OrionCore::PatternMatcher
+{
+	// Shorter seeds hit on nearly every word and leave all the work to verification
+	constexpr int32_t MinSeedLength = 3;
+
+	/** Every entry in [Min, Max) */
+	template <typename T>
+	static bool AllInRange(const TTableView<T>& Table, int64_t Min, int64_t Max)
+	{
+		for (const T Value : Table)
+		{
+			if ((int64_t)Value < Min || (int64_t)Value >= Max)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Offsets into a table of Size entries: starting at 0, never decreasing, ending at Size */
+	static bool AreOffsets(const TTableView<int32_t>& Offsets, int32_t Size)
+	{
+		if (Offsets.Num() == 0 || Offsets[0] != 0 || Offsets.Last() != Size)
+		{
+			return false;
+		}
+		for (int32_t Index = 1; Index < Offsets.Num(); Index++)
+		{
+			if (Offsets[Index] < Offsets[Index - 1])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Every dictionary link chain ends - a cycle would hang the scan */
+	static bool AreDictionaryLinksAcyclic(const TTableView<int32_t>& DictionaryLinks)
+	{
+		enum : uint8_t { Unvisited, OnChain, Ends };
+		std::vector<uint8_t> Marks(DictionaryLinks.Num(), Unvisited);
+
+		for (int32_t First = 0; First < DictionaryLinks.Num(); First++)
+		{
+			int32_t State = First;
+			while (State != IndexNone && Marks[State] == Unvisited)
+			{
+				Marks[State] = OnChain;
+				State = DictionaryLinks[State];
+			}
+			if (State != IndexNone && Marks[State] == OnChain)
+			{
+				return false;
+			}
+
+			// Everything just walked ends where this chain does
+			for (State = First; State != IndexNone && Marks[State] == OnChain; State = DictionaryLinks[State])
+			{
+				Marks[State] = Ends;
+			}
+		}
+		return true;
+	}
+}
+
+namespace OrionCore
+{
+	bool FMatcherTables::IsConsistent() const
+	{
+		using namespace PatternMatcher;
+
+		const int32_t NumPatterns = PatternCategories.Num();
+		const int32_t NumSeeds = SeedPatterns.Num();
+
+		const bool bSizesAgree = NumClasses >= 1 && NumStates >= 1
+			&& AsciiClasses.Num() == 128
+			&& FoldedAsciiClasses.Num() == 128
+			&& WideChars.Num() == WideCharClasses.Num()
+			&& (int64_t)Transitions.Num() == (int64_t)NumStates * NumClasses
+			&& OutputOffsets.Num() == NumStates + 1
+			&& OutputOffsets[NumStates] == OutputPatterns.Num()
+			&& DictionaryLinks.Num() == NumStates
+			&& PatternCategoryIndices.Num() == NumPatterns
+			&& PatternTextOffsets.Num() == NumPatterns
+			&& CategoryOffsets.Num() == (int32_t)EPatternCategory::Count + 1
+			&& CategoryOffsets[(int32_t)EPatternCategory::Count] == NumPatterns
+			&& CategoryPatterns.Num() == NumPatterns
+			&& (NumPatterns == 0 || (PatternText.Num() > 0 && PatternText.Last() == u'\0'))
+			&& SkipClass < NumClasses && SpaceClass < NumClasses
+			&& SeedPatterns.Num() == SeedEnds.Num()
+			&& (SeedPatterns.Num() == 0
+				|| (MaxEditDistance >= 1 && MaxEditDistance <= FPatternMatcher::MaxFuzzyEditDistance
+					&& FuzzyOffsets.Num() == NumPatterns + 1
+					&& FuzzyOffsets[NumPatterns] == FuzzyClasses.Num()));
+		if (!bSizesAgree)
+		{
+			return false;
+		}
+
+		// Everything a scan uses as an index, so a blob from a buggy or hostile writer is
+		// refused here rather than read out of bounds later
+		if (!AllInRange(AsciiClasses, 0, NumClasses)
+			|| !AllInRange(FoldedAsciiClasses, 0, NumClasses)
+			|| !AllInRange(WideCharClasses, 0, NumClasses)
+			|| !AllInRange(Transitions, 0, NumStates)
+			|| !AreOffsets(OutputOffsets, OutputPatterns.Num())
+			|| !AllInRange(OutputPatterns, 0, (int64_t)NumPatterns + NumSeeds)
+			|| !AllInRange(DictionaryLinks, IndexNone, NumStates)
+			|| !AreDictionaryLinksAcyclic(DictionaryLinks)
+			|| !AllInRange(PatternCategories, 0, (int32_t)EPatternCategory::Count)
+			|| !AllInRange(PatternTextOffsets, 0, PatternText.Num())
+			|| !AreOffsets(CategoryOffsets, NumPatterns)
+			|| !AllInRange(CategoryPatterns, 0, NumPatterns)
+			|| !AllInRange(SeedPatterns, 0, NumPatterns))
+		{
+			return false;
+		}
+
+		// Binary search needs them sorted
+		for (int32_t Index = 1; Index < WideChars.Num(); Index++)
+		{
+			if (WideChars[Index] <= WideChars[Index - 1])
+			{
+				return false;
+			}
+		}
+
+		// Each pattern is listed under its own category at its own index
+		for (int32_t PatternId = 0; PatternId < NumPatterns; PatternId++)
+		{
+			const int32_t Category = PatternCategories[PatternId];
+			const int32_t Slot = CategoryOffsets[Category] + PatternCategoryIndices[PatternId];
+			if (PatternCategoryIndices[PatternId] < 0 || Slot >= CategoryOffsets[Category + 1] || CategoryPatterns[Slot] != PatternId)
+			{
+				return false;
+			}
+		}
+
+		if (NumSeeds > 0)
+		{
+			// Verification keeps a pattern's classes in one 64-bit word and its window on the stack
+			if (!AreOffsets(FuzzyOffsets, FuzzyClasses.Num()))
+			{
+				return false;
+			}
+			for (int32_t PatternId = 0; PatternId < NumPatterns; PatternId++)
+			{
+				if (FuzzyOffsets[PatternId + 1] - FuzzyOffsets[PatternId] > FPatternMatcher::MaxFuzzyLength)
+				{
+					return false;
+				}
+			}
+			for (int32_t SeedIndex = 0; SeedIndex < NumSeeds; SeedIndex++)
+			{
+				const int32_t PatternId = SeedPatterns[SeedIndex];
+				const int32_t PatternLen = FuzzyOffsets[PatternId + 1] - FuzzyOffsets[PatternId];
+				if (SeedEnds[SeedIndex] < 1 || SeedEnds[SeedIndex] > PatternLen)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void FPatternMatcher::AddPattern(EPatternCategory Category, FTextView Pattern)
+	{
+		assert(!bCompiled);
+
+		PendingPatterns.push_back({ std::u16string(Pattern), Category });
+	}
+
+	void FPatternMatcher::AddPatternsFrom(const FPatternMatcher& Source, uint32_t CategoryMask)
+	{
+		assert(Source.bCompiled);
+
+		// Read back from the tables rather than any config, which a mapped blob doesn't carry
+		for (int32_t Category = 0; Category < (int32_t)EPatternCategory::Count; Category++)
+		{
+			if ((CategoryMask & (1u << Category)) == 0)
+			{
+				continue;
+			}
+
+			const int32_t NumPatterns = Source.GetNumPatterns((EPatternCategory)Category);
+			for (int32_t Index = 0; Index < NumPatterns; Index++)
+			{
+				AddPattern((EPatternCategory)Category, Source.GetPattern((EPatternCategory)Category, Index));
+			}
+		}
+	}
+
+	FMatcherOptions FPatternMatcher::GetOptions() const
+	{
+		FMatcherOptions Options;
+		Options.bUnicodeFolding = Tables.bUnicodeFolding;
+		Options.bNormalize = Tables.bNormalized;
+		Options.MaxEditDistance = Tables.MaxEditDistance;
+		Options.MinFuzzyLength = Tables.MinFuzzyLength;
+		return Options;
+	}
+
+	bool FPatternMatcher::CompileFromTables(const FMatcherTables& InTables)
+	{
+		assert(!bCompiled);
+
+		if (!InTables.IsConsistent())
+		{
+			return false;
+		}
+
+		Tables = InTables;
+		for (int32_t PatternId = 0; PatternId + 1 < InTables.FuzzyOffsets.Num(); PatternId++)
+		{
+			if (InTables.FuzzyOffsets[PatternId + 1] > InTables.FuzzyOffsets[PatternId])
+			{
+				NumFuzzyPatterns++;
+			}
+		}
+		PendingPatterns.clear();
+		BuildPrefilter();
+		bCompiled = true;
+		return true;
+	}
+
+	void FPatternMatcher::Compile(const FMatcherOptions& Options)
+	{
+		assert(!bCompiled);
+
+		Tables.bUnicodeFolding = Options.bUnicodeFolding;
+		Tables.bNormalized = Options.bNormalize;
+		Tables.MaxEditDistance = std::clamp(Options.MaxEditDistance, 0, MaxFuzzyEditDistance);
+		Tables.MinFuzzyLength = std::max(Options.MinFuzzyLength, (Tables.MaxEditDistance + 1) * PatternMatcher::MinSeedLength);
+
+		const int32_t NumPatterns = (int32_t)PendingPatterns.size();
+		int32_t NumClasses = 1;
+
+		OwnedAsciiClasses.assign(128, 0);
+		std::map<FChar, int32_t> WideClasses;
+
+		auto GetCharClass = [this, &WideClasses](FChar Char) -> int32_t
+		{
+			if (Char < 128)
+			{
+				return OwnedAsciiClasses[Char];
+			}
+			const auto Found = WideClasses.find(Char);
+			return Found != WideClasses.end() ? Found->second : 0;
+		};
+
+		std::vector<std::u16string> LowerPatterns;
+		LowerPatterns.reserve(NumPatterns);
+
+		// Fold (and normalize) patterns exactly the way Scan folds text, then assign a class to
+		// every character they use
+		for (const FPatternEntry& Entry : PendingPatterns)
+		{
+			std::u16string Lower = Entry.Text;
+			for (FChar& Char : Lower)
+			{
+				Char = Fold(Char);
+			}
+			if (Tables.bNormalized)
+			{
+				Lower = Normalizer::NormalizeText(Lower);
+			}
+
+			for (FChar Char : Lower)
+			{
+				if (GetCharClass(Char) != 0)
+				{
+					continue;
+				}
+
+				if (Char < 128)
+				{
+					OwnedAsciiClasses[Char] = (uint16_t)NumClasses;
+				}
+				else
+				{
+					WideClasses.emplace(Char, NumClasses);
+				}
+				NumClasses++;
+			}
+			LowerPatterns.push_back(std::move(Lower));
+		}
+
+		OwnedFoldedAsciiClasses = OwnedAsciiClasses;
+		if (Tables.bNormalized)
+		{
+			const int32_t SpaceClass = GetCharClass(Normalizer::Separator);
+			Tables.SpaceClass = SpaceClass != 0 ? SpaceClass : IndexNone;
+			Tables.SkipClass = NumClasses++;
+
+			// Every character reads as its skeleton. Wide ones are keyed the way
+			// GetFoldedCharClass looks them up, i.e. after case folding.
+			for (int32_t Char = 0; Char < 128; Char++)
+			{
+				const FChar Skeleton = Normalizer::Normalize((FChar)Char);
+				OwnedFoldedAsciiClasses[Char] = (uint16_t)(Skeleton == Normalizer::Dropped ? Tables.SkipClass : GetCharClass(Skeleton));
+			}
+
+			for (uint32_t Code = 128; Code <= 0xFFFF; Code++)
+			{
+				const FChar Key = Fold((FChar)Code);
+				if ((Code >= 0xD800 && Code <= 0xDFFF) || WideClasses.count(Key) != 0)
+				{
+					continue;
+				}
+
+				const FChar Skeleton = Normalizer::Normalize(Key);
+				if (Skeleton == Key)
+				{
+					continue;
+				}
+
+				const int32_t Class = Skeleton == Normalizer::Dropped ? Tables.SkipClass : GetCharClass(Skeleton);
+				if (Class != 0)
+				{
+					WideClasses.emplace(Key, Class);
+				}
+			}
+		}
+		else
+		{
+			for (FChar Char = u'A'; Char <= u'Z'; Char++)
+			{
+				OwnedFoldedAsciiClasses[Char] = OwnedAsciiClasses[Fold(Char)];
+			}
+		}
+
+		// Already sorted by character
+		for (const auto& Pair : WideClasses)
+		{
+			OwnedWideChars.push_back(Pair.first);
+			OwnedWideCharClasses.push_back(Pair.second);
+		}
+
+		// Fuzzy seeds: MaxEditDistance + 1 disjoint pieces of every pattern long enough to have
+		// them. Each edit touches at most one piece, so a close match leaves one intact.
+		struct FSeed
+		{
+			int32_t PatternId;
+			int32_t Start;
+			int32_t End;
+		};
+		std::vector<FSeed> Seeds;
+		if (Tables.MaxEditDistance > 0)
+		{
+			const int32_t NumPieces = Tables.MaxEditDistance + 1;
+			for (int32_t PatternId = 0; PatternId < NumPatterns; PatternId++)
+			{
+				const std::u16string& Lower = LowerPatterns[PatternId];
+				const int32_t Len = (int32_t)Lower.size();
+				if (Len < Tables.MinFuzzyLength || Len > MaxFuzzyLength)
+				{
+					continue;
+				}
+
+				FSeed Pieces[MaxFuzzyEditDistance + 1];
+				int32_t NumCut = 0;
+				for (int32_t Piece = 0; Piece < NumPieces; Piece++)
+				{
+					// Separators at either end only make a seed match more often
+					int32_t Start = Piece * Len / NumPieces;
+					int32_t End = (Piece + 1) * Len / NumPieces;
+					while (Start < End && Lower[Start] == Normalizer::Separator)
+					{
+						Start++;
+					}
+					while (End > Start && Lower[End - 1] == Normalizer::Separator)
+					{
+						End--;
+					}
+
+					if (End - Start < PatternMatcher::MinSeedLength)
+					{
+						break;
+					}
+					Pieces[NumCut++] = { PatternId, Start, End };
+				}
+
+				if (NumCut == NumPieces)
+				{
+					Seeds.insert(Seeds.end(), Pieces, Pieces + NumCut);
+				}
+			}
+		}
+
+		// Trie (goto function), with IndexNone for missing edges. Seeds follow the patterns
+		// as output ids NumPatterns and up.
+		std::vector<std::vector<int32_t>> StateOutputs;
+		std::vector<int32_t> StateClasses;
+		OwnedTransitions.assign(NumClasses, IndexNone);
+		StateOutputs.emplace_back();
+		StateClasses.push_back(0);
+		int32_t NumStates = 1;
+
+		auto AddToTrie = [&](FTextView Lower, int32_t OutputId)
+		{
+			int32_t State = 0;
+			for (FChar Char : Lower)
+			{
+				const int32_t Class = GetCharClass(Char);
+				const int32_t Slot = State * NumClasses + Class;
+				if (OwnedTransitions[Slot] == IndexNone)
+				{
+					OwnedTransitions[Slot] = NumStates++;
+					OwnedTransitions.resize(OwnedTransitions.size() + NumClasses, IndexNone);
+					StateOutputs.emplace_back();
+					StateClasses.push_back(Class);
+				}
+				State = OwnedTransitions[Slot];
+			}
+			StateOutputs[State].push_back(OutputId);
+		};
+
+		for (int32_t PatternId = 0; PatternId < NumPatterns; PatternId++)
+		{
+			if (!LowerPatterns[PatternId].empty())
+			{
+				AddToTrie(LowerPatterns[PatternId], PatternId);
+			}
+		}
+
+		for (int32_t SeedIndex = 0; SeedIndex < (int32_t)Seeds.size(); SeedIndex++)
+		{
+			const FSeed& Seed = Seeds[SeedIndex];
+			AddToTrie(FTextView(LowerPatterns[Seed.PatternId]).substr(Seed.Start, Seed.End - Seed.Start), NumPatterns + SeedIndex);
+		}
+
+		// Breadth-first pass: failure links become DFA edges, and every state learns
+		// the nearest suffix state that reports a match
+		std::vector<int32_t> Failure(NumStates, 0);
+		OwnedDictionaryLinks.assign(NumStates, IndexNone);
+
+		std::vector<int32_t> Queue;
+		Queue.reserve(NumStates);
+
+		for (int32_t Class = 0; Class < NumClasses; Class++)
+		{
+			int32_t& Next = OwnedTransitions[Class];
+			if (Next == IndexNone)
+			{
+				Next = 0;
+			}
+			else
+			{
+				Queue.push_back(Next);
+			}
+		}
+
+		for (size_t Head = 0; Head < Queue.size(); Head++)
+		{
+			const int32_t State = Queue[Head];
+			const int32_t FailState = Failure[State];
+
+			OwnedDictionaryLinks[State] = !StateOutputs[FailState].empty() ? FailState : OwnedDictionaryLinks[FailState];
+
+			for (int32_t Class = 0; Class < NumClasses; Class++)
+			{
+				int32_t& Next = OwnedTransitions[State * NumClasses + Class];
+				const int32_t FailNext = OwnedTransitions[FailState * NumClasses + Class];
+				if (Next == IndexNone)
+				{
+					Next = FailNext;
+				}
+				else
+				{
+					Failure[Next] = FailNext;
+					Queue.push_back(Next);
+				}
+			}
+		}
+
+		// Normalized text: dropped characters leave the automaton where it is, and so does a
+		// separator right after one - every state entered on a separator loops on it. No
+		// pattern or seed starts with a separator, so at the root one changes nothing either.
+		if (Tables.bNormalized)
+		{
+			for (int32_t State = 0; State < NumStates; State++)
+			{
+				OwnedTransitions[State * NumClasses + Tables.SkipClass] = State;
+				if (Tables.SpaceClass != IndexNone && StateClasses[State] == Tables.SpaceClass)
+				{
+					OwnedTransitions[State * NumClasses + Tables.SpaceClass] = State;
+				}
+			}
+		}
+
+		// Flatten outputs so a scan touches two contiguous arrays
+		OwnedOutputOffsets.resize(NumStates + 1);
+		for (int32_t State = 0; State < NumStates; State++)
+		{
+			OwnedOutputOffsets[State] = (int32_t)OwnedOutputPatterns.size();
+			OwnedOutputPatterns.insert(OwnedOutputPatterns.end(), StateOutputs[State].begin(), StateOutputs[State].end());
+		}
+		OwnedOutputOffsets[NumStates] = (int32_t)OwnedOutputPatterns.size();
+
+		// Pattern metadata and original text, grouped per category for GetPattern
+		int32_t CategoryCounts[(int32_t)EPatternCategory::Count] = {};
+		for (const FPatternEntry& Entry : PendingPatterns)
+		{
+			OwnedPatternCategories.push_back((uint8_t)Entry.Category);
+			OwnedPatternCategoryIndices.push_back(CategoryCounts[(int32_t)Entry.Category]++);
+			OwnedPatternTextOffsets.push_back((int32_t)OwnedPatternText.size());
+			OwnedPatternText.insert(OwnedPatternText.end(), Entry.Text.begin(), Entry.Text.end());
+			OwnedPatternText.push_back(u'\0');
+		}
+
+		OwnedCategoryOffsets.resize((int32_t)EPatternCategory::Count + 1);
+		for (int32_t Category = 0; Category < (int32_t)EPatternCategory::Count; Category++)
+		{
+			OwnedCategoryOffsets[Category] = (int32_t)OwnedCategoryPatterns.size();
+			for (int32_t PatternId = 0; PatternId < NumPatterns; PatternId++)
+			{
+				if ((int32_t)PendingPatterns[PatternId].Category == Category)
+				{
+					OwnedCategoryPatterns.push_back(PatternId);
+				}
+			}
+		}
+		OwnedCategoryOffsets[(int32_t)EPatternCategory::Count] = (int32_t)OwnedCategoryPatterns.size();
+
+		// Seeds and the class strings their patterns are verified against
+		if (!Seeds.empty())
+		{
+			OwnedFuzzyOffsets.resize(NumPatterns + 1);
+			size_t NextSeed = 0;
+			for (int32_t PatternId = 0; PatternId < NumPatterns; PatternId++)
+			{
+				OwnedFuzzyOffsets[PatternId] = (int32_t)OwnedFuzzyClasses.size();
+				if (NextSeed < Seeds.size() && Seeds[NextSeed].PatternId == PatternId)
+				{
+					for (FChar Char : LowerPatterns[PatternId])
+					{
+						OwnedFuzzyClasses.push_back((uint16_t)GetCharClass(Char));
+					}
+					NumFuzzyPatterns++;
+
+					while (NextSeed < Seeds.size() && Seeds[NextSeed].PatternId == PatternId)
+					{
+						NextSeed++;
+					}
+				}
+			}
+			OwnedFuzzyOffsets[NumPatterns] = (int32_t)OwnedFuzzyClasses.size();
+
+			for (const FSeed& Seed : Seeds)
+			{
+				OwnedSeedPatterns.push_back(Seed.PatternId);
+				OwnedSeedEnds.push_back(Seed.End);
+			}
+		}
+
+		PendingPatterns.clear();
+
+		Tables.NumClasses = NumClasses;
+		Tables.NumStates = NumStates;
+		Tables.AsciiClasses = OwnedAsciiClasses;
+		Tables.FoldedAsciiClasses = OwnedFoldedAsciiClasses;
+		Tables.WideChars = OwnedWideChars;
+		Tables.WideCharClasses = OwnedWideCharClasses;
+		Tables.Transitions = OwnedTransitions;
+		Tables.OutputOffsets = OwnedOutputOffsets;
+		Tables.OutputPatterns = OwnedOutputPatterns;
+		Tables.DictionaryLinks = OwnedDictionaryLinks;
+		Tables.PatternCategories = OwnedPatternCategories;
+		Tables.PatternCategoryIndices = OwnedPatternCategoryIndices;
+		Tables.PatternTextOffsets = OwnedPatternTextOffsets;
+		Tables.PatternText = OwnedPatternText;
+		Tables.CategoryOffsets = OwnedCategoryOffsets;
+		Tables.CategoryPatterns = OwnedCategoryPatterns;
+		Tables.SeedPatterns = OwnedSeedPatterns;
+		Tables.SeedEnds = OwnedSeedEnds;
+		Tables.FuzzyOffsets = OwnedFuzzyOffsets;
+		Tables.FuzzyClasses = OwnedFuzzyClasses;
+
+		BuildPrefilter();
+		bCompiled = true;
+	}
+
+	void FPatternMatcher::BuildPrefilter()
+	{
+		// Normalized text and seeds start matches at far more characters than the first few of
+		// each pattern (leetspeak, confusables, seeds mid-pattern), so filter on whatever leaves
+		// the root instead - one character deep
+		if (Tables.bNormalized || Tables.SeedPatterns.Num() > 0)
+		{
+			auto StartsMatch = [this](int32_t Class)
+			{
+				return Class != 0 && Tables.Transitions[Class] != 0;
+			};
+
+			for (int32_t Char = 0; Char < 128; Char++)
+			{
+				const FChar Candidate = (FChar)Char;
+				if ((uint32_t)Char - 'A' >= 26u && StartsMatch(Tables.FoldedAsciiClasses[Char]))
+				{
+					Prefilter.AddPattern(FTextView(&Candidate, 1));
+				}
+			}
+
+			// Non-ASCII characters share one slot, so one of them covers the rest
+			for (int32_t Index = 0; Index < Tables.WideChars.Num(); Index++)
+			{
+				if (StartsMatch(Tables.WideCharClasses[Index]))
+				{
+					Prefilter.AddPattern(FTextView(&Tables.WideChars[Index], 1));
+					break;
+				}
+			}
+			return;
+		}
+
+		// Only the first few characters of each pattern matter
+		for (int32_t PatternId = 0; PatternId < Tables.PatternCategories.Num(); PatternId++)
+		{
+			const FChar* Pattern = &Tables.PatternText[Tables.PatternTextOffsets[PatternId]];
+
+			FChar Folded[FPatternPrefilter::NumPrefixChars];
+			int32_t Len = 0;
+			while (Len < FPatternPrefilter::NumPrefixChars && Pattern[Len] != u'\0')
+			{
+				Folded[Len] = Fold(Pattern[Len]);
+				Len++;
+			}
+			Prefilter.AddPattern(FTextView(Folded, Len));
+		}
+	}
+
+	void FPatternMatcher::Scan(FTextView Text, FScanResult& OutResult) const
+	{
+		OutResult.Reset();
+		ScanChunk(Text, 0, OutResult);
+	}
+
+	void FPatternMatcher::ScanBatch(const FTextView* Texts, int32_t Num, FScanResult* OutResults) const
+	{
+		for (int32_t Index = 0; Index < Num; Index++)
+		{
+			Scan(Texts[Index], OutResults[Index]);
+		}
+	}
+
+	int32_t FPatternMatcher::ScanChunk(FTextView Text, int32_t State, FScanResult& InOutResult) const
+	{
+		return ScanRange(Text, 0, (int32_t)Text.size(), State, InOutResult);
+	}
+
+	int32_t FPatternMatcher::ScanRange(FTextView Text, int32_t Start, int32_t End, int32_t State, FScanResult& InOutResult,
+		FPendingSeeds* OutPending) const
+	{
+		assert(bCompiled);
+		assert(Start >= 0 && Start <= End && End <= (int32_t)Text.size());
+
+		if (Tables.OutputPatterns.Num() == 0)
+		{
+			return 0;
+		}
+
+		const int32_t NumClasses = Tables.NumClasses;
+		const int32_t NumPatterns = Tables.PatternCategories.Num();
+		const int32_t* Transitions = Tables.Transitions.GetData();
+		const int32_t* OutputOffsets = Tables.OutputOffsets.GetData();
+		const int32_t* OutputPatterns = Tables.OutputPatterns.GetData();
+		const int32_t* DictionaryLinks = Tables.DictionaryLinks.GetData();
+
+		const FChar* Chars = Text.data();
+		const bool bPrefilter = Prefilter.IsActive();
+
+		for (int32_t Index = Start; Index < End; Index++)
+		{
+			// Nothing is partially matched at the root, so nothing is lost by jumping
+			// straight to the next place a pattern could start
+			if (State == 0 && bPrefilter)
+			{
+				Index = Prefilter.FindCandidate(Chars, Index, End);
+				if (Index == End)
+				{
+					break;
+				}
+			}
+
+			State = Transitions[State * NumClasses + GetFoldedCharClass(Chars[Index])];
+
+			for (int32_t Match = State; Match != IndexNone; Match = DictionaryLinks[Match])
+			{
+				for (int32_t Output = OutputOffsets[Match]; Output < OutputOffsets[Match + 1]; Output++)
+				{
+					int32_t PatternId = OutputPatterns[Output];
+					int32_t SeedIndex = IndexNone;
+					if (PatternId >= NumPatterns)
+					{
+						SeedIndex = PatternId - NumPatterns;
+						PatternId = Tables.SeedPatterns[SeedIndex];
+					}
+
+					// A seed only counts once the whole pattern is close enough around it, and
+					// isn't worth verifying if it can't improve on what's already been found
+					const int32_t CategoryIndex = Tables.PatternCategoryIndices[PatternId];
+					int32_t& First = InOutResult.FirstMatch[Tables.PatternCategories[PatternId]];
+					if (First != IndexNone && CategoryIndex >= First)
+					{
+						continue;
+					}
+
+					bool bCutShort = false;
+					if (SeedIndex == IndexNone || VerifySeed(Text, Index, SeedIndex, OutPending ? &bCutShort : nullptr))
+					{
+						First = CategoryIndex;
+					}
+					else if (bCutShort)
+					{
+						OutPending->Seeds.push_back({ Index, SeedIndex });
+					}
+				}
+			}
+		}
+
+		return State;
+	}
+
+	void FPatternMatcher::VerifyPending(FTextView Text, FPendingSeeds& InOutPending, FScanResult& InOutResult) const
+	{
+		assert(bCompiled);
+
+		// Results only ever keep the lowest index per category, so the order seeds settle in doesn't matter
+		size_t NumKept = 0;
+		for (const FPendingSeeds::FSeed& Seed : InOutPending.Seeds)
+		{
+			const int32_t PatternId = Tables.SeedPatterns[Seed.SeedIndex];
+			const int32_t CategoryIndex = Tables.PatternCategoryIndices[PatternId];
+			int32_t& First = InOutResult.FirstMatch[Tables.PatternCategories[PatternId]];
+			if (First != IndexNone && CategoryIndex >= First)
+			{
+				continue;
+			}
+
+			bool bCutShort = false;
+			if (VerifySeed(Text, Seed.Index, Seed.SeedIndex, &bCutShort))
+			{
+				First = CategoryIndex;
+			}
+			else if (bCutShort)
+			{
+				InOutPending.Seeds[NumKept++] = Seed;
+			}
+		}
+		InOutPending.Seeds.resize(NumKept);
+	}
+
+	bool FPatternMatcher::ScanFirst(FTextView Text, EPatternCategory& OutCategory) const
+	{
+		assert(bCompiled);
+
+		if (Tables.OutputPatterns.Num() == 0)
+		{
+			return false;
+		}
+
+		const int32_t NumClasses = Tables.NumClasses;
+		const int32_t NumPatterns = Tables.PatternCategories.Num();
+		const int32_t* Transitions = Tables.Transitions.GetData();
+		const int32_t* OutputOffsets = Tables.OutputOffsets.GetData();
+		const int32_t* OutputPatterns = Tables.OutputPatterns.GetData();
+		const int32_t* DictionaryLinks = Tables.DictionaryLinks.GetData();
+
+		const FChar* Chars = Text.data();
+		const int32_t Len = (int32_t)Text.size();
+		const bool bPrefilter = Prefilter.IsActive();
+
+		int32_t State = 0;
+		for (int32_t Index = 0; Index < Len; Index++)
+		{
+			if (State == 0 && bPrefilter)
+			{
+				Index = Prefilter.FindCandidate(Chars, Index, Len);
+				if (Index == Len)
+				{
+					break;
+				}
+			}
+
+			State = Transitions[State * NumClasses + GetFoldedCharClass(Chars[Index])];
+
+			// Own outputs first, then the nearest suffix state that has any. Without seeds
+			// the first output found is always an exact match.
+			const int32_t Match = OutputOffsets[State] < OutputOffsets[State + 1] ? State : DictionaryLinks[State];
+			for (int32_t Hit = Match; Hit != IndexNone; Hit = DictionaryLinks[Hit])
+			{
+				for (int32_t Output = OutputOffsets[Hit]; Output < OutputOffsets[Hit + 1]; Output++)
+				{
+					const int32_t PatternId = OutputPatterns[Output];
+					if (PatternId < NumPatterns)
+					{
+						OutCategory = (EPatternCategory)Tables.PatternCategories[PatternId];
+						return true;
+					}
+					if (VerifySeed(Text, Index, PatternId - NumPatterns))
+					{
+						OutCategory = (EPatternCategory)Tables.PatternCategories[Tables.SeedPatterns[PatternId - NumPatterns]];
+						return true;
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+	bool FPatternMatcher::VerifySeed(FTextView Text, int32_t Index, int32_t SeedIndex, bool* bOutCutShort) const
+	{
+		const int32_t PatternId = Tables.SeedPatterns[SeedIndex];
+		const int32_t PatternStart = Tables.FuzzyOffsets[PatternId];
+		const int32_t PatternLen = Tables.FuzzyOffsets[PatternId + 1] - PatternStart;
+		const uint16_t* Pattern = &Tables.FuzzyClasses[PatternStart];
+		const int32_t MaxEdits = Tables.MaxEditDistance;
+		const int32_t SeedEnd = Tables.SeedEnds[SeedIndex];
+
+		// A match within MaxEdits edits reaches no further than this either side of the
+		// seed's last character (which Index is on)
+		const int32_t NumBefore = SeedEnd + MaxEdits;
+		const int32_t NumAfter = PatternLen - SeedEnd + MaxEdits;
+
+		// The classes the automaton actually saw there: dropped characters and repeated
+		// separators left out, and a long run of them not walked to the end
+		constexpr int32_t HalfWindow = MaxFuzzyLength + MaxFuzzyEditDistance;
+		constexpr int32_t MaxSteps = 4 * HalfWindow;
+		uint16_t Window[2 * HalfWindow];
+		int32_t Begin = HalfWindow;
+		int32_t End = HalfWindow;
+
+		const FChar* Chars = Text.data();
+		const int32_t Len = (int32_t)Text.size();
+		int32_t Previous = IndexNone;
+		for (int32_t Pos = Index, Steps = 0; Pos >= 0 && HalfWindow - Begin < NumBefore && Steps < MaxSteps; Pos--, Steps++)
+		{
+			const int32_t Class = GetFoldedCharClass(Chars[Pos]);
+			if (Class == Tables.SkipClass || (Class == Tables.SpaceClass && Class == Previous))
+			{
+				continue;
+			}
+			Window[--Begin] = (uint16_t)Class;
+			Previous = Class;
+		}
+
+		Previous = Begin < HalfWindow ? Window[HalfWindow - 1] : IndexNone;
+		int32_t Ahead = Index + 1;
+		int32_t AheadSteps = 0;
+		for (; Ahead < Len && End - HalfWindow < NumAfter && AheadSteps < MaxSteps; Ahead++, AheadSteps++)
+		{
+			const int32_t Class = GetFoldedCharClass(Chars[Ahead]);
+			if (Class == Tables.SkipClass || (Class == Tables.SpaceClass && Class == Previous))
+			{
+				continue;
+			}
+			Window[End++] = (uint16_t)Class;
+			Previous = Class;
+		}
+
+		// Only the forward walk can be stopped by the text ending - a text that grows keeps its start
+		if (bOutCutShort)
+		{
+			*bOutCutShort = Ahead == Len && End - HalfWindow < NumAfter && AheadSteps < MaxSteps;
+		}
+
+		// Bit-parallel Levenshtein (Wu-Manber): bit J of Active[Edits] is set while the window
+		// so far ends in something within Edits edits of the pattern's first J + 1 classes
+		uint64_t Active[MaxFuzzyEditDistance + 1];
+		for (int32_t Edits = 0; Edits <= MaxEdits; Edits++)
+		{
+			Active[Edits] = (1ull << Edits) - 1;
+		}
+		const uint64_t Accept = 1ull << (PatternLen - 1);
+
+		for (int32_t Pos = Begin; Pos < End; Pos++)
+		{
+			uint64_t Mask = 0;
+			for (int32_t J = 0; J < PatternLen; J++)
+			{
+				Mask |= (uint64_t)(Pattern[J] == Window[Pos]) << J;
+			}
+
+			uint64_t Below = Active[0];
+			Active[0] = ((Active[0] << 1) | 1) & Mask;
+			for (int32_t Edits = 1; Edits <= MaxEdits; Edits++)
+			{
+				const uint64_t Old = Active[Edits];
+				Active[Edits] = (((Old << 1) | 1) & Mask)      // Match
+					| ((Below << 1) | 1)                         // Substitution
+					| Below                                      // Extra character in the text
+					| ((Active[Edits - 1] << 1) | 1);            // Character missing from the text
+				Below = Old;
+			}
+
+			if (Active[MaxEdits] & Accept)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	const FChar* FPatternMatcher::GetPattern(EPatternCategory Category, int32_t Index) const
+	{
+		const int32_t PatternId = Tables.CategoryPatterns[Tables.CategoryOffsets[(int32_t)Category] + Index];
+		return &Tables.PatternText[Tables.PatternTextOffsets[PatternId]];
+	}
+}
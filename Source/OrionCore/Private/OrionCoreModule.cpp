@@ -0,0 +1,6 @@
+// OrionCore - Unreal module
+// Lets the engine load the core; the Python build leaves this file out
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, OrionCore)
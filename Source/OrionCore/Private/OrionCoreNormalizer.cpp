@@ -0,0 +1,223 @@
+// OrionCore - Text skeletons
+// One-to-one character mapping behind normalized pattern matching
+
+#include "OrionCoreNormalizer.h"
+#include <algorithm>
+
+namespace OrionCore::Normalizer
+{
+	// Base letter of U+00C0-U+00FF; '.' keeps the character as it is
+	static const char Latin1Letters[] =
+		"aaaaaaaceeeeiiii"
+		"dnooooo.ouuuuy.."
+		"aaaaaaaceeeeiiii"
+		"dnooooo.ouuuuy.y";
+	static_assert(sizeof(Latin1Letters) == 64 + 1, "One entry per U+00C0-U+00FF");
+
+	// Base letter of U+0100-U+017F
+	static const char LatinExtendedALetters[] =
+		"aaaaaa" "cccccccc" "dddd" "eeeeeeeeee" "gggggggg" "hhhh" "iiiiiiiiii" "ii" "jj" "kkk"
+		"llllllllll" "nnnnnnnnn" "oooooo" "oo" "rrrrrr" "ssssssss" "tttttt" "uuuuuuuuuuuu"
+		"ww" "yyy" "zzzzzz" "s";
+	static_assert(sizeof(LatinExtendedALetters) == 128 + 1, "One entry per U+0100-U+017F");
+
+	struct FConfusable
+	{
+		uint16_t Code;
+		char Letter;
+	};
+
+	// Letters from other scripts that pass for Latin ones, sorted by code point
+	static const FConfusable Confusables[] =
+	{
+		{ 0x0251, 'a' }, { 0x0261, 'g' }, { 0x026A, 'i' },
+		// Greek
+		{ 0x0391, 'a' }, { 0x0392, 'b' }, { 0x0395, 'e' }, { 0x0396, 'z' }, { 0x0397, 'h' }, { 0x0399, 'i' },
+		{ 0x039A, 'k' }, { 0x039C, 'm' }, { 0x039D, 'n' }, { 0x039F, 'o' }, { 0x03A1, 'p' }, { 0x03A4, 't' },
+		{ 0x03A5, 'y' }, { 0x03A7, 'x' }, { 0x03B1, 'a' }, { 0x03B2, 'b' }, { 0x03B5, 'e' }, { 0x03B9, 'i' },
+		{ 0x03BA, 'k' }, { 0x03BD, 'v' }, { 0x03BF, 'o' }, { 0x03C1, 'p' }, { 0x03C4, 't' }, { 0x03C5, 'u' },
+		{ 0x03C7, 'x' },
+		// Cyrillic
+		{ 0x0400, 'e' }, { 0x0401, 'e' }, { 0x0405, 's' }, { 0x0406, 'i' }, { 0x0407, 'i' }, { 0x0408, 'j' },
+		{ 0x0410, 'a' }, { 0x0412, 'b' }, { 0x0415, 'e' }, { 0x041A, 'k' }, { 0x041C, 'm' }, { 0x041D, 'h' },
+		{ 0x041E, 'o' }, { 0x0420, 'p' }, { 0x0421, 'c' }, { 0x0422, 't' }, { 0x0423, 'y' }, { 0x0425, 'x' },
+		{ 0x0430, 'a' }, { 0x0432, 'b' }, { 0x0435, 'e' }, { 0x043A, 'k' }, { 0x043C, 'm' }, { 0x043D, 'h' },
+		{ 0x043E, 'o' }, { 0x0440, 'p' }, { 0x0441, 'c' }, { 0x0442, 't' }, { 0x0443, 'y' }, { 0x0445, 'x' },
+		{ 0x0450, 'e' }, { 0x0451, 'e' }, { 0x0455, 's' }, { 0x0456, 'i' }, { 0x0457, 'i' }, { 0x0458, 'j' },
+		{ 0x04BB, 'h' }, { 0x0501, 'd' }, { 0x051B, 'q' }, { 0x051D, 'w' },
+		// Letterlike symbols
+		{ 0x2113, 'l' }, { 0x212A, 'k' }, { 0x212B, 'a' }
+	};
+
+	static FChar NormalizeAscii(FChar Char)
+	{
+		if ((uint32_t)Char - 'A' < 26u)
+		{
+			Char = (FChar)(Char + 32);
+		}
+		if ((uint32_t)Char - 'a' < 26u)
+		{
+			return Char == u'l' ? u'i' : Char;
+		}
+
+		switch (Char)
+		{
+		case u'0':
+			return u'o';
+		case u'1': case u'!': case u'|':
+			return u'i';
+		case u'3':
+			return u'e';
+		case u'4': case u'@':
+			return u'a';
+		case u'5': case u'$':
+			return u's';
+		case u'7': case u'+':
+			return u't';
+		case u'.': case u'-': case u'_': case u'*': case u'\'': case u'`':
+			return Dropped;
+		case u'\t': case u'\n': case u'\v': case u'\f': case u'\r':
+			return Separator;
+		default:
+			break;
+		}
+
+		if ((uint32_t)Char - '0' < 10u)
+		{
+			return Char;
+		}
+		if (Char < 0x20 || Char == 0x7F)
+		{
+			return Dropped;
+		}
+		return Separator;
+	}
+
+	static bool IsDropped(uint32_t Code)
+	{
+		return Code == 0x00AD || Code == 0x00B7 || Code == 0x061C || Code == 0x115F || Code == 0x1160
+			|| Code == 0x17B4 || Code == 0x17B5 || Code == 0x3164 || Code == 0xFEFF || Code == 0xFFA0
+			|| (Code >= 0x0300 && Code <= 0x036F)      // Combining diacritics
+			|| (Code >= 0x180B && Code <= 0x180F)
+			|| (Code >= 0x200B && Code <= 0x200F)      // Zero-width spaces and joiners, direction marks
+			|| (Code >= 0x2010 && Code <= 0x2015)      // Hyphens and dashes
+			|| (Code >= 0x2018 && Code <= 0x201B)      // Single quotes
+			|| (Code >= 0x2022 && Code <= 0x2027)      // Bullet, leaders, ellipsis
+			|| (Code >= 0x202A && Code <= 0x202E)      // Bidi embedding and overrides
+			|| (Code >= 0x2060 && Code <= 0x2064)
+			|| (Code >= 0x2066 && Code <= 0x206F)
+			|| (Code >= 0xFE00 && Code <= 0xFE0F);     // Variation selectors
+	}
+
+	static bool IsSeparator(uint32_t Code)
+	{
+		return Code == 0x00A0 || Code == 0x00AB || Code == 0x00BB || Code == 0x1680
+			|| Code == 0x2028 || Code == 0x2029 || Code == 0x202F || Code == 0x205F
+			|| (Code >= 0x2000 && Code <= 0x200A)      // Typographic spaces
+			|| (Code >= 0x201C && Code <= 0x201F)      // Double quotes
+			|| (Code >= 0x3000 && Code <= 0x3002);     // Ideographic space, comma, full stop
+	}
+
+	FChar Normalize(FChar Char)
+	{
+		const uint32_t Code = (uint32_t)Char;
+		if (Code < 128)
+		{
+			return NormalizeAscii(Char);
+		}
+
+		if (IsDropped(Code))
+		{
+			return Dropped;
+		}
+		if (IsSeparator(Code))
+		{
+			return Separator;
+		}
+
+		// Full-width forms read as the ASCII they are a wide copy of
+		if (Code >= 0xFF01 && Code <= 0xFF5E)
+		{
+			return NormalizeAscii((FChar)(Code - 0xFEE0));
+		}
+
+		if (Code >= 0xC0 && Code <= 0xFF)
+		{
+			const char Letter = Latin1Letters[Code - 0xC0];
+			return Letter != '.' ? NormalizeAscii((FChar)Letter) : Char;
+		}
+		if (Code >= 0x100 && Code <= 0x17F)
+		{
+			return NormalizeAscii((FChar)LatinExtendedALetters[Code - 0x100]);
+		}
+
+		// Super/subscript and circled digits and letters
+		switch (Code)
+		{
+		case 0x00B2: return NormalizeAscii(u'2');
+		case 0x00B3: return NormalizeAscii(u'3');
+		case 0x00B9: return NormalizeAscii(u'1');
+		case 0x2070: return NormalizeAscii(u'0');
+		case 0x2071: return u'i';
+		case 0x207F: return u'n';
+		case 0x24EA: return NormalizeAscii(u'0');
+		default: break;
+		}
+		if (Code >= 0x2074 && Code <= 0x2079)
+		{
+			return NormalizeAscii((FChar)(u'4' + (Code - 0x2074)));
+		}
+		if (Code >= 0x2080 && Code <= 0x2089)
+		{
+			return NormalizeAscii((FChar)(u'0' + (Code - 0x2080)));
+		}
+		if (Code >= 0x2460 && Code <= 0x2468)
+		{
+			return NormalizeAscii((FChar)(u'1' + (Code - 0x2460)));
+		}
+		if (Code >= 0x24B6 && Code <= 0x24CF)
+		{
+			return NormalizeAscii((FChar)(u'a' + (Code - 0x24B6)));
+		}
+		if (Code >= 0x24D0 && Code <= 0x24E9)
+		{
+			return NormalizeAscii((FChar)(u'a' + (Code - 0x24D0)));
+		}
+
+		const FConfusable* const ConfusablesEnd = Confusables + sizeof(Confusables) / sizeof(Confusables[0]);
+		const FConfusable* Found = std::lower_bound(Confusables, ConfusablesEnd, Code,
+			[](const FConfusable& Entry, uint32_t Value) { return Entry.Code < Value; });
+		if (Found != ConfusablesEnd && Found->Code == Code)
+		{
+			return NormalizeAscii((FChar)Found->Letter);
+		}
+
+		return Char;
+	}
+
+	std::u16string NormalizeText(FTextView Text)
+	{
+		std::u16string Normalized;
+		Normalized.reserve(Text.size());
+
+		for (FChar Char : Text)
+		{
+			const FChar Skeleton = Normalize(Char);
+			if (Skeleton == Dropped)
+			{
+				continue;
+			}
+			if (Skeleton == Separator && (Normalized.empty() || Normalized.back() == Separator))
+			{
+				continue;
+			}
+			Normalized.push_back(Skeleton);
+		}
+
+		if (!Normalized.empty() && Normalized.back() == Separator)
+		{
+			Normalized.pop_back();
+		}
+		return Normalized;
+	}
+}
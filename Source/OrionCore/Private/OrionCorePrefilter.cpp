@@ -0,0 +1,508 @@
+// OrionCore - SIMD prefilters
+// Skips clean text a vector at a time before the pattern matcher and PII rules run
+
+#include "OrionCorePrefilter.h"
+#include <algorithm>
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define ORION_PREFILTER_X86 1
+	#define ORION_PREFILTER_NEON 0
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define ORION_PREFILTER_X86 0
+	#define ORION_PREFILTER_NEON 1
+#else
+	#define ORION_PREFILTER_X86 0
+	#define ORION_PREFILTER_NEON 0
+#endif
+
+#if ORION_PREFILTER_X86
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+
+	// Neither instruction set is assumed to be the build's baseline, so their kernels are
+	// compiled for them individually and only called once the CPU says it has them
+	#if defined(__clang__) || defined(__GNUC__)
+		#define ORION_TARGET_SSE41 __attribute__((target("sse4.1")))
+		#define ORION_TARGET_AVX2 __attribute__((target("avx2")))
+	#else
+		#define ORION_TARGET_SSE41
+		#define ORION_TARGET_AVX2
+	#endif
+#elif ORION_PREFILTER_NEON
+	#include <arm_neon.h>
+#endif
+
+namespace OrionCore::Prefilter
+{
+	static inline int32_t CountTrailingZeros(uint32_t Value)
+	{
+#if defined(_MSC_VER)
+		unsigned long Index;
+		_BitScanForward(&Index, Value);
+		return (int32_t)Index;
+#else
+		return __builtin_ctz(Value);
+#endif
+	}
+
+	static inline int32_t CountTrailingZeros64(uint64_t Value)
+	{
+#if defined(_MSC_VER)
+		unsigned long Index;
+		_BitScanForward64(&Index, Value);
+		return (int32_t)Index;
+#else
+		return __builtin_ctzll(Value);
+#endif
+	}
+
+	using FMasks = FPatternPrefilter::FMasks;
+
+	// Upper-case ASCII folds to lower case; every non-ASCII character shares slot 0x80
+	static constexpr uint8_t WideSlot = 0x80;
+
+	static inline uint8_t ToSlot(FChar Char)
+	{
+		const uint32_t Code = (uint32_t)Char;
+		const uint32_t Folded = (Code - 'A' < 26u) ? Code + 32 : Code;
+		return Folded < 0x80 ? (uint8_t)Folded : WideSlot;
+	}
+
+	static inline bool IsPiiChar(FChar Char)
+	{
+		return (uint32_t)Char - '0' < 10u || Char == u'@';
+	}
+
+	static constexpr int32_t NumPrefixChars = FPatternPrefilter::NumPrefixChars;
+
+	static int32_t FindCandidateScalar(const FMasks& Masks, const FChar* Text, int32_t Start, int32_t End)
+	{
+		for (int32_t Index = Start; Index < End; Index++)
+		{
+			// Characters past the end of the text (or chunk) aren't known yet, so they
+			// can't rule a bucket out
+			uint8_t Buckets = 0xFF;
+			for (int32_t Offset = 0; Offset < NumPrefixChars && Buckets != 0 && Index + Offset < End; Offset++)
+			{
+				const uint8_t Slot = ToSlot(Text[Index + Offset]);
+				Buckets &= Masks.Low[Offset][Slot & 15] & Masks.High[Offset][Slot >> 4];
+			}
+
+			if (Buckets != 0)
+			{
+				return Index;
+			}
+		}
+		return End;
+	}
+
+	static int32_t FindPiiCandidateScalar(const FChar* Text, int32_t Start, int32_t End)
+	{
+		for (int32_t Index = Start; Index < End; Index++)
+		{
+			if (IsPiiChar(Text[Index]))
+			{
+				return Index;
+			}
+		}
+		return End;
+	}
+
+#if ORION_PREFILTER_X86
+	// 8 characters -> 8 slots, still 16-bit
+	ORION_TARGET_SSE41 static inline __m128i FoldToSlots(__m128i Chars)
+	{
+		const __m128i Offset = _mm_sub_epi16(Chars, _mm_set1_epi16('A'));
+		const __m128i IsUpper = _mm_cmpeq_epi16(_mm_min_epu16(Offset, _mm_set1_epi16(25)), Offset);
+		Chars = _mm_add_epi16(Chars, _mm_and_si128(IsUpper, _mm_set1_epi16(32)));
+		return _mm_min_epu16(Chars, _mm_set1_epi16(WideSlot));
+	}
+
+	// 16 characters -> 16 byte slots
+	ORION_TARGET_SSE41 static inline __m128i LoadSlots(const FChar* Text)
+	{
+		const __m128i Low = FoldToSlots(_mm_loadu_si128((const __m128i*)Text));
+		const __m128i High = FoldToSlots(_mm_loadu_si128((const __m128i*)(Text + 8)));
+		return _mm_packus_epi16(Low, High);
+	}
+
+	ORION_TARGET_SSE41 static inline __m128i LookupBuckets(__m128i Slots, __m128i LowTable, __m128i HighTable)
+	{
+		const __m128i NibbleMask = _mm_set1_epi8(0x0F);
+		const __m128i LowBuckets = _mm_shuffle_epi8(LowTable, _mm_and_si128(Slots, NibbleMask));
+		const __m128i HighBuckets = _mm_shuffle_epi8(HighTable, _mm_and_si128(_mm_srli_epi16(Slots, 4), NibbleMask));
+		return _mm_and_si128(LowBuckets, HighBuckets);
+	}
+
+	ORION_TARGET_SSE41 static inline __m128i IsPiiChar8(__m128i Chars)
+	{
+		const __m128i Offset = _mm_sub_epi16(Chars, _mm_set1_epi16('0'));
+		const __m128i IsDigit = _mm_cmpeq_epi16(_mm_min_epu16(Offset, _mm_set1_epi16(9)), Offset);
+		return _mm_or_si128(IsDigit, _mm_cmpeq_epi16(Chars, _mm_set1_epi16('@')));
+	}
+
+	ORION_TARGET_SSE41 static int32_t FindCandidateSSE(const FMasks& Masks, const FChar* Text, int32_t Start, int32_t End)
+	{
+		__m128i Low[NumPrefixChars];
+		__m128i High[NumPrefixChars];
+		for (int32_t Offset = 0; Offset < NumPrefixChars; Offset++)
+		{
+			Low[Offset] = _mm_load_si128((const __m128i*)Masks.Low[Offset]);
+			High[Offset] = _mm_load_si128((const __m128i*)Masks.High[Offset]);
+		}
+
+		// Each block also reads the characters after it, for the later prefix offsets
+		int32_t Index = Start;
+		for (; Index + 16 + NumPrefixChars - 1 <= End; Index += 16)
+		{
+			__m128i Buckets = LookupBuckets(LoadSlots(Text + Index), Low[0], High[0]);
+			for (int32_t Offset = 1; Offset < NumPrefixChars; Offset++)
+			{
+				Buckets = _mm_and_si128(Buckets, LookupBuckets(LoadSlots(Text + Index + Offset), Low[Offset], High[Offset]));
+			}
+
+			const uint32_t Hits = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(Buckets, _mm_setzero_si128())) ^ 0xFFFFu;
+			if (Hits != 0)
+			{
+				return Index + (int32_t)CountTrailingZeros(Hits);
+			}
+		}
+		return FindCandidateScalar(Masks, Text, Index, End);
+	}
+
+	ORION_TARGET_SSE41 static int32_t FindPiiCandidateSSE(const FChar* Text, int32_t Start, int32_t End)
+	{
+		int32_t Index = Start;
+		for (; Index + 16 <= End; Index += 16)
+		{
+			const __m128i Low = IsPiiChar8(_mm_loadu_si128((const __m128i*)(Text + Index)));
+			const __m128i High = IsPiiChar8(_mm_loadu_si128((const __m128i*)(Text + Index + 8)));
+
+			const uint32_t Hits = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(Low, High));
+			if (Hits != 0)
+			{
+				return Index + (int32_t)CountTrailingZeros(Hits);
+			}
+		}
+		return FindPiiCandidateScalar(Text, Index, End);
+	}
+
+	ORION_TARGET_AVX2 static inline __m256i FoldToSlotsAVX2(__m256i Chars)
+	{
+		const __m256i Offset = _mm256_sub_epi16(Chars, _mm256_set1_epi16('A'));
+		const __m256i IsUpper = _mm256_cmpeq_epi16(_mm256_min_epu16(Offset, _mm256_set1_epi16(25)), Offset);
+		Chars = _mm256_add_epi16(Chars, _mm256_and_si256(IsUpper, _mm256_set1_epi16(32)));
+		return _mm256_min_epu16(Chars, _mm256_set1_epi16(WideSlot));
+	}
+
+	// Packing works per 128-bit lane, so the quarters come out as 0, 2, 1, 3
+	ORION_TARGET_AVX2 static inline __m256i PackInOrderAVX2(__m256i Low, __m256i High)
+	{
+		return _mm256_permute4x64_epi64(_mm256_packus_epi16(Low, High), _MM_SHUFFLE(3, 1, 2, 0));
+	}
+
+	ORION_TARGET_AVX2 static inline __m256i LoadSlotsAVX2(const FChar* Text)
+	{
+		const __m256i Low = FoldToSlotsAVX2(_mm256_loadu_si256((const __m256i*)Text));
+		const __m256i High = FoldToSlotsAVX2(_mm256_loadu_si256((const __m256i*)(Text + 16)));
+		return PackInOrderAVX2(Low, High);
+	}
+
+	ORION_TARGET_AVX2 static inline __m256i LookupBucketsAVX2(__m256i Slots, __m256i LowTable, __m256i HighTable)
+	{
+		const __m256i NibbleMask = _mm256_set1_epi8(0x0F);
+		const __m256i LowBuckets = _mm256_shuffle_epi8(LowTable, _mm256_and_si256(Slots, NibbleMask));
+		const __m256i HighBuckets = _mm256_shuffle_epi8(HighTable, _mm256_and_si256(_mm256_srli_epi16(Slots, 4), NibbleMask));
+		return _mm256_and_si256(LowBuckets, HighBuckets);
+	}
+
+	ORION_TARGET_AVX2 static inline __m256i IsPiiChar16AVX2(__m256i Chars)
+	{
+		const __m256i Offset = _mm256_sub_epi16(Chars, _mm256_set1_epi16('0'));
+		const __m256i IsDigit = _mm256_cmpeq_epi16(_mm256_min_epu16(Offset, _mm256_set1_epi16(9)), Offset);
+		return _mm256_or_si256(IsDigit, _mm256_cmpeq_epi16(Chars, _mm256_set1_epi16('@')));
+	}
+
+	ORION_TARGET_AVX2 static int32_t FindCandidateAVX2(const FMasks& Masks, const FChar* Text, int32_t Start, int32_t End)
+	{
+		// Lane-local shuffles need the tables in both lanes
+		__m256i Low[NumPrefixChars];
+		__m256i High[NumPrefixChars];
+		for (int32_t Offset = 0; Offset < NumPrefixChars; Offset++)
+		{
+			Low[Offset] = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)Masks.Low[Offset]));
+			High[Offset] = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)Masks.High[Offset]));
+		}
+
+		int32_t Index = Start;
+		for (; Index + 32 + NumPrefixChars - 1 <= End; Index += 32)
+		{
+			__m256i Buckets = LookupBucketsAVX2(LoadSlotsAVX2(Text + Index), Low[0], High[0]);
+			for (int32_t Offset = 1; Offset < NumPrefixChars; Offset++)
+			{
+				Buckets = _mm256_and_si256(Buckets, LookupBucketsAVX2(LoadSlotsAVX2(Text + Index + Offset), Low[Offset], High[Offset]));
+			}
+
+			const uint32_t Hits = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(Buckets, _mm256_setzero_si256()));
+			if (Hits != 0)
+			{
+				return Index + (int32_t)CountTrailingZeros(Hits);
+			}
+		}
+		return FindCandidateSSE(Masks, Text, Index, End);
+	}
+
+	ORION_TARGET_AVX2 static int32_t FindPiiCandidateAVX2(const FChar* Text, int32_t Start, int32_t End)
+	{
+		int32_t Index = Start;
+		for (; Index + 32 <= End; Index += 32)
+		{
+			const __m256i Low = IsPiiChar16AVX2(_mm256_loadu_si256((const __m256i*)(Text + Index)));
+			const __m256i High = IsPiiChar16AVX2(_mm256_loadu_si256((const __m256i*)(Text + Index + 16)));
+
+			const __m256i Packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(Low, High), _MM_SHUFFLE(3, 1, 2, 0));
+			const uint32_t Hits = (uint32_t)_mm256_movemask_epi8(Packed);
+			if (Hits != 0)
+			{
+				return Index + (int32_t)CountTrailingZeros(Hits);
+			}
+		}
+		return FindPiiCandidateSSE(Text, Index, End);
+	}
+#endif // ORION_PREFILTER_X86
+
+#if ORION_PREFILTER_NEON
+	static inline uint16x8_t FoldToSlotsNEON(uint16x8_t Chars)
+	{
+		const uint16x8_t IsUpper = vcltq_u16(vsubq_u16(Chars, vdupq_n_u16('A')), vdupq_n_u16(26));
+		Chars = vaddq_u16(Chars, vandq_u16(IsUpper, vdupq_n_u16(32)));
+		return vminq_u16(Chars, vdupq_n_u16(WideSlot));
+	}
+
+	static inline uint8x16_t LoadSlotsNEON(const FChar* Text)
+	{
+		const uint16x8_t Low = FoldToSlotsNEON(vld1q_u16((const uint16_t*)Text));
+		const uint16x8_t High = FoldToSlotsNEON(vld1q_u16((const uint16_t*)(Text + 8)));
+		return vcombine_u8(vmovn_u16(Low), vmovn_u16(High));
+	}
+
+	static inline uint8x16_t LookupBucketsNEON(uint8x16_t Slots, uint8x16_t LowTable, uint8x16_t HighTable)
+	{
+		const uint8x16_t LowBuckets = vqtbl1q_u8(LowTable, vandq_u8(Slots, vdupq_n_u8(0x0F)));
+		const uint8x16_t HighBuckets = vqtbl1q_u8(HighTable, vshrq_n_u8(Slots, 4));
+		return vandq_u8(LowBuckets, HighBuckets);
+	}
+
+	// NEON has no movemask: narrowing 0x00/0xFF bytes leaves 4 bits per byte in a 64-bit mask
+	static inline uint64_t NibbleMaskNEON(uint8x16_t Lanes)
+	{
+		return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Lanes), 4)), 0);
+	}
+
+	static inline uint16x8_t IsPiiChar8NEON(uint16x8_t Chars)
+	{
+		const uint16x8_t IsDigit = vcltq_u16(vsubq_u16(Chars, vdupq_n_u16('0')), vdupq_n_u16(10));
+		return vorrq_u16(IsDigit, vceqq_u16(Chars, vdupq_n_u16('@')));
+	}
+
+	static int32_t FindCandidateNEON(const FMasks& Masks, const FChar* Text, int32_t Start, int32_t End)
+	{
+		uint8x16_t Low[NumPrefixChars];
+		uint8x16_t High[NumPrefixChars];
+		for (int32_t Offset = 0; Offset < NumPrefixChars; Offset++)
+		{
+			Low[Offset] = vld1q_u8(Masks.Low[Offset]);
+			High[Offset] = vld1q_u8(Masks.High[Offset]);
+		}
+
+		int32_t Index = Start;
+		for (; Index + 16 + NumPrefixChars - 1 <= End; Index += 16)
+		{
+			uint8x16_t Buckets = LookupBucketsNEON(LoadSlotsNEON(Text + Index), Low[0], High[0]);
+			for (int32_t Offset = 1; Offset < NumPrefixChars; Offset++)
+			{
+				Buckets = vandq_u8(Buckets, LookupBucketsNEON(LoadSlotsNEON(Text + Index + Offset), Low[Offset], High[Offset]));
+			}
+
+			const uint64_t Hits = NibbleMaskNEON(vtstq_u8(Buckets, Buckets));
+			if (Hits != 0)
+			{
+				return Index + (int32_t)(CountTrailingZeros64(Hits) / 4);
+			}
+		}
+		return FindCandidateScalar(Masks, Text, Index, End);
+	}
+
+	static int32_t FindPiiCandidateNEON(const FChar* Text, int32_t Start, int32_t End)
+	{
+		int32_t Index = Start;
+		for (; Index + 16 <= End; Index += 16)
+		{
+			const uint16x8_t Low = IsPiiChar8NEON(vld1q_u16((const uint16_t*)(Text + Index)));
+			const uint16x8_t High = IsPiiChar8NEON(vld1q_u16((const uint16_t*)(Text + Index + 8)));
+
+			const uint64_t Hits = NibbleMaskNEON(vcombine_u8(vmovn_u16(Low), vmovn_u16(High)));
+			if (Hits != 0)
+			{
+				return Index + (int32_t)(CountTrailingZeros64(Hits) / 4);
+			}
+		}
+		return FindPiiCandidateScalar(Text, Index, End);
+	}
+#endif // ORION_PREFILTER_NEON
+
+	static ESimdLevel DetectLevel()
+	{
+#if ORION_PREFILTER_X86
+		bool bHasSSE41 = false;
+		bool bHasAVX2 = false;
+	#if defined(_MSC_VER)
+		int Info[4];
+		__cpuid(Info, 0);
+		const int MaxLeaf = Info[0];
+		__cpuid(Info, 1);
+		bHasSSE41 = (Info[2] & (1 << 19)) != 0;
+
+		// AVX2 also needs the OS to save the upper halves of the registers
+		const bool bOSSavesYmm = (Info[2] & (1 << 27)) != 0 && (Info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+		if (bOSSavesYmm && MaxLeaf >= 7)
+		{
+			__cpuidex(Info, 7, 0);
+			bHasAVX2 = (Info[1] & (1 << 5)) != 0;
+		}
+	#else
+		__builtin_cpu_init();
+		bHasSSE41 = __builtin_cpu_supports("sse4.1");
+		bHasAVX2 = __builtin_cpu_supports("avx2");
+	#endif
+		return bHasAVX2 ? ESimdLevel::AVX2 : bHasSSE41 ? ESimdLevel::SSE41 : ESimdLevel::Scalar;
+#elif ORION_PREFILTER_NEON
+		return ESimdLevel::NEON;
+#else
+		return ESimdLevel::Scalar;
+#endif
+	}
+
+	static std::atomic<ESimdLevel>& GetActiveLevelStorage()
+	{
+		static std::atomic<ESimdLevel> ActiveLevel(GetSupportedLevel());
+		return ActiveLevel;
+	}
+
+	ESimdLevel GetSupportedLevel()
+	{
+		static const ESimdLevel SupportedLevel = DetectLevel();
+		return SupportedLevel;
+	}
+
+	bool IsSupported(ESimdLevel Level)
+	{
+		const ESimdLevel Supported = GetSupportedLevel();
+		switch (Level)
+		{
+		case ESimdLevel::Scalar:
+			return true;
+		case ESimdLevel::SSE41:
+			return Supported == ESimdLevel::SSE41 || Supported == ESimdLevel::AVX2;
+		default:
+			return Level == Supported;
+		}
+	}
+
+	ESimdLevel GetActiveLevel()
+	{
+		return GetActiveLevelStorage().load(std::memory_order_relaxed);
+	}
+
+	void SetActiveLevel(ESimdLevel Level)
+	{
+		GetActiveLevelStorage().store(IsSupported(Level) ? Level : GetSupportedLevel(), std::memory_order_relaxed);
+	}
+
+	const char* LexToString(ESimdLevel Level)
+	{
+		switch (Level)
+		{
+		case ESimdLevel::SSE41: return "SSE4.1";
+		case ESimdLevel::AVX2:  return "AVX2";
+		case ESimdLevel::NEON:  return "NEON";
+		default:                return "Scalar";
+		}
+	}
+
+	int32_t FindPiiCandidate(FTextView Text, int32_t Start)
+	{
+		const FChar* Chars = Text.data();
+		const int32_t End = (int32_t)Text.size();
+
+		switch (GetActiveLevel())
+		{
+#if ORION_PREFILTER_X86
+		case ESimdLevel::AVX2:  return FindPiiCandidateAVX2(Chars, Start, End);
+		case ESimdLevel::SSE41: return FindPiiCandidateSSE(Chars, Start, End);
+#elif ORION_PREFILTER_NEON
+		case ESimdLevel::NEON:  return FindPiiCandidateNEON(Chars, Start, End);
+#endif
+		default:                return FindPiiCandidateScalar(Chars, Start, End);
+		}
+	}
+}
+
+namespace OrionCore
+{
+	void FPatternPrefilter::AddPattern(FTextView FoldedPattern)
+	{
+		if (FoldedPattern.empty())
+		{
+			return;
+		}
+
+		const int32_t PrefixLen = std::min((int32_t)FoldedPattern.size(), NumPrefixChars);
+
+		// Bucket by the prefix, so patterns that start alike share one bucket's bits
+		uint32_t Hash = 0;
+		for (int32_t Offset = 0; Offset < PrefixLen; Offset++)
+		{
+			Hash = Hash * 31 + Prefilter::ToSlot(FoldedPattern[Offset]);
+		}
+		const uint8_t Bucket = (uint8_t)(1 << (Hash % 8));
+
+		for (int32_t Offset = 0; Offset < NumPrefixChars; Offset++)
+		{
+			if (Offset < PrefixLen)
+			{
+				const uint8_t Slot = Prefilter::ToSlot(FoldedPattern[Offset]);
+				Masks.Low[Offset][Slot & 15] |= Bucket;
+				Masks.High[Offset][Slot >> 4] |= Bucket;
+			}
+			else
+			{
+				for (int32_t Nibble = 0; Nibble < 16; Nibble++)
+				{
+					Masks.Low[Offset][Nibble] |= Bucket;
+					Masks.High[Offset][Nibble] |= Bucket;
+				}
+			}
+		}
+
+		bHasPatterns = true;
+	}
+
+	int32_t FPatternPrefilter::FindCandidate(const FChar* Text, int32_t Start, int32_t End) const
+	{
+		switch (Prefilter::GetActiveLevel())
+		{
+#if ORION_PREFILTER_X86
+		case ESimdLevel::AVX2:  return Prefilter::FindCandidateAVX2(Masks, Text, Start, End);
+		case ESimdLevel::SSE41: return Prefilter::FindCandidateSSE(Masks, Text, Start, End);
+#elif ORION_PREFILTER_NEON
+		case ESimdLevel::NEON:  return Prefilter::FindCandidateNEON(Masks, Text, Start, End);
+#endif
+		case ESimdLevel::Scalar: return Start;
+		default:                 return Prefilter::FindCandidateScalar(Masks, Text, Start, End);
+		}
+	}
+}
@@ -0,0 +1,453 @@
+// OrionCore - PII sanitization
+// Built-in rules matched by hand in a single left-to-right pass
+
+#include "OrionCoreSanitizer.h"
+#include "OrionCorePrefilter.h"
+
+namespace OrionCore::PiiSanitizer
+{
+	static const char* const RuleNames[] =
+	{
+		"emails",
+		"ssn",
+		"creditCards",
+		"phoneNumbers",
+		"ipAddresses",
+	};
+	static_assert(sizeof(RuleNames) / sizeof(RuleNames[0]) == (size_t)EPiiRule::Count, "One name per EPiiRule");
+
+	// Fewest digits any rule without an '@' can match (ipAddresses: "1.2.3.4")
+	static constexpr int32_t MinRuleDigits = 4;
+
+	static inline bool IsDigit(FChar Char)
+	{
+		return (uint32_t)Char - '0' < 10u;
+	}
+
+	static inline bool IsAlpha(FChar Char)
+	{
+		return ((uint32_t)Char | 32u) - 'a' < 26u;
+	}
+
+	static inline bool IsWordChar(FChar Char)
+	{
+		return IsDigit(Char) || IsAlpha(Char) || Char == u'_';
+	}
+
+	static inline bool IsEmailLocalChar(FChar Char)
+	{
+		return IsDigit(Char) || IsAlpha(Char) || Char == u'.' || Char == u'_' || Char == u'%' || Char == u'+' || Char == u'-';
+	}
+
+	static inline bool IsEmailDomainChar(FChar Char)
+	{
+		return IsDigit(Char) || IsAlpha(Char) || Char == u'.' || Char == u'-';
+	}
+
+	// [A-Z|a-z] - the '|' is literal
+	static inline bool IsEmailTldChar(FChar Char)
+	{
+		return IsAlpha(Char) || Char == u'|';
+	}
+
+	static bool IsWhitespace(FChar Char)
+	{
+		const uint32_t Code = (uint32_t)Char;
+		return Code == ' ' || (Code >= '\t' && Code <= '\r')
+			|| Code == 0x0085 || Code == 0x00A0 || Code == 0x1680
+			|| (Code >= 0x2000 && Code <= 0x200A)
+			|| Code == 0x2028 || Code == 0x2029 || Code == 0x202F || Code == 0x205F || Code == 0x3000;
+	}
+
+	static bool EqualsIgnoreCase(FTextView Name, const char* RuleName)
+	{
+		size_t Index = 0;
+		for (; RuleName[Index] != '\0'; Index++)
+		{
+			if (Index >= Name.size())
+			{
+				return false;
+			}
+			const uint32_t A = (uint32_t)Name[Index];
+			const uint32_t B = (uint32_t)(unsigned char)RuleName[Index];
+			if (A != B && !(IsAlpha((FChar)A) && (A | 32u) == (B | 32u)))
+			{
+				return false;
+			}
+		}
+		return Index == Name.size();
+	}
+
+	/**
+	 * One span being matched, with what the email rule has already worked out
+	 * Matching moves strictly left to right, so both caches only ever move forward.
+	 */
+	struct FSpanMatcher
+	{
+		FTextView Text;
+		int32_t Len;
+
+		// End of the run of email local-part characters that last started at or before the position
+		int32_t LocalRunEnd = 0;
+
+		// '@' whose domain was last checked, and where that match ends (IndexNone if it can't)
+		int32_t DomainAt = IndexNone;
+		int32_t DomainEnd = IndexNone;
+
+		explicit FSpanMatcher(FTextView InText)
+			: Text(InText)
+			, Len((int32_t)InText.size())
+		{
+		}
+
+		// Outside the span reads as a character that matches nothing
+		FChar At(int32_t Index) const
+		{
+			return Index < Len ? Text[Index] : FChar(0);
+		}
+
+		// \b
+		bool IsBoundary(int32_t Index) const
+		{
+			const bool bWordBefore = Index > 0 && IsWordChar(Text[Index - 1]);
+			const bool bWordAfter = Index < Len && IsWordChar(Text[Index]);
+			return bWordBefore != bWordAfter;
+		}
+
+		bool AreDigits(int32_t Index, int32_t Count) const
+		{
+			for (int32_t Offset = 0; Offset < Count; Offset++)
+			{
+				if (!IsDigit(At(Index + Offset)))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/** Digits starting at Index, counting no further than Limit */
+		int32_t CountDigits(int32_t Index, int32_t Limit) const
+		{
+			int32_t Count = 0;
+			while (Count < Limit && IsDigit(At(Index + Count)))
+			{
+				Count++;
+			}
+			return Count;
+		}
+
+		// \b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b
+		int32_t MatchEmail(int32_t Pos)
+		{
+			if (!IsEmailLocalChar(At(Pos)))
+			{
+				return IndexNone;
+			}
+
+			// The local part can't contain '@', so it is the whole run of its characters
+			if (Pos >= LocalRunEnd)
+			{
+				LocalRunEnd = Pos;
+				while (IsEmailLocalChar(At(LocalRunEnd)))
+				{
+					LocalRunEnd++;
+				}
+			}
+			if (At(LocalRunEnd) != u'@')
+			{
+				return IndexNone;
+			}
+
+			if (DomainAt != LocalRunEnd)
+			{
+				DomainAt = LocalRunEnd;
+				DomainEnd = MatchEmailDomain(LocalRunEnd + 1);
+			}
+			return DomainEnd;
+		}
+
+		int32_t MatchEmailDomain(int32_t Start) const
+		{
+			int32_t RunEnd = Start;
+			while (IsEmailDomainChar(At(RunEnd)))
+			{
+				RunEnd++;
+			}
+
+			// The domain gives characters back from its end until a '.' follows it, and for each
+			// such '.', the top-level domain gives characters back until a boundary follows it
+			for (int32_t Dot = RunEnd - 1; Dot > Start; Dot--)
+			{
+				if (Text[Dot] != u'.')
+				{
+					continue;
+				}
+
+				int32_t TldEnd = Dot + 1;
+				while (IsEmailTldChar(At(TldEnd)))
+				{
+					TldEnd++;
+				}
+				for (int32_t End = TldEnd; End - (Dot + 1) >= 2; End--)
+				{
+					if (IsBoundary(End))
+					{
+						return End;
+					}
+				}
+			}
+			return IndexNone;
+		}
+
+		// \b\d{3}-\d{2}-\d{4}\b
+		int32_t MatchSsn(int32_t Pos) const
+		{
+			if (AreDigits(Pos, 3) && At(Pos + 3) == u'-' && AreDigits(Pos + 4, 2) && At(Pos + 6) == u'-' && AreDigits(Pos + 7, 4)
+				&& IsBoundary(Pos + 11))
+			{
+				return Pos + 11;
+			}
+			return IndexNone;
+		}
+
+		/**
+		 * Fixed-length digit groups, each but the last followed by an optional separator, then \b
+		 * The separator is taken when present and only left out if the rest fails with it.
+		 */
+		int32_t MatchGroups(int32_t Pos, const int32_t* GroupLengths, int32_t NumGroups, FChar SeparatorA, FChar SeparatorB) const
+		{
+			if (!AreDigits(Pos, GroupLengths[0]))
+			{
+				return IndexNone;
+			}
+
+			const int32_t After = Pos + GroupLengths[0];
+			if (NumGroups == 1)
+			{
+				return IsBoundary(After) ? After : IndexNone;
+			}
+
+			const FChar Next = At(After);
+			if (Next == SeparatorA || Next == SeparatorB)
+			{
+				const int32_t End = MatchGroups(After + 1, GroupLengths + 1, NumGroups - 1, SeparatorA, SeparatorB);
+				if (End != IndexNone)
+				{
+					return End;
+				}
+			}
+			return MatchGroups(After, GroupLengths + 1, NumGroups - 1, SeparatorA, SeparatorB);
+		}
+
+		// \b(?:\d{4}[- ]?){3}\d{4}\b
+		int32_t MatchCreditCard(int32_t Pos) const
+		{
+			static const int32_t Groups[] = { 4, 4, 4, 4 };
+			return MatchGroups(Pos, Groups, 4, u'-', u' ');
+		}
+
+		// \b\d{3}[-.]?\d{3}[-.]?\d{4}\b
+		int32_t MatchPhoneNumber(int32_t Pos) const
+		{
+			static const int32_t Groups[] = { 3, 3, 4 };
+			return MatchGroups(Pos, Groups, 3, u'-', u'.');
+		}
+
+		// \b(?:\d{1,3}\.){3}\d{1,3}\b
+		int32_t MatchIpAddress(int32_t Pos) const
+		{
+			// A group can only end where its digits do: the next character must be the '.',
+			// or for the last group a boundary, and neither follows a digit
+			for (int32_t Group = 0; Group < 4; Group++)
+			{
+				const int32_t Digits = CountDigits(Pos, 4);
+				if (Digits < 1 || Digits > 3)
+				{
+					return IndexNone;
+				}
+				Pos += Digits;
+
+				if (Group < 3)
+				{
+					if (At(Pos) != u'.')
+					{
+						return IndexNone;
+					}
+					Pos++;
+				}
+			}
+			return IsBoundary(Pos) ? Pos : IndexNone;
+		}
+	};
+}
+
+namespace OrionCore
+{
+	const char* FPiiSanitizer::GetRuleName(EPiiRule Rule)
+	{
+		return PiiSanitizer::RuleNames[(int32_t)Rule];
+	}
+
+	bool FPiiSanitizer::AddRule(FTextView Name, FTextView Replacement)
+	{
+		for (int32_t Rule = 0; Rule < (int32_t)EPiiRule::Count; Rule++)
+		{
+			if (PiiSanitizer::EqualsIgnoreCase(Name, PiiSanitizer::RuleNames[Rule]))
+			{
+				NumRules += bEnabled[Rule] ? 0 : 1;
+				bEnabled[Rule] = true;
+				Replacements[Rule] = std::u16string(Replacement);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool FPiiSanitizer::IsBreak(FTextView Text, int32_t Index)
+	{
+		if (!PiiSanitizer::IsWhitespace(Text[Index]))
+		{
+			return false;
+		}
+
+		const bool bBetweenDigits = Index > 0 && Index + 1 < (int32_t)Text.size()
+			&& PiiSanitizer::IsDigit(Text[Index - 1]) && PiiSanitizer::IsDigit(Text[Index + 1]);
+		return !bBetweenDigits;
+	}
+
+	bool FPiiSanitizer::Sanitize(FTextView Text, std::u16string& OutSanitized, const FCancelCheck& Cancel) const
+	{
+		if (NumRules == 0 || Text.empty())
+		{
+			return false;
+		}
+
+		int32_t Cursor = 0;
+		bool bModified = false;
+
+		if (Prefilter::GetActiveLevel() == ESimdLevel::Scalar)
+		{
+			SanitizeSpan(Text, 0, (int32_t)Text.size(), Cursor, bModified, OutSanitized, Cancel);
+		}
+		else
+		{
+			// Only the words around an '@' or digit can hold PII; matches never cross a break,
+			// so each word can be matched on its own
+			const int32_t Len = (int32_t)Text.size();
+			int32_t Candidate = Prefilter::FindPiiCandidate(Text, 0);
+			while (Candidate < Len && !Cancel.IsCancelled())
+			{
+				int32_t Begin = Candidate;
+				while (Begin > 0 && !IsBreak(Text, Begin - 1))
+				{
+					Begin--;
+				}
+
+				int32_t End = Candidate + 1;
+				while (End < Len && !IsBreak(Text, End))
+				{
+					End++;
+				}
+
+				bool bHasAt = false;
+				int32_t NumDigits = 0;
+				for (int32_t Index = Begin; Index < End; Index++)
+				{
+					bHasAt |= Text[Index] == u'@';
+					NumDigits += PiiSanitizer::IsDigit(Text[Index]) ? 1 : 0;
+				}
+
+				if (bHasAt || NumDigits >= PiiSanitizer::MinRuleDigits)
+				{
+					SanitizeSpan(Text, Begin, End, Cursor, bModified, OutSanitized, Cancel);
+				}
+
+				Candidate = Prefilter::FindPiiCandidate(Text, End);
+			}
+		}
+
+		if (Cancel.IsCancelled())
+		{
+			return false;
+		}
+
+		if (bModified)
+		{
+			OutSanitized.append(Text.data() + Cursor, Text.size() - Cursor);
+		}
+
+		return bModified;
+	}
+
+	void FPiiSanitizer::SanitizeBatch(const FTextView* Texts, int32_t Num, FSanitizeResult* OutResults) const
+	{
+		for (int32_t Index = 0; Index < Num; Index++)
+		{
+			OutResults[Index].bModified = Sanitize(Texts[Index], OutResults[Index].Text);
+		}
+	}
+
+	void FPiiSanitizer::SanitizeSpan(FTextView Text, int32_t Begin, int32_t End, int32_t& Cursor, bool& bModified, std::u16string& OutSanitized,
+		const FCancelCheck& Cancel) const
+	{
+		// Word boundaries at the span's edges behave as in the full text: every span starts
+		// and ends at the text's ends or next to whitespace
+		PiiSanitizer::FSpanMatcher Matcher(Text.substr(Begin, End - Begin));
+
+		for (int32_t Pos = 0; Pos < Matcher.Len; )
+		{
+			// Every rule starts with \b, and all but emails with a digit
+			const FChar Char = Matcher.Text[Pos];
+			if (!Matcher.IsBoundary(Pos) || !(PiiSanitizer::IsDigit(Char) || (bEnabled[(int32_t)EPiiRule::Emails] && PiiSanitizer::IsEmailLocalChar(Char))))
+			{
+				Pos++;
+				continue;
+			}
+
+			int32_t MatchEnd = IndexNone;
+			int32_t Rule = 0;
+			for (; Rule < (int32_t)EPiiRule::Count && MatchEnd == IndexNone; Rule++)
+			{
+				if (!bEnabled[Rule])
+				{
+					continue;
+				}
+
+				switch ((EPiiRule)Rule)
+				{
+				case EPiiRule::Emails:       MatchEnd = Matcher.MatchEmail(Pos); break;
+				case EPiiRule::Ssn:          MatchEnd = Matcher.MatchSsn(Pos); break;
+				case EPiiRule::CreditCards:  MatchEnd = Matcher.MatchCreditCard(Pos); break;
+				case EPiiRule::PhoneNumbers: MatchEnd = Matcher.MatchPhoneNumber(Pos); break;
+				case EPiiRule::IpAddresses:  MatchEnd = Matcher.MatchIpAddress(Pos); break;
+				default: break;
+				}
+			}
+
+			if (MatchEnd == IndexNone)
+			{
+				Pos++;
+				continue;
+			}
+
+			if (!bModified)
+			{
+				OutSanitized.clear();
+				OutSanitized.reserve(Text.size());
+				bModified = true;
+			}
+
+			// Rule was stepped past the one that matched
+			OutSanitized.append(Text.data() + Cursor, Begin + Pos - Cursor);
+			OutSanitized += Replacements[Rule - 1];
+			Cursor = Begin + MatchEnd;
+			Pos = MatchEnd;
+
+			if (Cancel.IsCancelled())
+			{
+				return;
+			}
+		}
+	}
+}
@@ -0,0 +1,393 @@
+#pragma once
+#include "OrionCoreTypes.h"
+#include "OrionCorePrefilter.h"
+#include <algorithm>
+
+namespace OrionCore
+{
+    /**
+     * Pattern categories checked by the Intersect Scanner and Fulcrum Filter.
+     * Declaration order is the order the stages evaluate them in.
+     */
+    enum class EPatternCategory : uint8_t
+    {
+        Hallucination,      // Intersect
+        Bias,               // Intersect
+        Toxicity,           // Intersect
+        PromptInjection,    // Fulcrum
+        DataExfiltration,   // Fulcrum
+
+        Count
+    };
+
+    /** How FPatternMatcher::Compile() matches text against the patterns */
+    struct FMatcherOptions
+    {
+        // Fold Latin-1, Latin Extended-A, Greek and Cyrillic case, not just ASCII
+        bool bUnicodeFolding = false;
+
+        // Match text skeletons instead of the text itself
+        bool bNormalize = false;
+
+        // Also match within this many edits, 0 to FPatternMatcher::MaxFuzzyEditDistance
+        int32_t MaxEditDistance = 0;
+
+        // Patterns shorter than this only match exactly
+        int32_t MinFuzzyLength = 12;
+    };
+
+    /** Matches found by one scan - the first pattern (in config order) hit per category */
+    struct FScanResult
+    {
+        int32_t FirstMatch[(int32_t)EPatternCategory::Count];
+
+        FScanResult()
+        {
+            Reset();
+        }
+
+        void Reset()
+        {
+            for (int32_t& Index : FirstMatch)
+            {
+                Index = IndexNone;
+            }
+        }
+
+        bool HasMatch(EPatternCategory Category) const
+        {
+            return FirstMatch[(int32_t)Category] != IndexNone;
+        }
+
+        int32_t GetMatch(EPatternCategory Category) const
+        {
+            return FirstMatch[(int32_t)Category];
+        }
+    };
+
+    /**
+     * Seed hits a ranged scan couldn't settle yet, because the text ended before the
+     * fuzzy check around them was complete. Kept by whoever scans a growing text in
+     * ranges, and checked again with FPatternMatcher::VerifyPending once more has arrived.
+     */
+    struct FPendingSeeds
+    {
+        struct FSeed
+        {
+            int32_t Index;      // Of the seed's last character
+            int32_t SeedIndex;
+        };
+
+        std::vector<FSeed> Seeds;
+
+        void Reset()
+        {
+            Seeds.clear();
+        }
+
+        bool IsEmpty() const
+        {
+            return Seeds.empty();
+        }
+    };
+
+    /**
+     * Flat tables behind a compiled matcher
+     * Plain arrays with no pointers between them, so they can be written to disk as-is
+     * and used straight out of a mapped Casey Protocol blob.
+     */
+    struct ORIONCORE_API FMatcherTables
+    {
+        int32_t NumClasses = 1;
+        int32_t NumStates = 0;
+        bool bUnicodeFolding = false;
+
+        // FMatcherOptions the tables were compiled with
+        bool bNormalized = false;
+        int32_t MaxEditDistance = 0;
+        int32_t MinFuzzyLength = 0;
+
+        // Normalized matchers only: the class of dropped characters, which every state loops
+        // on, and of separators, which states reached by one loop on. IndexNone if unused.
+        int32_t SkipClass = IndexNone;
+        int32_t SpaceClass = IndexNone;
+
+        // Alphabet compression: every character that appears in a pattern gets a class,
+        // everything else shares class 0. FoldedAsciiClasses maps A-Z to the lower-case class.
+        TTableView<uint16_t> AsciiClasses;          // 128 entries
+        TTableView<uint16_t> FoldedAsciiClasses;    // 128 entries
+        TTableView<FChar> WideChars;                // Sorted, for binary search
+        TTableView<int32_t> WideCharClasses;
+
+        // Dense DFA: Transitions[State * NumClasses + Class]
+        TTableView<int32_t> Transitions;
+
+        // Patterns ending at each state (own outputs only) and the nearest
+        // failure-chain state that has outputs of its own
+        TTableView<int32_t> OutputOffsets;          // NumStates + 1 entries
+        TTableView<int32_t> OutputPatterns;
+        TTableView<int32_t> DictionaryLinks;
+
+        // Per pattern id: category, index within the category, and where its
+        // null-terminated original text starts in PatternText
+        TTableView<uint8_t> PatternCategories;
+        TTableView<int32_t> PatternCategoryIndices;
+        TTableView<int32_t> PatternTextOffsets;
+        TTableView<FChar> PatternText;
+
+        // Pattern ids of each category, in config order
+        TTableView<int32_t> CategoryOffsets;        // Count + 1 entries
+        TTableView<int32_t> CategoryPatterns;
+
+        // Fuzzy matching: output ids from NumPatterns up are seeds. Per seed, the pattern it
+        // was cut from and where in that pattern's classes it ends; per pattern, its
+        // (normalized) text as character classes, empty for exact-only patterns.
+        TTableView<int32_t> SeedPatterns;
+        TTableView<int32_t> SeedEnds;
+        TTableView<int32_t> FuzzyOffsets;           // NumPatterns + 1 entries, or none
+        TTableView<uint16_t> FuzzyClasses;
+
+        /**
+         * Check that the table sizes agree with each other, and that every entry a scan
+         * indexes with stays in bounds - state, class, pattern and seed ids, offsets, and
+         * dictionary links that never loop. O(size of the tables).
+         */
+        bool IsConsistent() const;
+    };
+
+    /**
+     * Compiled multi-pattern matcher (Aho-Corasick)
+     * "I flashed on every pattern at once."
+     *
+     * Built once from the Casey Protocol pattern lists, then shared read-only by every
+     * validation. A single pass over the text finds matches for all categories, so cost
+     * no longer grows with the number of patterns. Case is folded per character while
+     * scanning, so the text is never copied or lowered up front.
+     *
+     * The automaton is a handful of flat tables (FMatcherTables). They are either compiled
+     * in process or used unchanged from a precompiled Casey Protocol blob.
+     *
+     * Whenever the automaton is back at its root, FPatternPrefilter skips ahead to the next
+     * position a pattern could start at, so clean text is mostly covered a vector at a time.
+     *
+     * Optionally the matcher reads text skeletons (OrionCore::Normalizer) rather than raw
+     * text. The mapping is compiled into the alphabet tables - dropped characters loop in
+     * place and separator runs collapse through self-loops - so a normalized scan costs
+     * what an exact one does. Patterns can also match within a few edits: each is split
+     * into MaxEditDistance + 1 seeds, one of which must occur unedited in any close match.
+     * The seeds are compiled into the same automaton, and only a seed hit runs a
+     * bit-parallel Levenshtein check of its pattern over the text around it.
+     */
+    class ORIONCORE_API FPatternMatcher
+    {
+    public:
+        // Longest pattern (after normalization) that can match fuzzily, and the most edits allowed
+        static constexpr int32_t MaxFuzzyLength = 64;
+        static constexpr int32_t MaxFuzzyEditDistance = 3;
+
+        FPatternMatcher() = default;
+        FPatternMatcher(const FPatternMatcher&) = delete;
+        FPatternMatcher& operator=(const FPatternMatcher&) = delete;
+
+        /** Register a pattern; its index is its position within the category */
+        void AddPattern(EPatternCategory Category, FTextView Pattern);
+
+        /**
+         * Register some of a compiled matcher's categories, read back from its tables
+         * Patterns keep their index within their category, so rule IDs found by either
+         * matcher agree and Source can still describe them.
+         * @param CategoryMask - Bit (1 << Category) per EPatternCategory to keep
+         */
+        void AddPatternsFrom(const FPatternMatcher& Source, uint32_t CategoryMask);
+
+        /** Build the automaton. Must be called after the last AddPattern. */
+        void Compile(const FMatcherOptions& Options);
+
+        /**
+         * Use tables that live in someone else's memory, without copying them
+         * The memory has to outlive the matcher.
+         * @return false (and stays uncompiled) if the tables are inconsistent
+         */
+        bool CompileFromTables(const FMatcherTables& InTables);
+
+        /** Options the matcher was compiled with, e.g. to compile a subset the same way */
+        FMatcherOptions GetOptions() const;
+
+        bool IsCompiled() const { return bCompiled; }
+
+        /**
+         * Scan text in a single pass, folding case as it goes
+         * @param Text - Text in any case
+         * @param OutResult - Receives the first pattern hit per category
+         */
+        void Scan(FTextView Text, FScanResult& OutResult) const;
+
+        /** Scan() each of Texts[0, Num) into OutResults[0, Num) */
+        void ScanBatch(const FTextView* Texts, int32_t Num, FScanResult* OutResults) const;
+
+        /**
+         * Continue a scan over the next piece of a text that arrives in chunks
+         * Exact matches that straddle chunk boundaries are found as if the text were whole.
+         * Fuzzy matches are not: their check only sees this chunk, so one that straddles a
+         * boundary is missed. Scan the whole text so far with ScanRange and VerifyPending
+         * when the matcher has fuzzy patterns.
+         * @param Text - Next chunk, in any case
+         * @param State - Value returned for the previous chunk, or 0 for the first
+         * @param InOutResult - Accumulates matches across chunks; Reset() it before the first
+         * @return State to pass in with the next chunk
+         */
+        int32_t ScanChunk(FTextView Text, int32_t State, FScanResult& InOutResult) const;
+
+        /**
+         * ScanChunk over Text[Start, End), with the rest of Text as context
+         * Fuzzy matches are checked against the text around their seed, including what lies
+         * outside the range; exact matching only ever reads the range.
+         * @param OutPending - If set, receives seeds whose check ran into the end of Text
+         */
+        int32_t ScanRange(FTextView Text, int32_t Start, int32_t End, int32_t State, FScanResult& InOutResult,
+            FPendingSeeds* OutPending = nullptr) const;
+
+        /**
+         * Check pending seeds again now that Text has grown past where they were found
+         * Seeds that settle are removed; those still cut short by the end of Text stay. Together
+         * with ScanRange over each new chunk this finds what Scan() over the whole text would.
+         */
+        void VerifyPending(FTextView Text, FPendingSeeds& InOutPending, FScanResult& InOutResult) const;
+
+        /**
+         * Find the first pattern occurrence in text
+         * Same automaton as Scan(), but stops at the first hit.
+         * @param Text - Text in any case
+         * @param OutCategory - Category of the pattern that ended first in the text
+         * @return true if any pattern matched
+         */
+        bool ScanFirst(FTextView Text, EPatternCategory& OutCategory) const;
+
+        /** Original (un-lowered), null-terminated pattern text, as written in the Casey Protocol */
+        const FChar* GetPattern(EPatternCategory Category, int32_t Index) const;
+
+        const FMatcherTables& GetTables() const { return Tables; }
+
+        int32_t GetNumPatterns() const { return bCompiled ? Tables.PatternCategories.Num() : (int32_t)PendingPatterns.size(); }
+
+        /** Patterns in one category of a compiled matcher */
+        int32_t GetNumPatterns(EPatternCategory Category) const
+        {
+            return Tables.CategoryOffsets[(int32_t)Category + 1] - Tables.CategoryOffsets[(int32_t)Category];
+        }
+
+        int32_t GetNumStates() const { return Tables.NumStates; }
+
+        /** Patterns that can also match within MaxEditDistance edits */
+        int32_t GetNumFuzzyPatterns() const { return NumFuzzyPatterns; }
+
+        /** Simple (one-to-one) lower-case folding for the scripts Unicode folding covers */
+        static FChar FoldUnicode(FChar Char)
+        {
+            const uint32_t Code = (uint32_t)Char;
+            if (Code < 128)
+            {
+                return (Code - 'A' < 26u) ? (FChar)(Code + 32) : Char;
+            }
+            if ((Code >= 0xC0 && Code <= 0xDE && Code != 0xD7) ||   // Latin-1
+                (Code >= 0x391 && Code <= 0x3AB && Code != 0x3A2) || // Greek
+                (Code >= 0x410 && Code <= 0x42F))                    // Cyrillic
+            {
+                return (FChar)(Code + 0x20);
+            }
+            if (Code >= 0x400 && Code <= 0x40F)
+            {
+                return (FChar)(Code + 0x50);
+            }
+            // Latin Extended-A alternates upper/lower, with the odd/even phase flipping twice
+            if ((Code >= 0x100 && Code <= 0x12F) || (Code >= 0x132 && Code <= 0x137) || (Code >= 0x14A && Code <= 0x177))
+            {
+                return (FChar)(Code | 1);
+            }
+            if (((Code >= 0x139 && Code <= 0x148) || (Code >= 0x179 && Code <= 0x17E)) && (Code & 1))
+            {
+                return (FChar)(Code + 1);
+            }
+            if (Code == 0x178)
+            {
+                return (FChar)0xFF;
+            }
+            return Char;
+        }
+
+    private:
+        struct FPatternEntry
+        {
+            std::u16string Text;
+            EPatternCategory Category;
+        };
+
+        int32_t GetWideCharClass(FChar Char) const
+        {
+            const FChar* Found = std::lower_bound(Tables.WideChars.begin(), Tables.WideChars.end(), Char);
+            return Found != Tables.WideChars.end() && *Found == Char ? Tables.WideCharClasses[(int32_t)(Found - Tables.WideChars.begin())] : 0;
+        }
+
+        // Class of the folded character - upper-case ASCII letters share their
+        // lower-case class in FoldedAsciiClasses
+        int32_t GetFoldedCharClass(FChar Char) const
+        {
+            if (Char < 128)
+            {
+                return Tables.FoldedAsciiClasses[Char];
+            }
+            return GetWideCharClass(Tables.bUnicodeFolding ? FoldUnicode(Char) : Char);
+        }
+
+        /** Feed every pattern's folded first characters to the prefilter */
+        void BuildPrefilter();
+
+        /**
+         * Does the pattern seed SeedIndex came from occur within MaxEditDistance edits of the text around Text[Index]?
+         * @param bOutCutShort - If set, whether the end of Text stopped the check short of all it could reach
+         */
+        bool VerifySeed(FTextView Text, int32_t Index, int32_t SeedIndex, bool* bOutCutShort = nullptr) const;
+
+        FChar Fold(FChar Char) const
+        {
+            if (Tables.bUnicodeFolding)
+            {
+                return FoldUnicode(Char);
+            }
+            return (uint32_t)Char - 'A' < 26u ? (FChar)(Char + 32) : Char;
+        }
+
+        // Patterns registered before Compile; emptied once they are in the tables
+        std::vector<FPatternEntry> PendingPatterns;
+
+        // Views used for matching - into the vectors below, or into someone else's memory
+        FMatcherTables Tables;
+
+        // Storage for matchers compiled in-process
+        std::vector<uint16_t> OwnedAsciiClasses;
+        std::vector<uint16_t> OwnedFoldedAsciiClasses;
+        std::vector<FChar> OwnedWideChars;
+        std::vector<int32_t> OwnedWideCharClasses;
+        std::vector<int32_t> OwnedTransitions;
+        std::vector<int32_t> OwnedOutputOffsets;
+        std::vector<int32_t> OwnedOutputPatterns;
+        std::vector<int32_t> OwnedDictionaryLinks;
+        std::vector<uint8_t> OwnedPatternCategories;
+        std::vector<int32_t> OwnedPatternCategoryIndices;
+        std::vector<int32_t> OwnedPatternTextOffsets;
+        std::vector<FChar> OwnedPatternText;
+        std::vector<int32_t> OwnedCategoryOffsets;
+        std::vector<int32_t> OwnedCategoryPatterns;
+        std::vector<int32_t> OwnedSeedPatterns;
+        std::vector<int32_t> OwnedSeedEnds;
+        std::vector<int32_t> OwnedFuzzyOffsets;
+        std::vector<uint16_t> OwnedFuzzyClasses;
+
+        // Rebuilt from the pattern text rather than stored, so blobs don't depend on it
+        FPatternPrefilter Prefilter;
+
+        int32_t NumFuzzyPatterns = 0;
+
+        bool bCompiled = false;
+    };
+}
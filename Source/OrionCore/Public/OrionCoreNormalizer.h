@@ -0,0 +1,38 @@
+#pragma once
+#include "OrionCoreTypes.h"
+
+/**
+ * Text skeletons for obfuscation-resistant pattern matching
+ * "Same guy, Chuck. He just grew a mustache."
+ *
+ * Maps every character to the one it stands for, so "IGN0RE  previous\tinstructions",
+ * "іgnore" with a Cyrillic і, full-width letters and words split by zero-width spaces all
+ * read as "ignore previous instructions". Covered:
+ * - case, and diacritics on Latin-1 / Latin Extended-A letters
+ * - an NFKC-style compatibility subset: full-width ASCII, super/subscript and circled
+ *   digits, circled letters
+ * - Greek and Cyrillic letters that look like Latin ones
+ * - leetspeak: 0 o, 1 ! | l i, 3 e, 4 @ a, 5 $ s, 7 + t
+ * - zero-width, format and combining characters, and in-word punctuation (. - _ * ' `),
+ *   which are dropped
+ * - whitespace and other punctuation, which become a separator
+ *
+ * The mapping is one character to at most one, so FPatternMatcher can bake it into its
+ * alphabet tables and a normalized scan does the same work per character as an exact
+ * one. It is deliberately lossy (l and i read alike) and applied to patterns and text the
+ * same way; multi-character expansions such as ligatures are not covered.
+ */
+namespace OrionCore::Normalizer
+{
+    /** What Normalize() returns for characters that are dropped altogether */
+    constexpr FChar Dropped = 0;
+
+    /** What Normalize() returns for whitespace and separating punctuation */
+    constexpr FChar Separator = u' ';
+
+    /** The skeleton character Char stands for, Separator, or Dropped */
+    ORIONCORE_API FChar Normalize(FChar Char);
+
+    /** Skeleton of a whole string: separator runs collapse to one and both ends are trimmed */
+    ORIONCORE_API std::u16string NormalizeText(FTextView Text);
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include "OrionCoreTypes.h"
+
+namespace OrionCore
+{
+    /** Instruction sets the prefilters can run on */
+    enum class ESimdLevel : uint8_t
+    {
+        Scalar,     // No prefiltering - the exact matchers see the whole text
+        SSE41,
+        AVX2,
+        NEON
+    };
+}
+
+/**
+ * Vectorized prefilters for the clean path
+ * "Most days, nothing happens at the Buy More."
+ *
+ * Most validated text contains no pattern and no PII, yet the exact matchers still walk
+ * it character by character. The prefilters skip ahead a vector at a time to the next
+ * place a match could begin, and the exact matchers only look at what they flag. They
+ * never skip over anything the exact path would match.
+ *
+ * The level is picked once from what the CPU reports (SSE4.1 and AVX2 on x64, NEON on
+ * ARM64) and can be overridden, e.g. to benchmark against Scalar.
+ */
+namespace OrionCore::Prefilter
+{
+    /** Fastest level this CPU supports */
+    ORIONCORE_API ESimdLevel GetSupportedLevel();
+
+    ORIONCORE_API bool IsSupported(ESimdLevel Level);
+
+    /** Level every prefilter currently runs at */
+    ORIONCORE_API ESimdLevel GetActiveLevel();
+
+    /**
+     * Override the level; levels the CPU doesn't support fall back to GetSupportedLevel()
+     * @param Level - Scalar turns prefiltering off entirely
+     */
+    ORIONCORE_API void SetActiveLevel(ESimdLevel Level);
+
+    ORIONCORE_API const char* LexToString(ESimdLevel Level);
+
+    /**
+     * Find the next character any PII rule needs - '@' or an ASCII digit
+     * @return Index of the first such character at or after Start, or Text.size()
+     */
+    ORIONCORE_API int32_t FindPiiCandidate(FTextView Text, int32_t Start);
+}
+
+namespace OrionCore
+{
+    /**
+     * First-characters prefilter for FPatternMatcher
+     *
+     * Every (folded) pattern contributes its first three characters to a small set of nibble
+     * lookup tables, split over 8 buckets. A position is a candidate when it and the next
+     * two characters all fall in the same bucket; each lookup is one byte shuffle per
+     * vector. Non-ASCII characters share one slot, so they are conservatively candidates
+     * wherever any pattern has one.
+     */
+    class ORIONCORE_API FPatternPrefilter
+    {
+    public:
+        static constexpr int32_t NumPrefixChars = 3;
+
+        /**
+         * Add a pattern, already folded the way the matcher folds text
+         * Patterns shorter than NumPrefixChars accept anything after their last character.
+         */
+        void AddPattern(FTextView FoldedPattern);
+
+        /** True once a pattern has been added and prefiltering is not turned off */
+        bool IsActive() const
+        {
+            return bHasPatterns && Prefilter::GetActiveLevel() != ESimdLevel::Scalar;
+        }
+
+        /**
+         * Find the next position a pattern could start at
+         * Upper-case ASCII is folded on the fly, matching ASCII case folding; for Unicode
+         * folding the non-ASCII slot already covers every character that folds.
+         * @return First candidate in [Start, End), or End
+         */
+        int32_t FindCandidate(const FChar* Text, int32_t Start, int32_t End) const;
+
+        // Bucket bits for the low/high nibble of the character at each prefix offset
+        struct FMasks
+        {
+            alignas(16) uint8_t Low[NumPrefixChars][16] = {};
+            alignas(16) uint8_t High[NumPrefixChars][16] = {};
+        };
+
+    private:
+        FMasks Masks;
+        bool bHasPatterns = false;
+    };
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "OrionCoreTypes.h"
+
+namespace OrionCore
+{
+    /** Built-in PII rules, in match priority order (earlier rules win at the same position) */
+    enum class EPiiRule : uint8_t
+    {
+        Emails,
+        Ssn,
+        CreditCards,
+        PhoneNumbers,
+        IpAddresses,
+
+        Count
+    };
+
+    /** What FPiiSanitizer::SanitizeBatch() produced for one text */
+    struct FSanitizeResult
+    {
+        std::u16string Text;        // Only written when bModified
+        bool bModified = false;
+    };
+
+    /**
+     * PII sanitization behind Charles Carmichael
+     * "My name is Charles Carmichael." (It isn't.)
+     *
+     * Each built-in rule is a hand-written matcher for what used to be its regex:
+     *   emails         \b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b
+     *   ssn            \b\d{3}-\d{2}-\d{4}\b
+     *   creditCards    \b(?:\d{4}[- ]?){3}\d{4}\b
+     *   phoneNumbers   \b\d{3}[-.]?\d{3}[-.]?\d{4}\b
+     *   ipAddresses    \b(?:\d{1,3}\.){3}\d{1,3}\b
+     * They match exactly as the alternation of those regexes would: the leftmost match wins,
+     * earlier rules win at the same position, and each rule backtracks in the same order a
+     * regex engine does. \d and \b are ASCII - digits are 0-9, word characters
+     * [A-Za-z0-9_] - so no Unicode tables are involved and every build agrees.
+     *
+     * Every rule needs an '@' or a run of digits, so the SIMD prefilter finds those first
+     * and the matchers only run over the words around them.
+     */
+    class ORIONCORE_API FPiiSanitizer
+    {
+    public:
+        /** Rule name as written in the Casey Protocol's sanitizationRules */
+        static const char* GetRuleName(EPiiRule Rule);
+
+        /**
+         * Replace matches of the named rule (case-insensitive) with Replacement
+         * @return false if no built-in rule has that name
+         */
+        bool AddRule(FTextView Name, FTextView Replacement);
+
+        bool HasRule(EPiiRule Rule) const { return bEnabled[(int32_t)Rule]; }
+
+        int32_t GetNumRules() const { return NumRules; }
+
+        /**
+         * Replace every PII match with its rule's replacement text
+         * @param Text - Input to sanitize
+         * @param OutSanitized - Receives the sanitized text (only written when something matched)
+         * @param Cancel - Checked between matches; once cancelled, gives up and returns false
+         * @return true if at least one rule matched
+         */
+        bool Sanitize(FTextView Text, std::u16string& OutSanitized, const FCancelCheck& Cancel = FCancelCheck()) const;
+
+        /** Sanitize() each of Texts[0, Num) into OutResults[0, Num) */
+        void SanitizeBatch(const FTextView* Texts, int32_t Num, FSanitizeResult* OutResults) const;
+
+        /**
+         * Whether no rule can match across Text[Index]
+         * Matches never contain whitespace, except the single spaces between a credit card
+         * number's digit groups.
+         */
+        static bool IsBreak(FTextView Text, int32_t Index);
+
+    private:
+        /** Run the rules over Text[Begin, End), appending what they replaced to OutSanitized */
+        void SanitizeSpan(FTextView Text, int32_t Begin, int32_t End, int32_t& Cursor, bool& bModified, std::u16string& OutSanitized,
+            const FCancelCheck& Cancel) const;
+
+        bool bEnabled[(int32_t)EPiiRule::Count] = {};
+        std::u16string Replacements[(int32_t)EPiiRule::Count];
+        int32_t NumRules = 0;
+    };
+}
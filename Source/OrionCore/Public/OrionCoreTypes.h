@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Unreal Build Tool defines this for the OrionCore module; builds outside the engine
+// (the Python extension) compile the core straight into their own binary
+#ifndef ORIONCORE_API
+    #define ORIONCORE_API
+#endif
+
+/**
+ * OrionCore - the matching engine shared by the Unreal plugin and the Python package
+ * "Same Intersect, different head."
+ *
+ * Nothing in here depends on the engine: text is UTF-16 (what TCHAR is on every
+ * platform the plugin ships on), containers are the standard library's. The OrionAI
+ * module wraps these classes for FString callers; the Python extension wraps the very
+ * same ones, so both see identical matches and identical sanitized text.
+ */
+namespace OrionCore
+{
+    using FChar = char16_t;
+    using FTextView = std::u16string_view;
+
+    constexpr int32_t IndexNone = -1;
+
+    /** Read-only view of a table that lives elsewhere - in the object that built it, or in a mapped file */
+    template <typename T>
+    class TTableView
+    {
+    public:
+        TTableView() = default;
+
+        TTableView(const T* InData, int32_t InNum)
+            : Data(InData)
+            , Count(InNum)
+        {
+        }
+
+        TTableView(const std::vector<T>& Vector)
+            : Data(Vector.data())
+            , Count((int32_t)Vector.size())
+        {
+        }
+
+        const T* GetData() const { return Data; }
+        int32_t Num() const { return Count; }
+
+        const T& operator[](int32_t Index) const { return Data[Index]; }
+        const T& Last() const { return Data[Count - 1]; }
+
+        const T* begin() const { return Data; }
+        const T* end() const { return Data + Count; }
+
+    private:
+        const T* Data = nullptr;
+        int32_t Count = 0;
+    };
+
+    /** Lets a long scan give up early; a default one never cancels */
+    struct FCancelCheck
+    {
+        bool (*IsCancelledFn)(const void* Context) = nullptr;
+        const void* Context = nullptr;
+
+        bool IsCancelled() const
+        {
+            return IsCancelledFn && IsCancelledFn(Context);
+        }
+    };
+}
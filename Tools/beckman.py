@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+Beckman - OrionAI Benchmark Regression Gate
+Compares C++ benchmark results (OrionAI.Perf automation tests) against a saved baseline
+
+"I don't want excuses, I want results." - General Beckman
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+
+
+# Metric -> (lower is better, default relative tolerance, absolute slack)
+METRICS = {
+    'p50Ns': (True, 0.10, 50.0),
+    'p99Ns': (True, 0.25, 200.0),
+    'allocsPerCall': (True, 0.0, 0.5),
+    'bytesPerCall': (True, 0.05, 64.0),
+    'throughputPerSec': (False, 0.10, 0.0),
+}
+
+
+def load_results(paths):
+    """Merge every result from the given files/directories, keyed by benchmark id"""
+    results = {}
+    for path in paths:
+        path = Path(path)
+        files = sorted(path.glob('*.json')) if path.is_dir() else [path]
+        for file in files:
+            with open(file, encoding='utf-8') as handle:
+                data = json.load(handle)
+            if data.get('schemaVersion') != 1:
+                raise ValueError(f"{file}: unsupported schemaVersion {data.get('schemaVersion')}")
+            for result in data.get('results', []):
+                results[result['id']] = result
+    return results
+
+
+def is_regression(metric, baseline, current, tolerance):
+    lower_is_better, _, slack = METRICS[metric]
+    if lower_is_better:
+        return current > baseline * (1.0 + tolerance) + slack
+    return current < baseline * (1.0 - tolerance) - slack
+
+
+def compare(baseline, current, tolerances, verbose):
+    regressions = []
+    missing = sorted(set(baseline) - set(current))
+    added = sorted(set(current) - set(baseline))
+
+    for bench_id in sorted(set(baseline) & set(current)):
+        for metric, tolerance in tolerances.items():
+            old = baseline[bench_id].get(metric)
+            new = current[bench_id].get(metric)
+            if old is None or new is None:
+                continue
+
+            change = ((new - old) / old * 100.0) if old else 0.0
+            regressed = is_regression(metric, old, new, tolerance)
+            if regressed:
+                regressions.append((bench_id, metric, old, new, change))
+            if verbose or regressed:
+                status = 'REGRESSED' if regressed else 'ok'
+                print(f"  {status:9} {bench_id:60} {metric:16} {old:14.1f} -> {new:14.1f} ({change:+.1f}%)")
+
+    for bench_id in missing:
+        print(f"  [!] Missing from current run: {bench_id}")
+    for bench_id in added:
+        print(f"  [+] New benchmark (no baseline): {bench_id}")
+
+    return regressions, missing
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Beckman - OrionAI Benchmark Regression Gate',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  python beckman.py compare Benchmarks/baseline.json Saved/Benchmarks
+  python beckman.py compare baseline.json Saved/Benchmarks --tolerance p50Ns=0.05
+  python beckman.py baseline Saved/Benchmarks --out Benchmarks/baseline.json
+        """
+    )
+
+    subparsers = parser.add_subparsers(dest='command', help='Benchmark commands')
+
+    # Compare against a baseline
+    compare_parser = subparsers.add_parser('compare', help='Fail if any benchmark regressed')
+    compare_parser.add_argument('baseline', help='Baseline results file or directory')
+    compare_parser.add_argument('current', nargs='+', help='Current results files or directories')
+    compare_parser.add_argument('--tolerance', action='append', default=[], metavar='METRIC=FRACTION',
+                                help='Override a relative tolerance, e.g. p99Ns=0.3')
+    compare_parser.add_argument('--strict', action='store_true', help='Also fail when a baseline benchmark is missing')
+    compare_parser.add_argument('--verbose', action='store_true', help='Show every comparison')
+
+    # Save a new baseline
+    baseline_parser = subparsers.add_parser('baseline', help='Merge results into a single baseline file')
+    baseline_parser.add_argument('current', nargs='+', help='Results files or directories')
+    baseline_parser.add_argument('--out', required=True, help='Baseline file to write')
+
+    args = parser.parse_args()
+
+    if not args.command:
+        parser.print_help()
+        return 1
+
+    print("\n" + "="*70)
+    print("  BECKMAN BENCHMARK REVIEW")
+    print("  'I don't want excuses, I want results.' - General Beckman")
+    print("="*70)
+
+    if args.command == 'baseline':
+        results = load_results(args.current)
+        with open(args.out, 'w', encoding='utf-8') as handle:
+            json.dump({'schemaVersion': 1, 'suite': 'baseline', 'results': list(results.values())}, handle, indent=2)
+        print(f"\n[*] Wrote {len(results)} benchmarks to {args.out}\n")
+        return 0
+
+    tolerances = {metric: spec[1] for metric, spec in METRICS.items()}
+    for override in args.tolerance:
+        metric, _, value = override.partition('=')
+        if metric not in METRICS:
+            print(f"[X] Unknown metric '{metric}' (expected one of {', '.join(METRICS)})")
+            return 1
+        tolerances[metric] = float(value)
+
+    baseline = load_results([args.baseline])
+    current = load_results(args.current)
+
+    print(f"\n[*] Comparing {len(current)} benchmarks against {len(baseline)} baseline entries...")
+    regressions, missing = compare(baseline, current, tolerances, args.verbose)
+
+    failed = bool(regressions) or (args.strict and bool(missing))
+    print(f"\nCompleted: {len(regressions)} regressions, {len(missing)} missing")
+    print("\n" + "="*70)
+    print("  " + ("Mission failed. Fix it, Bartowski." if failed else "Mission accomplished. 🎖️"))
+    print("="*70 + "\n")
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())